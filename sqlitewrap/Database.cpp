@@ -23,6 +23,7 @@
 #include <cstring>
 #include <cstdarg>
 #include <sstream>
+#include <chrono>
 
 #include "IError.h"
 #include "Database.h"
@@ -30,11 +31,22 @@
 
 namespace SQLW
 {
+    // WAL lets readers run while a session writes, NORMAL is safe with WAL.
+    // busy_timeout goes first so switching to WAL waits out another writer.
+    const char *Database::POOL_PRAGMAS =
+        "PRAGMA busy_timeout=5000; "
+        "PRAGMA journal_mode=WAL; "
+        "PRAGMA synchronous=NORMAL; "
+        "PRAGMA cache_size=10000; ";
+
     Database::Database(const std::string& database, IError *error)
         : m_database(database)
         , m_errhandler(error)
         , m_mutex(m_mutex)
         , m_is_mutex(false)
+        , m_pragmas()
+        , m_statement_hits(0)
+        , m_statement_misses(0)
     {
         std::cout << "Database Created" << std::endl;
     }
@@ -45,6 +57,9 @@ namespace SQLW
         , m_errhandler(error)
         , m_mutex(m)
         , m_is_mutex(true)
+        , m_pragmas()
+        , m_statement_hits(0)
+        , m_statement_misses(0)
     {
         std::cout << "Database Created w/ Mutex" << std::endl;
     }
@@ -76,61 +91,227 @@ namespace SQLW
     }
 
 
+    /*
+     * Borrow a connection, the thread's last connection is preferred so it
+     * keeps a warm page and statement cache. When the pool is bounded and
+     * all are borrowed, wait for one to be freed.
+     */
     Database::DatabasePool *Database::addDatabasePool()
     {
-        MutexLock lck(m_mutex, m_is_mutex);
-        DatabasePool *odb = nullptr;
+        std::unique_lock<std::mutex> lock(m_pool_mutex);
+        ++m_stats.acquires;
 
-        for(m_database_pool::iterator it = m_opendbs.begin(); it != m_opendbs.end(); ++it)
+        DatabasePool *odb = findIdleConnection();
+        if(!odb && m_stats.max_connections > 0 && m_stats.open >= m_stats.max_connections)
         {
-            odb = *it;
-            if(!odb->busy)
-            {
-                break;
-            }
-            else
+            ++m_stats.waits;
+            std::chrono::milliseconds timeout(POOL_WAIT_TIMEOUT);
+            if(!m_pool_free.wait_for(lock, timeout, [this] { return m_stats.busy < m_stats.open; }))
             {
-                odb = nullptr;
+                // Nested queries on one thread could wait forever, open one more instead.
+                databaseError("addDatabasePool: no free connection after %d ms", POOL_WAIT_TIMEOUT);
+                ++m_stats.overflows;
             }
+            odb = findIdleConnection();
         }
 
         if(!odb)
         {
-            odb = new DatabasePool;
+            odb = openConnection();
             if(!odb)
             {
-                databaseError("addDatabasePool: DatabasePool couldn't be created");
                 return nullptr;
             }
+            m_opendbs.push_back(odb);
+            ++m_stats.open;
+        }
+
+        borrowConnection(odb);
+        return odb;
+    }
+
+
+    void Database::freeDatabasePool(Database::DatabasePool *odb)
+    {
+        std::lock_guard<std::mutex> lock(m_pool_mutex);
+        if(odb && odb->busy)
+        {
+            odb->busy = false;
+            --m_stats.busy;
+            m_pool_free.notify_one();
+        }
+    }
+
+
+    void Database::setMaxConnections(int max_connections)
+    {
+        std::lock_guard<std::mutex> lock(m_pool_mutex);
+        m_stats.max_connections = max_connections;
+    }
+
+
+    void Database::setConnectionPragmas(const std::string &pragmas)
+    {
+        std::lock_guard<std::mutex> lock(m_pool_mutex);
+        m_pragmas = pragmas;
+    }
+
+
+    Database::PoolStats Database::getPoolStats()
+    {
+        std::lock_guard<std::mutex> lock(m_pool_mutex);
+        PoolStats stats = m_stats;
+        stats.statement_hits = m_statement_hits;
+        stats.statement_misses = m_statement_misses;
+        return stats;
+    }
+
+
+    /*
+     * Only the thread that borrowed the connection uses it's cache, no lock needed.
+     */
+    Database::CachedStatement *Database::getCachedStatement(DatabasePool *odb, const std::string &sql)
+    {
+        if(!odb)
+        {
+            return nullptr;
+        }
+
+        std::map<std::string, m_statement_list::iterator>::iterator found = odb->statement_index.find(sql);
+        if(found != odb->statement_index.end())
+        {
+            // Move to the back as most recently used.
+            odb->statements.splice(odb->statements.end(), odb->statements, found->second);
+            ++m_statement_hits;
+            return *found->second;
+        }
+
+        CachedStatement *cached = new CachedStatement();
+        cached->sql = sql;
+
+        const char *s = nullptr;
+        int rc = sqlite3_prepare_v2(odb->db, sql.c_str(), sql.size(), &cached->stmt, &s);
+        if(rc != SQLITE_OK || !cached->stmt)
+        {
+            databaseError("getCachedStatement: prepare failed: %s", sqlite3_errmsg(odb->db));
+            delete cached;
+            return nullptr;
+        }
+
+        // Column names are looked up once here, not on every result.
+        int count = sqlite3_column_count(cached->stmt);
+        for(int i = 0; i < count; i++)
+        {
+            const char *name = sqlite3_column_name(cached->stmt, i);
+            if(name)
+            {
+                cached->columns.insert(std::make_pair(name, i + 1));
+            }
+        }
+        cached->num_cols = count;
+
+        if(odb->statements.size() >= STATEMENT_CACHE_SIZE)
+        {
+            CachedStatement *oldest = odb->statements.front();
+            odb->statement_index.erase(oldest->sql);
+            odb->statements.pop_front();
+            delete oldest;
+        }
+
+        odb->statements.push_back(cached);
+        odb->statement_index[sql] = --odb->statements.end();
+        ++m_statement_misses;
+        return cached;
+    }
+
 
-            // Look into shared chache more!
-            // int sqlite3_enable_shared_cache(int);
-            // SQLITE_OPEN_SHAREDCACHE.
-            int rc = sqlite3_open_v2(m_database.c_str(), &odb->db, SQLITE_OPEN_CREATE | SQLITE_OPEN_READWRITE, NULL);
-            if(rc)
+    std::string Database::formatQuery(const char *format, ...)
+    {
+        va_list ap;
+        va_start(ap, format);
+        char *formatted = sqlite3_vmprintf(format, ap);
+        va_end(ap);
+
+        std::string result = formatted ? formatted : "";
+        sqlite3_free(formatted);
+        return result;
+    }
+
+
+    /*
+     * Idle connection last used by this thread, otherwise any idle one.
+     * Called with the pool mutex held.
+     */
+    Database::DatabasePool *Database::findIdleConnection()
+    {
+        std::thread::id thread = std::this_thread::get_id();
+        DatabasePool *idle = nullptr;
+
+        for(m_database_pool::iterator it = m_opendbs.begin(); it != m_opendbs.end(); ++it)
+        {
+            DatabasePool *odb = *it;
+            if(odb->busy)
             {
-                databaseError("Can't open database: %s\n", sqlite3_errmsg(odb -> db));
-                delete odb;
-                return nullptr;
+                continue;
+            }
+            if(odb->thread == thread)
+            {
+                ++m_stats.affinity_hits;
+                return odb;
+            }
+            if(!idle)
+            {
+                idle = odb;
             }
+        }
+        return idle;
+    }
 
-            odb->busy = true;
-            m_opendbs.push_back(odb);
+
+    /*
+     * Open a new connection and apply the pragmas, only done once per connection.
+     * Called with the pool mutex held.
+     */
+    Database::DatabasePool *Database::openConnection()
+    {
+        DatabasePool *odb = new DatabasePool;
+
+        // Each connection keeps it's own page cache, the pool keeps them few.
+        int rc = sqlite3_open_v2(m_database.c_str(), &odb->db,
+                                 SQLITE_OPEN_CREATE | SQLITE_OPEN_READWRITE | SQLITE_OPEN_NOMUTEX, NULL);
+        if(rc)
+        {
+            databaseError("Can't open database: %s\n", sqlite3_errmsg(odb -> db));
+            delete odb;
+            return nullptr;
         }
-        else
+
+        if(!m_pragmas.empty())
         {
-            odb->busy = true;
+            char *errorMsg = nullptr;
+            rc = sqlite3_exec(odb->db, m_pragmas.c_str(), nullptr, nullptr, &errorMsg);
+            if(rc != SQLITE_OK)
+            {
+                databaseError("Connection pragmas failed: %s\n", errorMsg ? errorMsg : "");
+                sqlite3_free(errorMsg);
+            }
         }
         return odb;
     }
 
 
-    void Database::freeDatabasePool(Database::DatabasePool *odb)
+    /*
+     * Mark a connection borrowed by this thread.
+     * Called with the pool mutex held.
+     */
+    void Database::borrowConnection(DatabasePool *odb)
     {
-        MutexLock lck(m_mutex, m_is_mutex);
-        if(odb)
+        odb->busy = true;
+        odb->thread = std::this_thread::get_id();
+        ++m_stats.busy;
+        if(m_stats.busy > m_stats.peak_busy)
         {
-            odb->busy = false;
+            m_stats.peak_busy = m_stats.busy;
         }
     }
 
@@ -192,6 +373,12 @@ namespace SQLW
     }
 
 
+    const std::string &Database::getDatabaseName() const
+    {
+        return m_database;
+    }
+
+
     Database::MutexLock::MutexLock(Mutex& mutex, bool use)
         : m_mutex(mutex)
         , m_is_inuse(use)
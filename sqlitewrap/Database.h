@@ -21,6 +21,11 @@
 
 #include <string>
 #include <list>
+#include <map>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
 #include <stdint.h>
 
 namespace SQLW
@@ -72,15 +77,45 @@ namespace SQLW
 
     public:
 
+        // Prepared Statement kept on a connection, reused by it's SQL text.
+        struct CachedStatement
+        {
+            CachedStatement()
+                : sql("")
+                , stmt(nullptr)
+                , columns()
+                , num_cols(0)
+            { }
+            ~CachedStatement()
+            {
+                if (stmt)
+                {
+                    sqlite3_finalize(stmt);
+                }
+            }
+
+            std::string                sql;
+            sqlite3_stmt              *stmt;
+            std::map<std::string, int> columns;     ///< Column name to index + 1, built once
+            int                        num_cols;
+        };
+        typedef std::list<CachedStatement *> m_statement_list;
+
         // Connection pool struct.
         struct DatabasePool
         {
             DatabasePool()
                 : db(nullptr)
                 , busy(false)
+                , thread()
             { }
             ~DatabasePool()
             {
+                // Statements must be finalized before the connection closes.
+                for (m_statement_list::iterator it = statements.begin(); it != statements.end(); ++it)
+                {
+                    delete *it;
+                }
                 if (db)
                 {
                     sqlite3_close_v2(db);
@@ -89,15 +124,57 @@ namespace SQLW
 
             sqlite3 *db;
             bool busy;
+            std::thread::id thread;     ///< Last thread to borrow, for affinity
+
+            // Least Recently Used first, only touched by the borrowing thread.
+            m_statement_list statements;
+            std::map<std::string, m_statement_list::iterator> statement_index;
         };
         typedef std::list<DatabasePool *> m_database_pool;
 
+        // Pool occupancy
+        struct PoolStats
+        {
+            PoolStats()
+                : open(0)
+                , busy(0)
+                , peak_busy(0)
+                , max_connections(0)
+                , acquires(0)
+                , affinity_hits(0)
+                , waits(0)
+                , overflows(0)
+                , statement_hits(0)
+                , statement_misses(0)
+            { }
+
+            int           open;             ///< Connections opened
+            int           busy;             ///< Connections borrowed now
+            int           peak_busy;        ///< Most borrowed at once
+            int           max_connections;  ///< Bound, 0 is unbounded
+            unsigned long acquires;         ///< Total borrows
+            unsigned long affinity_hits;    ///< Borrows that got the thread's last connection
+            unsigned long waits;            ///< Borrows that waited for a free connection
+            unsigned long overflows;        ///< Opened past the bound after waiting too long
+            unsigned long statement_hits;   ///< Prepared statements reused from a cache
+            unsigned long statement_misses; ///< Prepared statements parsed and cached
+        };
+
+        // Pragmas for a shared pool, opt in with setConnectionPragmas.
+        static const char *POOL_PRAGMAS;
+
+        // Milliseconds to wait for a connection before opening past the bound.
+        static const int POOL_WAIT_TIMEOUT = 5000;
+
+        // Prepared statements kept per connection.
+        static const size_t STATEMENT_CACHE_SIZE = 32;
+
     public:
 
         // use file
         Database(const std::string& database, IError *databaseError = nullptr);
 
-        // Use file + thread safe
+        // Use file + external mutex, the pool has its own lock so this is kept for compatibility.
         Database(Mutex&, const std::string& database, IError *databaseError = nullptr);
 
         virtual ~Database();
@@ -105,6 +182,9 @@ namespace SQLW
         /** try to establish connection with given host */
         bool isConnected();
 
+        /** Database file this pool opens connections to. */
+        const std::string &getDatabaseName() const;
+
         void errorHandler(IError *);
         void databaseError(Query&,const char *format, ...);
         void databaseError(Query&,const std::string&);
@@ -131,6 +211,23 @@ namespace SQLW
 
         void freeDatabasePool(DatabasePool *odb);
 
+        /** Bound the number of connections, 0 (default) is unbounded.
+        Once every connection is borrowed new requests wait for one to be freed. */
+        void setMaxConnections(int max_connections);
+
+        /** Pragmas run on each new connection, none by default. */
+        void setConnectionPragmas(const std::string &pragmas);
+
+        /** Snapshot of Pool Occupancy. */
+        PoolStats getPoolStats();
+
+        /** Prepared statement for the SQL on a borrowed connection, parsed
+        only the first time. Used by Query::prepare, reset before it's reused. */
+        CachedStatement *getCachedStatement(DatabasePool *odb, const std::string &sql);
+
+        /** Format with sqlite3_mprintf (%Q, %q quoting) and free the buffer. */
+        static std::string formatQuery(const char *format, ...);
+
     	// Escape string - change all ' to ''.
     	std::string safeString(const std::string& );
 		
@@ -147,11 +244,23 @@ namespace SQLW
 
         void databaseError(const char *format, ...);
 
+        DatabasePool *findIdleConnection();
+        DatabasePool *openConnection();
+        void borrowConnection(DatabasePool *odb);
+
         std::string         m_database;
         m_database_pool     m_opendbs;
         IError             *m_errhandler;
         Mutex&              m_mutex;
         bool                m_is_mutex;
+
+        std::mutex              m_pool_mutex;
+        std::condition_variable m_pool_free;
+        std::string             m_pragmas;
+        PoolStats               m_stats;
+
+        std::atomic<unsigned long> m_statement_hits;
+        std::atomic<unsigned long> m_statement_misses;
     };
 
 
@@ -38,6 +38,7 @@ namespace SQLW
         , cache_rc_valid(false)
         , m_row_count(0)
         , m_num_cols(0)
+        , m_cached(nullptr)
     {
         /*
         if(m_db.isConnected())
@@ -63,6 +64,7 @@ namespace SQLW
         , cache_rc_valid(false)
         , m_row_count(0)
         , m_num_cols(0)
+        , m_cached(nullptr)
     {
         execute(sql);
     }
@@ -74,7 +76,7 @@ namespace SQLW
         if(res)
         {
             //GetDatabase().error(*this, "sqlite3_finalize in destructor");
-            sqlite3_finalize(res);
+            releaseStatement();
         }
 
         res = nullptr;
@@ -213,7 +215,7 @@ namespace SQLW
     {
         if(odb && res)
         {
-            sqlite3_finalize(res);
+            releaseStatement();
         }
 
         // Always reset anyways!
@@ -224,6 +226,157 @@ namespace SQLW
         std::map<std::string,int>().swap(m_nmap);
     }
 
+    /*
+     * Cached statements stay with the connection, reset them for the next
+     * Query and clear the bindings so old values can't leak into it.
+     */
+    void Query::releaseStatement()
+    {
+        if(m_cached)
+        {
+            sqlite3_reset(res);
+            sqlite3_clear_bindings(res);
+            m_cached = nullptr;
+        }
+        else
+        {
+            sqlite3_finalize(res);
+        }
+    }
+
+    bool Query::prepare(const std::string& sql)
+    {
+        m_last_query = sql;
+        if(odb && res)
+        {
+            getDatabase().databaseError(*this, "prepare: query busy");
+            return false;
+        }
+        if(!odb)
+        {
+            return false;
+        }
+
+        m_cached = getDatabase().getCachedStatement(odb, sql);
+        if(!m_cached)
+        {
+            getDatabase().databaseError(*this, "prepare: prepare query failed");
+            return false;
+        }
+
+        res = m_cached->stmt;
+        sqlite3_reset(res);
+        sqlite3_clear_bindings(res);
+
+        row = false;
+        cache_rc_valid = false;
+        m_num_cols = m_cached->num_cols;
+        std::map<std::string, int>().swap(m_nmap);
+        return true;
+    }
+
+    bool Query::bindResult(int rc)
+    {
+        if(rc != SQLITE_OK)
+        {
+            getDatabase().databaseError(*this, "bind: " + std::string(sqlite3_errmsg(odb->db)));
+            return false;
+        }
+        return true;
+    }
+
+    bool Query::bind(int index, int value)
+    {
+        return m_cached && bindResult(sqlite3_bind_int(res, index, value));
+    }
+
+    bool Query::bind(int index, unsigned int value)
+    {
+        return m_cached && bindResult(sqlite3_bind_int64(res, index, static_cast<sqlite3_int64>(value)));
+    }
+
+    bool Query::bind(int index, long value)
+    {
+        return m_cached && bindResult(sqlite3_bind_int64(res, index, static_cast<sqlite3_int64>(value)));
+    }
+
+    bool Query::bind(int index, long long value)
+    {
+        return m_cached && bindResult(sqlite3_bind_int64(res, index, static_cast<sqlite3_int64>(value)));
+    }
+
+    bool Query::bind(int index, double value)
+    {
+        return m_cached && bindResult(sqlite3_bind_double(res, index, value));
+    }
+
+    bool Query::bind(int index, const std::string& value)
+    {
+        return m_cached && bindResult(sqlite3_bind_text(res, index, value.c_str(), value.size(), SQLITE_TRANSIENT));
+    }
+
+    bool Query::bind(int index, const char *value)
+    {
+        if(!value)
+        {
+            return bindNull(index);
+        }
+        return m_cached && bindResult(sqlite3_bind_text(res, index, value, -1, SQLITE_TRANSIENT));
+    }
+
+    bool Query::bindNull(int index)
+    {
+        return m_cached && bindResult(sqlite3_bind_null(res, index));
+    }
+
+    int Query::getBindParameterCount()
+    {
+        return m_cached ? sqlite3_bind_parameter_count(res) : 0;
+    }
+
+    bool Query::execute()
+    {
+        if(!odb || !m_cached)
+        {
+            getDatabase().databaseError(*this, "execute: nothing prepared");
+            return false;
+        }
+
+        int rc = sqlite3_step(res);
+        releaseStatement();
+        res = nullptr;
+
+        switch(rc)
+        {
+            case SQLITE_BUSY:
+                getDatabase().databaseError(*this, "execute: database busy");
+                return false;
+            case SQLITE_DONE:
+            case SQLITE_ROW:
+                return true;
+            case SQLITE_MISUSE:
+                getDatabase().databaseError(*this, "execute: database misuse");
+                return false;
+        }
+        getDatabase().databaseError(*this, sqlite3_errmsg(odb->db));
+        return false;
+    }
+
+    sqlite3_stmt *Query::getResult()
+    {
+        if(!odb || !m_cached)
+        {
+            getDatabase().databaseError(*this, "get_result: nothing prepared");
+            return nullptr;
+        }
+
+        // Column index comes from the cache, no rebuild per query.
+        cache_rc = sqlite3_step(res);
+        cache_rc_valid = true;
+        m_row_count = (cache_rc == SQLITE_ROW) ? 1 : 0;
+        return res;
+    }
+
     bool Query::fetchRow()
     {
         rowcount = 0;
@@ -297,7 +450,7 @@ namespace SQLW
 
     const char *Query::getString(const std::string& x)
     {
-        int index = m_nmap[x] - 1;
+        int index = getColumnIndex(x);
         if(index >= 0)
         {
             return getString(index);
@@ -323,7 +476,7 @@ namespace SQLW
 
     double Query::getNumber(const std::string& x)
     {
-        int index = m_nmap[x] - 1;
+        int index = getColumnIndex(x);
         if(index >= 0)
         {
             return getNumber(index);
@@ -343,7 +496,7 @@ namespace SQLW
 
     long Query::getValue(const std::string& x)
     {
-        int index = m_nmap[x] - 1;
+        int index = getColumnIndex(x);
         if(index >= 0)
         {
             return getValue(index);
@@ -375,7 +528,7 @@ namespace SQLW
 
     unsigned long Query::getUnsignedValue(const std::string& x)
     {
-        int index = m_nmap[x] - 1;
+        int index = getColumnIndex(x);
         if(index >= 0)
         {
             return getUnsignedValue(index);
@@ -402,7 +555,7 @@ namespace SQLW
 
     int64_t Query::getBigInt(const std::string& x)
     {
-        int index = m_nmap[x] - 1;
+        int index = getColumnIndex(x);
         if(index >= 0)
         {
             return getBigInt(index);
@@ -427,7 +580,7 @@ namespace SQLW
 
     uint64_t Query::getUnsignedBitInt(const std::string& x)
     {
-        int index = m_nmap[x] - 1;
+        int index = getColumnIndex(x);
         if(index >= 0)
         {
             return getUnsignedBitInt(index);
@@ -526,6 +679,17 @@ namespace SQLW
         getDatabase().databaseError(*this, msg);
     }
 
+    int Query::getColumnIndex(const std::string& name)
+    {
+        const std::map<std::string, int> &columns = m_cached ? m_cached->columns : m_nmap;
+        std::map<std::string, int>::const_iterator it = columns.find(name);
+        if(it == columns.end())
+        {
+            return -1;
+        }
+        return it->second - 1;
+    }
+
     /**
      * Create a new Executate Transaction
      */
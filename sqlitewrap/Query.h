@@ -50,6 +50,34 @@ namespace SQLW
 
         /** Execute query and store result. */
         sqlite3_stmt *getResult(const std::string& sql);
+
+        /**
+         * @brief Prepared Statements, cached on the connection by SQL text.
+         *        prepare() then bind() by 1 based index, then execute() or getResult().
+         *        freeResult() resets the statement for the next use instead of finalizing.
+         */
+
+        /** Prepare (or reuse) a statement with ? parameters. */
+        bool prepare(const std::string& sql);
+
+        /** Bind parameter values to the prepared statement. */
+        bool bind(int index, int value);
+        bool bind(int index, unsigned int value);
+        bool bind(int index, long value);
+        bool bind(int index, long long value);
+        bool bind(int index, double value);
+        bool bind(int index, const std::string& value);
+        bool bind(int index, const char *value);
+        bool bindNull(int index);
+
+        /** Number of parameters in the prepared statement. */
+        int getBindParameterCount();
+
+        /** Execute the prepared statement, does not store result. */
+        bool execute();
+
+        /** Execute the prepared statement and store result. */
+        sqlite3_stmt *getResult();
         /** Free stored result, must be called after get_result() before calling
         	execute()/get_result() again. */
 
@@ -265,24 +293,7 @@ namespace SQLW
         T getFieldByName(const TT &tt, T &t)
         {
             // Grab the index of the Matching Field Name
-            std::map<std::string, int>::iterator it;
-            int index = 0;
-
-            if (m_nmap.empty())
-            {
-                return t;
-            }
-
-            it = m_nmap.find(tt);
-            if (it != m_nmap.end())
-            {
-                index = it->second;
-                --index;
-            }
-            else
-            {
-                return t;
-            }
+            int index = getColumnIndex(tt);
             if (index >= 0)
             {
                 switch(sqlite3_column_type(res, index))
@@ -299,6 +310,20 @@ namespace SQLW
             return t;
         }
 
+        /**
+        * @brief Get Field Value by Column Index, skips the name lookup for
+        *        statements with a known column order. NULL leaves the value as is.
+        */
+        template <typename T>
+        void getFieldByIndex(int index, T &t)
+        {
+            if (res && index >= 0 && index < sqlite3_column_count(res)
+                    && sqlite3_column_type(res, index) != SQLITE_NULL)
+            {
+                getFieldValue(t, index);
+            }
+        }
+
 
         std::string getFieldType(float &)
         {
@@ -401,6 +426,15 @@ namespace SQLW
         /** Print error to debug class. */
         void queryError(const std::string&);
 
+        /** Index of a column name in the result, -1 if not found. */
+        int getColumnIndex(const std::string&);
+
+        /** Check a bind result code. */
+        bool bindResult(int rc);
+
+        /** Release the statement, cached statements are reset and kept. */
+        void releaseStatement();
+
         
 
         Database&                  m_db;           ///< Reference to database object
@@ -418,6 +452,8 @@ namespace SQLW
         std::map<std::string, int> m_nmap;         ///< map translating column names to index
         int                        m_num_cols;     ///< number of columns in result
 
+        Database::CachedStatement *m_cached;       ///< Prepared statement owned by the connection
+
     };
 
 } // namespace SQLW
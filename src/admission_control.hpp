@@ -0,0 +1,250 @@
+#ifndef ADMISSION_CONTROL_HPP
+#define ADMISSION_CONTROL_HPP
+
+#include <iostream>
+#include <string>
+#include <map>
+#include <deque>
+#include <mutex>
+#include <memory>
+#include <chrono>
+
+class AdmissionControl;
+typedef std::shared_ptr<AdmissionControl> admission_control_ptr;
+typedef std::weak_ptr<AdmissionControl>   admission_control_wptr;
+
+/**
+ * @class AdmissionTicket
+ * @author Michael Griffin
+ * @date 17/10/2026
+ * @file admission_control.hpp
+ * @brief Held by an admitted connection, releases it's slot once destroyed.
+ */
+class AdmissionTicket
+{
+public:
+    AdmissionTicket(admission_control_wptr admission_control, const std::string &address)
+        : m_admission_control(admission_control)
+        , m_address(address)
+    { }
+
+    ~AdmissionTicket();
+
+private:
+    admission_control_wptr m_admission_control;
+    std::string            m_address;
+};
+
+typedef std::shared_ptr<AdmissionTicket> admission_ticket_ptr;
+
+
+/**
+ * @class AdmissionControl
+ * @author Michael Griffin
+ * @date 17/10/2026
+ * @file admission_control.hpp
+ * @brief Accept Storm Protection, checked by the Listener before a Session is created.
+ *        Limits Total Nodes, Concurrent and Per-Minute Connections per Address.
+ *        A Limit of 0 is Unlimited.
+ */
+class AdmissionControl
+    : public std::enable_shared_from_this<AdmissionControl>
+{
+public:
+
+    enum
+    {
+        ADMIT_ACCEPTED     = 0,
+        ADMIT_MAX_NODES    = 1,
+        ADMIT_MAX_ADDRESS  = 2,
+        ADMIT_RATE_LIMITED = 3
+    };
+
+    AdmissionControl(int max_nodes, int max_per_address, int max_per_minute)
+        : m_max_nodes(max_nodes)
+        , m_max_per_address(max_per_address)
+        , m_max_per_minute(max_per_minute)
+        , m_active_nodes(0)
+    { }
+
+    ~AdmissionControl()
+    {
+        std::cout << "~AdmissionControl" << std::endl;
+    }
+
+    /**
+     * @brief Check a New Connection, a ticket is returned when admitted.
+     * @param address
+     * @param reason ADMIT_ value on rejection
+     * @return nullptr when rejected
+     */
+    admission_ticket_ptr admit(const std::string &address, int &reason)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        AddressEntry &entry = m_addresses[address];
+
+        // Keep only the last minute of attempts, rejected ones count too.
+        while (!entry.m_attempts.empty() && now - entry.m_attempts.front() >= std::chrono::minutes(1))
+        {
+            entry.m_attempts.pop_front();
+        }
+        if (m_max_per_minute > 0)
+        {
+            entry.m_attempts.push_back(now);
+        }
+
+        reason = ADMIT_ACCEPTED;
+        if (m_max_nodes > 0 && m_active_nodes >= m_max_nodes)
+        {
+            reason = ADMIT_MAX_NODES;
+        }
+        else if (m_max_per_address > 0 && entry.m_active >= m_max_per_address)
+        {
+            reason = ADMIT_MAX_ADDRESS;
+        }
+        else if (m_max_per_minute > 0 && static_cast<int>(entry.m_attempts.size()) > m_max_per_minute)
+        {
+            reason = ADMIT_RATE_LIMITED;
+        }
+
+        if (reason != ADMIT_ACCEPTED)
+        {
+            // Don't let a flood of attempts grow the window without bound.
+            if (static_cast<int>(entry.m_attempts.size()) > m_max_per_minute + 1)
+            {
+                entry.m_attempts.pop_front();
+            }
+            pruneAddresses(now);
+            return nullptr;
+        }
+
+        ++entry.m_active;
+        ++m_active_nodes;
+        pruneAddresses(now);
+        return admission_ticket_ptr(new AdmissionTicket(shared_from_this(), address));
+    }
+
+    /**
+     * @brief Rejection Banner, written to the socket before it's closed.
+     * @param reason
+     * @return
+     */
+    static std::string getRejectMessage(int reason)
+    {
+        switch (reason)
+        {
+            case ADMIT_MAX_NODES:
+                return "\r\nAll nodes are busy, please try again later.\r\n";
+            case ADMIT_MAX_ADDRESS:
+                return "\r\nToo many connections from your address.\r\n";
+            case ADMIT_RATE_LIMITED:
+                return "\r\nToo many connection attempts, please wait a minute.\r\n";
+            default:
+                return "";
+        }
+    }
+
+    /**
+     * @brief Number of Admitted Connections
+     * @return
+     */
+    int getActiveNodes()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_active_nodes;
+    }
+
+    /**
+     * @brief Number of Admitted Connections from an Address
+     * @param address
+     * @return
+     */
+    int getActiveConnections(const std::string &address)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_addresses.find(address);
+        return (it == m_addresses.end()) ? 0 : it->second.m_active;
+    }
+
+    /**
+     * @brief Release a Connection's slot, called from AdmissionTicket.
+     * @param address
+     */
+    void release(const std::string &address)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_addresses.find(address);
+        if (it != m_addresses.end() && it->second.m_active > 0)
+        {
+            --it->second.m_active;
+            --m_active_nodes;
+        }
+    }
+
+private:
+
+    /**
+     * @brief Per Address Concurrent Count and Recent Attempts
+     */
+    struct AddressEntry
+    {
+        AddressEntry()
+            : m_active(0)
+        { }
+
+        int m_active;
+        std::deque<std::chrono::steady_clock::time_point> m_attempts;
+    };
+
+    /**
+     * @brief Drop Addresses with no connections or recent attempts
+     *        Scanners use many addresses, keep the map from growing.
+     * @param now
+     */
+    void pruneAddresses(std::chrono::steady_clock::time_point now)
+    {
+        if (static_cast<int>(m_addresses.size()) < MAX_TRACKED_ADDRESSES)
+        {
+            return;
+        }
+
+        for (auto it = m_addresses.begin(); it != m_addresses.end(); )
+        {
+            if (it->second.m_active == 0 && (it->second.m_attempts.empty()
+                                             || now - it->second.m_attempts.back() >= std::chrono::minutes(1)))
+            {
+                it = m_addresses.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+    }
+
+    static const int MAX_TRACKED_ADDRESSES = 1024;
+
+    int m_max_nodes;
+    int m_max_per_address;
+    int m_max_per_minute;
+    int m_active_nodes;
+
+    std::mutex m_mutex;
+    std::map<std::string, AddressEntry> m_addresses;
+};
+
+
+/**
+ * @brief Release the Slot if Admission Control is still around.
+ */
+inline AdmissionTicket::~AdmissionTicket()
+{
+    admission_control_ptr admission_control = m_admission_control.lock();
+    if (admission_control)
+    {
+        admission_control->release(m_address);
+    }
+}
+
+#endif // ADMISSION_CONTROL_HPP
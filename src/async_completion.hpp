@@ -0,0 +1,71 @@
+#ifndef ASYNC_COMPLETION_HPP
+#define ASYNC_COMPLETION_HPP
+
+#include "deadline_timer.hpp"
+#include "io_service.hpp"
+
+#include <functional>
+#include <memory>
+
+class AsyncCompletion;
+typedef std::shared_ptr<AsyncCompletion> async_completion_ptr;
+typedef std::weak_ptr<AsyncCompletion> async_completion_wptr;
+
+/**
+ * @class AsyncCompletion
+ * @author Michael Griffin
+ * @date 17/10/2026
+ * @file async_completion.hpp
+ * @brief Handle to Work run on a Worker Thread, the requester keeps it while waiting.
+ *        The result is posted back as a timer callback, so it executes on the
+ *        IOService thread of the requesting session.
+ *        Dropping the handle or calling cancel() means the completion is never executed.
+ *        The completion is only touched on the IOService thread.
+ */
+class AsyncCompletion
+{
+public:
+
+    explicit AsyncCompletion(IOService &io_service)
+        : m_completion(nullptr)
+        , m_timer(io_service)
+    { }
+
+    virtual ~AsyncCompletion()
+    { }
+
+    /**
+     * @brief Cancel the completion, call from the IOService thread.
+     */
+    void cancel()
+    {
+        m_completion = nullptr;
+        m_timer.cancel();
+    }
+
+    /**
+     * @brief Post the Completion to the IOService, call from the Worker once done.
+     *        Only a weak handle is passed, the requester owns the request.
+     * @param request
+     */
+    static void post(async_completion_ptr request)
+    {
+        async_completion_wptr weak_request = request;
+        request->m_timer.setWaitInMilliseconds(0);
+        request->m_timer.asyncWait([weak_request](int)
+        {
+            async_completion_ptr request = weak_request.lock();
+            if (request && request->m_completion)
+            {
+                std::function<void()> completion = std::move(request->m_completion);
+                request->m_completion = nullptr;
+                completion();
+            }
+        });
+    }
+
+    std::function<void()> m_completion;
+    DeadlineTimer         m_timer;
+};
+
+#endif // ASYNC_COMPLETION_HPP
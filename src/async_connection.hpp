@@ -44,17 +44,35 @@ public:
 
     /**
      * @brief Async Write Callback for IOService Work
+     *        Writes are queued on the socket, only the first write since the
+     *        last flush adds a job, later writes are sent along with it.
      * @param StringSequence - Data to Pass to Socket
      * @param Callback - returns error code
      */
     template <typename StringSequence, typename Callback>
     void asyncWrite(StringSequence string_seq, const Callback &callback)
+    {
+        if(!m_socket_handler->queueOutput(std::move(string_seq)))
+        {
+            return;
+        }
+
+        asyncFlush(callback);
+    }
+
+    /**
+     * @brief Async Flush of Output already queued on the Socket
+     * @param Callback - returns error code
+     */
+    template <typename Callback>
+    void asyncFlush(const Callback &callback)
     {
         // Place Holder is used for template parmeters, string_seq is used in writes
         // Where the Buffer Place Holder in the above method is used for reads.
         // nullptr can't be passed as reference for vector
         std::vector<unsigned char> place_holder;
-        m_io_service.addAsyncJob(place_holder, string_seq, m_socket_handler, callback, SERVICE_TYPE_WRITE);
+        std::string flush_place_holder;
+        m_io_service.addAsyncJob(place_holder, flush_place_holder, m_socket_handler, callback, SERVICE_TYPE_WRITE);
     }
 
     /**
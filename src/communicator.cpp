@@ -38,4 +38,21 @@ Communicator::Communicator()
 Communicator::~Communicator()
 {
     std::cout << "~Communicator" << std::endl;
+
+    // Sessions may still hold the writer, flush and join the thread now.
+    if(m_stats_writer)
+    {
+        m_stats_writer->shutdown();
+    }
+
+    if(m_password_hasher)
+    {
+        m_password_hasher->shutdown();
+    }
+
+    // Queued writes are finished before the threads exit.
+    if(m_user_database_executor)
+    {
+        m_user_database_executor->shutdown();
+    }
 }
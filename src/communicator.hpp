@@ -8,11 +8,18 @@
 #include "safe_queue.hpp"
 #include "session_manager.hpp"
 #include "common_io.hpp"
+#include "stats_writer.hpp"
+#include "password_hasher.hpp"
+#include "database_executor.hpp"
+#include "node_allocator.hpp"
+
+#include "libSqliteWrapped.h"
 
 #include <algorithm>
 #include <iostream>
 #include <string>
 #include <mutex>
+#include <memory>
 
 /**
  * @class Communicator
@@ -92,44 +99,24 @@ public:
     }
 
     /**
-     * @brief Searchs and picks first free node number not in use.
+     * @brief Picks the lowest free node number not in use.
      * @return
      */
     int getNodeNumber()
     {
         std::lock_guard<std::mutex> lock(m_node_mutex);
-        int node = 1;
-        while(1)
-        {
-            auto it = std::find(m_node_array.begin(), m_node_array.end(), node);
-            if(it != m_node_array.end())
-            {
-                // Found, try next.
-                ++node;
-            }
-            else
-            {
-                // Not Found, Use This
-                m_node_array.push_back(node);
-                return node;
-            }
-        }
+        return m_node_allocator.acquire();
     }
 
     /**
-     * @brief Removes a Node number from array on disconnect.
+     * @brief Returns a Node number for reuse on disconnect.
      * @param int_to_remove
      * @return
      */
     void freeNodeNumber(int int_to_remove)
     {
         std::lock_guard<std::mutex> lock(m_node_mutex);
-        auto it = std::find(m_node_array.begin(), m_node_array.end(), int_to_remove);
-        if (it != m_node_array.end())
-        {
-            std::swap(*it, m_node_array.back());
-            m_node_array.pop_back();
-        }
+        m_node_allocator.release(int_to_remove);
     }
 
     /**
@@ -178,6 +165,82 @@ public:
         m_text_prompts_dao->writeValue(value);
     }
 
+    /**
+     * @brief Shared Users Database Connection Pool, opened on first use.
+     *        Sessions borrow a connection per Query instead of each
+     *        opening their own handle to the same file.
+     * @return
+     */
+    SQLW::Database &getUserDatabase()
+    {
+        std::lock_guard<std::mutex> lock(m_database_mutex);
+        if(!m_user_database)
+        {
+            m_user_database.reset(new SQLW::Database(USERS_DATABASE, &m_database_log));
+            m_user_database->setMaxConnections(MAX_DATABASE_CONNECTIONS);
+            m_user_database->setConnectionPragmas(SQLW::Database::POOL_PRAGMAS);
+        }
+        return *m_user_database;
+    }
+
+    /**
+     * @brief Users Database Pool Occupancy
+     * @return
+     */
+    SQLW::Database::PoolStats getUserDatabaseStats()
+    {
+        return getUserDatabase().getPoolStats();
+    }
+
+    /**
+     * @brief Shared Write Behind for Session and Menu Stats, started on first use.
+     *        Sessions queue their stats here instead of writing them inline.
+     * @return
+     */
+    stats_writer_ptr getStatsWriter()
+    {
+        std::lock_guard<std::mutex> lock(m_database_mutex);
+        if(!m_stats_writer)
+        {
+            m_stats_writer.reset(new StatsWriter(USERS_DATABASE, STATS_FLUSH_INTERVAL,
+                                                 STATS_BATCH_SIZE, STATS_MAX_QUEUE));
+            m_stats_writer->start();
+        }
+        return m_stats_writer;
+    }
+
+    /**
+     * @brief Shared Password Verification Workers, started on first use.
+     *        Logons hash here instead of on their IOService thread.
+     * @return
+     */
+    password_hasher_ptr getPasswordHasher()
+    {
+        std::lock_guard<std::mutex> lock(m_database_mutex);
+        if(!m_password_hasher)
+        {
+            m_password_hasher.reset(new PasswordHasher(PASSWORD_HASH_WORKERS));
+            m_password_hasher->start();
+        }
+        return m_password_hasher;
+    }
+
+    /**
+     * @brief Shared Users Database Threads, started on first use.
+     *        Modules queue DAO calls here and continue from the callback.
+     * @return
+     */
+    database_executor_ptr getUserDatabaseExecutor()
+    {
+        std::lock_guard<std::mutex> lock(m_database_mutex);
+        if(!m_user_database_executor)
+        {
+            m_user_database_executor.reset(new DatabaseExecutor(USERS_DATABASE, DATABASE_EXECUTOR_THREADS));
+            m_user_database_executor->start();
+        }
+        return m_user_database_executor;
+    }
+
     /**
      * @brief Check if the System is Active
      * Used for io_service reloading
@@ -216,8 +279,28 @@ private:
     mutable std::mutex     m_data_mutex;
     mutable std::mutex     m_config_mutex;
     mutable std::mutex     m_prompt_mutex;
+    mutable std::mutex     m_database_mutex;
+
+    // Sessions share this, a connection per IO thread is plenty.
+    static const int       MAX_DATABASE_CONNECTIONS = 8;
+    SQLW::StderrLog        m_database_log;
+    std::unique_ptr<SQLW::Database> m_user_database;
+
+    // Stats are flushed each interval (ms) or once a batch is queued.
+    static const int       STATS_FLUSH_INTERVAL = 250;
+    static const int       STATS_BATCH_SIZE = 64;
+    static const int       STATS_MAX_QUEUE = 4096;
+    stats_writer_ptr       m_stats_writer;
+
+    // Concurrent logons each hold a worker for the length of one PBKDF2.
+    static const int       PASSWORD_HASH_WORKERS = 2;
+    password_hasher_ptr    m_password_hasher;
+
+    // SQLite takes one writer at a time, a single thread also keeps each session's writes in order.
+    static const int       DATABASE_EXECUTOR_THREADS = 1;
+    database_executor_ptr  m_user_database_executor;
 
-    std::vector<int>       m_node_array;
+    NodeAllocator          m_node_allocator;
     static Communicator*   m_global_instance;
     CommonIO               m_common_io;
     config_ptr             m_config;
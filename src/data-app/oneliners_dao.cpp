@@ -106,83 +106,21 @@ long OnelinerDao::getRecordsCount()
 }
 
 /**
- * Base Dao Call Back for Object Specific Data Mappings
+ * Column Descriptors for Typed Statements
  * (Below This Point)
  */
 
-     
-/**
- * @brief (CallBack) Pulls results by FieldNames into their Class Variables. 
- * @param qry
- * @param obj
- */
-void OnelinerDao::pullOnelinerResult(query_ptr qry, oneliner_ptr obj)
-{
-    qry->getFieldByName("iId", obj->iId);
-    qry->getFieldByName("iUserId", obj->iUserId);    
-    qry->getFieldByName("sText", obj->sText);
-    qry->getFieldByName("sUserName", obj->sUserName);
-    qry->getFieldByName("sUserInitials", obj->sUserInitials);
-    qry->getFieldByName("dtDatePosted", obj->dtDatePosted);
-}
 
-/**
- * @brief (Callback) for Insert Statement translates to (Column, .. ) VALUES (%d, %Q,)
- * @param qry
- * @param obj
- * @param values
- */ 
-void OnelinerDao::fillOnelinerColumnValues(query_ptr qry, oneliner_ptr obj, 
-    std::vector< std::pair<std::string, std::string> > &values)
+const DaoColumn<Oneliners> OnelinerDao::COLUMNS[] =
 {
-    // values.push_back(qry->translateFieldName("iId", conf->iId));
-    values.push_back(qry->translateFieldName("iUserId", obj->iUserId));
-    values.push_back(qry->translateFieldName("sText", obj->sText));
-    values.push_back(qry->translateFieldName("sUserName", obj->sUserName));
-    values.push_back(qry->translateFieldName("sUserInitials", obj->sUserInitials));
-    values.push_back(qry->translateFieldName("dtDatePosted", obj->dtDatePosted));
-}
+    DAO_COLUMN(Oneliners, iUserId),
+    DAO_COLUMN(Oneliners, sText),
+    DAO_COLUMN(Oneliners, sUserName),
+    DAO_COLUMN(Oneliners, sUserInitials),
+    DAO_COLUMN(Oneliners, dtDatePosted)
+};
 
-/**
- * @brief (Callback) Create Record Insert Statement, returns query string 
- * @param qry
- * @param obj
- * @return 
- */
-std::string OnelinerDao::insertOnelinerQryString(std::string qry, oneliner_ptr obj)
-{
-    // Mprint statement to avoid injections.
-    std::string result = sqlite3_mprintf(qry.c_str(),
-        obj->iUserId,
-        obj->sText.c_str(),
-        obj->sUserName.c_str(),
-        obj->sUserInitials.c_str(),
-        obj->dtDatePosted
-    );
-    
-    return result;
-}
-
-/**
- * @brief (CallBack) Update Existing Record. 
- * @param qry
- * @param obj
- * @return 
- */
-std::string OnelinerDao::updateOnelinerQryString(std::string qry, oneliner_ptr obj)
-{
-    // Mprint statement to avoid injections.
-    std::string result = sqlite3_mprintf(qry.c_str(),        
-        obj->iUserId,
-        obj->sText.c_str(),
-        obj->sUserName.c_str(),
-        obj->sUserInitials.c_str(),
-        obj->dtDatePosted,
-        obj->iId
-    );
-
-    return result;
-}
+const size_t OnelinerDao::COLUMN_COUNT = sizeof(OnelinerDao::COLUMNS) / sizeof(OnelinerDao::COLUMNS[0]);
 
 
 /**
@@ -215,11 +153,8 @@ std::vector<oneliner_ptr> OnelinerDao::getAllOnelinersByUserId(long userId)
         return list;
     }
 
-    // Build Query String
-    std::string queryString = sqlite3_mprintf("SELECT * FROM %Q WHERE iUserId = %ld;", m_strTableName.c_str(), userId);
-
     // Execute Query.
-    if (qry->getResult(queryString))
+    if (qry->prepare(baseSelectFrom() + " WHERE iUserId = ?;") && qry->bind(1, userId) && qry->getResult())
     {
         long rows = qry->getNumRows();
         if (rows > 0)
@@ -227,7 +162,7 @@ std::vector<oneliner_ptr> OnelinerDao::getAllOnelinersByUserId(long userId)
             while(qry->fetchRow())
             {
                 obj.reset(new Oneliners);
-                pullOnelinerResult(qry, obj);
+                basePullResult(qry, obj);
                 list.push_back(obj);
             }
         }
@@ -66,18 +66,8 @@ public:
         // CREATE INDEX `IDX_testtbl_Name` ON `testtbl` (`Name` COLLATE UTF8CI)
         m_cmdDropTable = "DROP TABLE IF EXISTS " + m_strTableName + "; ";
         
-        // Setup the CallBack for Result Field Mapping
-        m_result_callback = std::bind(&OnelinerDao::pullOnelinerResult, this, 
-            std::placeholders::_1, std::placeholders::_2);
-            
-        m_columns_callback = std::bind(&OnelinerDao::fillOnelinerColumnValues, this, 
-            std::placeholders::_1, std::placeholders::_2, std::placeholders::_3);
-            
-        m_insert_callback = std::bind(&OnelinerDao::insertOnelinerQryString, this, 
-            std::placeholders::_1, std::placeholders::_2);
-        
-        m_update_callback = std::bind(&OnelinerDao::updateOnelinerQryString, this, 
-            std::placeholders::_1, std::placeholders::_2);
+        // Typed Columns, Insert, Update and Select statements are generated once.
+        baseSetColumns(COLUMNS, COLUMN_COUNT);
     }
 
     ~OnelinerDao()
@@ -156,42 +146,16 @@ public:
     
     
     /**
-     * Base Dao Call Back for Object Specific Data Mappings
+     * Column Descriptors for Typed Statements
      * (Below This Point)
      */
-    
-    
-    /**
-     * @brief (CallBack) Pulls results by FieldNames into their Class Variables. 
-     * @param qry
-     * @param obj
-     */
-    void pullOnelinerResult(query_ptr qry, oneliner_ptr obj);
-    
-    /**
-     * @brief (CallBack) Insert Statement translates to (Column, .. ) VALUES (%d, %Q,)
-     * @param qry
-     * @param obj
-     * @param values
-     */ 
-    void fillOnelinerColumnValues(query_ptr qry, oneliner_ptr obj, 
-        std::vector< std::pair<std::string, std::string> > &values);
 
-    /**
-     * @brief (Callback) Create Record Insert Statement, returns query string 
-     * @param qry
-     * @param obj
-     * @return 
-     */
-    std::string insertOnelinerQryString(std::string qry, oneliner_ptr obj);
 
     /**
-     * @brief (CallBack) Update Existing Record. 
-     * @param qry
-     * @param obj
-     * @return 
+     * @brief Columns in Table order, iId is implied as the first column.
      */
-    std::string updateOnelinerQryString(std::string qry, oneliner_ptr obj);
+    static const DaoColumn<Oneliners> COLUMNS[];
+    static const size_t COLUMN_COUNT;
 
 
     /**
@@ -172,7 +172,7 @@ void AccessLevelDao::fillAccessLevelColumnValues(query_ptr qry, access_level_ptr
 std::string AccessLevelDao::insertAccessLevelQryString(std::string qry, access_level_ptr obj)
 {    
     // Mprint statement to avoid injections.
-    std::string result = sqlite3_mprintf(qry.c_str(),
+    std::string result = SQLW::Database::formatQuery(qry.c_str(),
         obj->sName.c_str(),
         obj->sStartMenu.c_str(),
         obj->iLevel,
@@ -200,7 +200,7 @@ std::string AccessLevelDao::insertAccessLevelQryString(std::string qry, access_l
 std::string AccessLevelDao::updateAccessLevelQryString(std::string qry, access_level_ptr obj)
 {
     // Mprint statement to avoid injections.
-    std::string result = sqlite3_mprintf(qry.c_str(),
+    std::string result = SQLW::Database::formatQuery(qry.c_str(),
         obj->sName.c_str(),
         obj->sStartMenu.c_str(),
         obj->iLevel,
@@ -8,11 +8,53 @@
 #include <memory>
 #include <functional>
 #include <vector>
+#include <sstream>
 
 
 // Handle to Database Queries
 typedef std::shared_ptr<SQLW::Query> query_ptr;
 
+/**
+ * @class DaoColumn
+ * @author Michael Griffin
+ * @date 17/10/2026
+ * @file base_dao.hpp
+ * @brief Compile time Column Descriptor, the Column Name with the Bind and Pull
+ *        for the Member it maps to. The Members type picks the Bind and Pull overloads.
+ */
+template <class T>
+struct DaoColumn
+{
+    const char *name;
+    bool (*bind)(SQLW::Query &qry, int index, const T &obj);
+    void (*pull)(SQLW::Query &qry, int index, T &obj);
+};
+
+/**
+ * @brief Bind and Pull generated for a Member Pointer.
+ */
+template <class T, class V, V T::*Member>
+struct DaoColumnAccess
+{
+    static bool bind(SQLW::Query &qry, int index, const T &obj)
+    {
+        return qry.bind(index, obj.*Member);
+    }
+
+    static void pull(SQLW::Query &qry, int index, T &obj)
+    {
+        qry.getFieldByIndex(index, obj.*Member);
+    }
+};
+
+/**
+ * @brief Declare a Column where the Column Name matches the Member Name.
+ */
+#define DAO_COLUMN(Class, Member) \
+    { #Member, \
+      &DaoColumnAccess<Class, decltype(Class::Member), &Class::Member>::bind, \
+      &DaoColumnAccess<Class, decltype(Class::Member), &Class::Member>::pull }
+
 /**
  * @class BaseDao
  * @author Michael Griffin
@@ -35,6 +77,11 @@ public:
         , m_cmdCreateIndex("")
         , m_cmdDropTable("")
         , m_cmdDropIndex("")
+        , m_cmdSelectColumns("")
+        , m_cmdInsertRecord("")
+        , m_cmdUpdateRecord("")
+        , m_columns(nullptr)
+        , m_columns_count(0)
     { }
         
     ~BaseDao()
@@ -52,6 +99,15 @@ public:
     std::string m_cmdCreateIndex;
     std::string m_cmdDropTable;
     std::string m_cmdDropIndex;
+
+    // Typed Column Statements, generated once from the Column Descriptors.
+    std::string m_cmdSelectColumns;
+    std::string m_cmdInsertRecord;
+    std::string m_cmdUpdateRecord;
+
+    // Column Descriptors, iId is implied as the first column.
+    const DaoColumn<T> *m_columns;
+    size_t              m_columns_count;
     
     // Dynamic Callbacks to Calling Class for Specific Object Mappings
     std::function<void(query_ptr qry, std::shared_ptr<T> obj)>          m_result_callback;
@@ -61,7 +117,85 @@ public:
     std::function<std::string(std::string qry, std::shared_ptr<T> obj)> m_insert_callback;
     std::function<std::string(std::string qry, std::shared_ptr<T> obj)> m_update_callback;
 
+    // Streamed Rows, the visitor returns false to stop reading.
+    typedef std::function<bool(std::shared_ptr<T> obj)> record_visitor;
+
+    // Binds the ? parameters of a streamed clause, starting at 1.
+    typedef std::function<bool(query_ptr qry)> clause_binder;
+
     
+    /**
+     * @brief Setup Column Descriptors, call once the Table Name is set.
+     *        Inserts, Updates and Selects become fixed parameterized statements
+     *        and results are pulled by column index instead of name.
+     * @param columns
+     * @param count
+     */
+    void baseSetColumns(const DaoColumn<T> *columns, size_t count)
+    {
+        m_columns = columns;
+        m_columns_count = count;
+
+        std::stringstream ssSelect;
+        std::stringstream ssInsert;
+        std::stringstream ssValues;
+        std::stringstream ssUpdate;
+
+        ssSelect << "SELECT iId";
+        ssInsert << "INSERT INTO " << m_strTableName << " (";
+        ssValues << ") VALUES (";
+        ssUpdate << "UPDATE " << m_strTableName << " SET ";
+
+        for (size_t i = 0; i < count; i++)
+        {
+            const char *separator = (i == 0) ? "" : ", ";
+            ssSelect << ", " << columns[i].name;
+            ssInsert << separator << columns[i].name;
+            ssValues << separator << "?";
+            ssUpdate << separator << columns[i].name << "=?";
+        }
+
+        ssSelect << " FROM " << m_strTableName;
+        ssValues << ");";
+        ssUpdate << " WHERE iId = ?;";
+
+        m_cmdSelectColumns = ssSelect.str();
+        m_cmdInsertRecord = ssInsert.str() + ssValues.str();
+        m_cmdUpdateRecord = ssUpdate.str();
+    }
+
+    /**
+     * @brief Start of a Select, lists the Typed Columns so they can be pulled by index.
+     * @return
+     */
+    std::string baseSelectFrom()
+    {
+        if (m_columns)
+        {
+            return m_cmdSelectColumns;
+        }
+        return "SELECT * FROM " + m_strTableName;
+    }
+
+    /**
+     * @brief Bind Typed Columns in Order, starting at parameter 1.
+     * @param qry
+     * @param obj
+     * @return
+     */
+    bool baseBindColumns(query_ptr qry, std::shared_ptr<T> obj)
+    {
+        for (size_t i = 0; i < m_columns_count; i++)
+        {
+            if (!m_columns[i].bind(*qry, static_cast<int>(i) + 1, *obj))
+            {
+                std::cout << "Error, unable to bind column " << m_columns[i].name << std::endl;
+                return false;
+            }
+        }
+        return true;
+    }
+
     /**
      * @brief Check if the Table Exists in Database
      * @return
@@ -170,6 +304,42 @@ public:
         return result;  
     }
 
+    /**
+     * @brief Create Indexes on an Existing Table
+     * Indexes use IF NOT EXISTS, so tables created by older versions pick up new ones.
+     */
+    bool baseCreateIndex()
+    {
+        bool result = false;
+
+        // Make Sure Database Reference is Connected
+        if (!m_database.isConnected())
+        {
+            std::cout << "Error, Database is not connected!" << std::endl;
+            return result;
+        }
+
+        // Create Pointer and Connect Query Object to Database.
+        query_ptr qry(new SQLW::Query(m_database));
+        if (!qry || !qry->isConnected())
+        {
+            std::cout << "Error, Query has no connection to the database" << std::endl;
+            return result;
+        }
+
+        if (m_cmdCreateIndex.size() == 0)
+        {
+            return true;
+        }
+
+        std::vector<std::string> statements;
+        statements.push_back(m_cmdCreateIndex);
+
+        // Execute Transaction.
+        result = qry->executeTransaction(statements);
+        return result;
+    }
+
     /**
      * @brief Drop Table
      */
@@ -211,7 +381,17 @@ public:
      * @param one
      */
     void basePullResult(query_ptr qry, std::shared_ptr<T> obj)
-    {    
+    {
+        if (m_columns)
+        {
+            // Results from baseSelectFrom(), iId then each column in order.
+            qry->getFieldByIndex(0, obj->iId);
+            for (size_t i = 0; i < m_columns_count; i++)
+            {
+                m_columns[i].pull(*qry, static_cast<int>(i) + 1, *obj);
+            }
+            return;
+        }
         m_result_callback(qry, obj);
     }
 
@@ -340,6 +520,17 @@ public:
             return result;
         }
 
+        // Typed Columns, the same statement is reused with new bindings.
+        if (m_columns)
+        {
+            if (qry->prepare(m_cmdUpdateRecord) && baseBindColumns(qry, obj)
+                    && qry->bind(static_cast<int>(m_columns_count) + 1, obj->iId))
+            {
+                result = qry->execute();
+            }
+            return result;
+        }
+
         // Build update string
         std::string queryString = baseUpdateQryString(qry, obj);
 
@@ -376,13 +567,24 @@ public:
             return result;
         }
 
-        // Build update string
-        std::string queryString = baseInsertQryString(qry, obj);
+        if (m_columns)
+        {
+            // Typed Columns, the same statement is reused with new bindings.
+            if (qry->prepare(m_cmdInsertRecord) && baseBindColumns(qry, obj))
+            {
+                result = qry->execute();
+            }
+        }
+        else
+        {
+            // Build update string
+            std::string queryString = baseInsertQryString(qry, obj);
 
-        // Execute Update in a Transaction, rollback if fails.
-        std::vector<std::string> statements;
-        statements.push_back(queryString);
-        result = qry->executeTransaction(statements);
+            // Execute Update in a Transaction, rollback if fails.
+            std::vector<std::string> statements;
+            statements.push_back(queryString);
+            result = qry->executeTransaction(statements);
+        }
 
         // We need the insert id for table
         if (result)
@@ -417,13 +619,12 @@ public:
             return result;
         }
 
-        // Build string
-        std::string queryString = sqlite3_mprintf("DELETE FROM %Q WHERE iId = %ld;", m_strTableName.c_str(), id);
-
-        // Execute Update in a Transaction, rollback if fails.
-        std::vector<std::string> statements;
-        statements.push_back(queryString);
-        result = qry->executeTransaction(statements);
+        // Single statement, reused from the connection's statement cache.
+        if (qry->prepare("DELETE FROM " + m_strTableName + " WHERE iId = ?;"))
+        {
+            qry->bind(1, id);
+            result = qry->execute();
+        }
 
         return result;
     }
@@ -452,11 +653,9 @@ public:
             return obj;
         }
 
-        // Build Query String
-        std::string queryString = sqlite3_mprintf("SELECT * FROM %Q WHERE iID = %ld;", m_strTableName.c_str(), id);
-
-        // Execute Query.
-        if (qry->getResult(queryString))
+        // Prepared once per connection, then only the id is bound.
+        if (qry->prepare(baseSelectFrom() + " WHERE iId = ?;") && qry->bind(1, id)
+                && qry->getResult())
         {
             long rows = qry->getNumRows();
             if (rows > 0)
@@ -478,19 +677,20 @@ public:
     }
 
     /**
-     * @brief Retrieve All Records in a Table
-     * @return
+     * @brief Streams Records to a Visitor one row at a time, nothing is held in memory.
+     *        The same object is reused for every row, copy it to keep it.
+     * @param clause  WHERE / ORDER BY / LIMIT following the FROM, may hold ? parameters.
+     * @param binder  Binds the clause parameters, can be empty.
+     * @param visitor Return false to stop early.
+     * @return Rows Visited, -1 on error.
      */
-    std::vector< std::shared_ptr<T> > baseGetAllRecords()
+    long baseStreamRecords(const std::string &clause, clause_binder binder, record_visitor visitor)
     {
-        std::shared_ptr<T> obj(new T);
-        std::vector<std::shared_ptr<T>> list;
-
         // Make Sure Database Reference is Connected
         if (!m_database.isConnected())
         {
             std::cout << "Error, Database is not connected!" << std::endl;
-            return list;
+            return -1;
         }
 
         // Create Pointer and Connect Query Object to Database.
@@ -498,52 +698,91 @@ public:
         if (!qry->isConnected())
         {
             std::cout << "Error, Query has no connection to the database" << std::endl;
-            return list;
+            return -1;
         }
 
-        // Build Query String
-        std::string queryString = sqlite3_mprintf("SELECT * FROM %Q;", m_strTableName.c_str());
-
-        // Execute Query.
-        if (qry->getResult(queryString))
+        std::string queryString = baseSelectFrom();
+        if (clause.size() > 0)
         {
-            long rows = qry->getNumRows();
-            if (rows > 0)
-            {
-                while(qry->fetchRow())
-                {
-                    obj.reset(new T);
-                    basePullResult(qry, obj);
-                    list.push_back(obj);
-                }
-            }
-            else
-            {
-                std::cout << "Error, getAllOnelinerss Returned Rows: " << rows << std::endl;
-            }
+            queryString += " " + clause;
         }
-        else
+        queryString += ";";
+
+        if (!qry->prepare(queryString) || (binder && !binder(qry)) || !qry->getResult())
         {
             std::cout << "Error, getResult()" << std::endl;
+            return -1;
         }
 
-        return list;
+        long visited = 0;
+        std::shared_ptr<T> obj(new T);
+        while(qry->fetchRow())
+        {
+            // Reset the object, columns with NULL keep their defaults.
+            *obj = T();
+            basePullResult(qry, obj);
+            ++visited;
+            if (!visitor(obj))
+            {
+                break;
+            }
+        }
+
+        return visited;
     }
-    
+
     /**
-     * @brief Retrieve Count of All Records in a Table
-     * @return
+     * @brief Streams a Page of Records, LIMIT and OFFSET are bound after the clause parameters.
+     * @param clause  WHERE / ORDER BY, should give a stable order.
+     * @param binder
+     * @param limit
+     * @param offset
+     * @param visitor
+     * @return Rows Visited, -1 on error.
      */
-    long baseGetRecordsCount()
+    long baseStreamRecordsPage(const std::string &clause, clause_binder binder, long limit, long offset,
+                               record_visitor visitor)
     {
-        std::shared_ptr<T> obj(new T);
-        std::vector<std::shared_ptr<T>> list;
+        return baseStreamRecords(clause + " LIMIT ? OFFSET ?",
+                                 [binder, limit, offset](query_ptr qry)
+        {
+            int count = qry->getBindParameterCount();
+            return (!binder || binder(qry)) && qry->bind(count - 1, limit) && qry->bind(count, offset);
+        },
+        visitor);
+    }
+
+    /**
+     * @brief Streams Records after an Id (Keyset Pagination), pages don't slow down
+     *        the further in they are like OFFSET does. Pass the last Id of the previous page.
+     * @param after_id
+     * @param limit
+     * @param visitor
+     * @return Rows Visited, -1 on error.
+     */
+    long baseStreamRecordsAfterId(long after_id, long limit, record_visitor visitor)
+    {
+        return baseStreamRecords("WHERE iId > ? ORDER BY iId LIMIT ?",
+                                 [after_id, limit](query_ptr qry)
+        {
+            return qry->bind(1, after_id) && qry->bind(2, limit);
+        },
+        visitor);
+    }
 
+    /**
+     * @brief Count Records matching a clause without reading them.
+     * @param clause WHERE following the FROM, may hold ? parameters.
+     * @param binder
+     * @return Count, -1 on error.
+     */
+    long baseCountRecords(const std::string &clause, clause_binder binder)
+    {
         // Make Sure Database Reference is Connected
         if (!m_database.isConnected())
         {
             std::cout << "Error, Database is not connected!" << std::endl;
-            return list.size();
+            return -1;
         }
 
         // Create Pointer and Connect Query Object to Database.
@@ -551,36 +790,53 @@ public:
         if (!qry->isConnected())
         {
             std::cout << "Error, Query has no connection to the database" << std::endl;
-            return list.size();
+            return -1;
         }
 
-        // Build Query String
-        std::string queryString = sqlite3_mprintf("SELECT * FROM %Q;", m_strTableName.c_str());
+        std::string queryString = "SELECT COUNT(*) FROM " + m_strTableName;
+        if (clause.size() > 0)
+        {
+            queryString += " " + clause;
+        }
+        queryString += ";";
 
-        // Execute Query.
-        if (qry->getResult(queryString))
+        long count = -1;
+        if (qry->prepare(queryString) && (!binder || binder(qry)) && qry->getResult() && qry->fetchRow())
         {
-            long rows = qry->getNumRows();
-            if (rows > 0)
-            {
-                while(qry->fetchRow())
-                {
-                    obj.reset(new T);
-                    basePullResult(qry, obj);
-                    list.push_back(obj);
-                }
-            }
-            else
-            {
-                std::cout << "Error, getAllOnelinerss Returned Rows: " << rows << std::endl;
-            }
+            count = qry->getValue(0);
         }
         else
         {
             std::cout << "Error, getResult()" << std::endl;
         }
 
-        return list.size();
+        return count;
+    }
+
+    /**
+     * @brief Retrieve All Records in a Table
+     * @return
+     */
+    std::vector< std::shared_ptr<T> > baseGetAllRecords()
+    {
+        std::vector<std::shared_ptr<T>> list;
+        baseStreamRecords("", nullptr, [&list](std::shared_ptr<T> obj)
+        {
+            list.push_back(std::shared_ptr<T>(new T(*obj)));
+            return true;
+        });
+
+        return list;
+    }
+    
+    /**
+     * @brief Retrieve Count of All Records in a Table
+     * @return
+     */
+    long baseGetRecordsCount()
+    {
+        long count = baseCountRecords("", nullptr);
+        return (count < 0) ? 0 : count;
     }
 
 };
@@ -153,7 +153,7 @@ void ConferenceDao::fillConferenceColumnValues(query_ptr qry, conference_ptr obj
 std::string ConferenceDao::insertConferenceQryString(std::string qry, conference_ptr obj)
 {
     // Mprint statement to avoid injections.
-    std::string result = sqlite3_mprintf(qry.c_str(),
+    std::string result = SQLW::Database::formatQuery(qry.c_str(),
         obj->sName.c_str(),
         obj->sType.c_str(),
         obj->sACS.c_str(),
@@ -172,7 +172,7 @@ std::string ConferenceDao::insertConferenceQryString(std::string qry, conference
 std::string ConferenceDao::updateConferenceQryString(std::string qry, conference_ptr obj)
 {
     // Mprint statement to avoid injections.
-    std::string result = sqlite3_mprintf(qry.c_str(),        
+    std::string result = SQLW::Database::formatQuery(qry.c_str(),        
         obj->sName.c_str(),
         obj->sType.c_str(),
         obj->sACS.c_str(),
@@ -216,7 +216,7 @@ std::vector<conference_ptr> ConferenceDao::getAllConferencesByType(std::string t
     }
 
     // Build Query String
-    std::string queryString = sqlite3_mprintf("SELECT * FROM %Q WHERE sType like %Q;", m_strTableName.c_str(), type.c_str());
+    std::string queryString = SQLW::Database::formatQuery("SELECT * FROM %Q WHERE sType like %Q;", m_strTableName.c_str(), type.c_str());
 
     // Execute Query.
     if (qry->getResult(queryString))
@@ -270,7 +270,7 @@ long ConferenceDao::getConferencesCountByType(std::string type)
     }
 
     // Build Query String
-    std::string queryString = sqlite3_mprintf("SELECT * FROM %Q WHERE sType like %Q;", m_strTableName.c_str(), type.c_str());
+    std::string queryString = SQLW::Database::formatQuery("SELECT * FROM %Q WHERE sType like %Q;", m_strTableName.c_str(), type.c_str());
 
     // Execute Query.
     if (qry->getResult(queryString))
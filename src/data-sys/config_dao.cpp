@@ -8,7 +8,7 @@
 #include <cassert>
 
 // Setup the file version for the config file.
-const std::string Config::FILE_VERSION = "1.0.3";
+const std::string Config::FILE_VERSION = "1.1.0";
 
 
 ConfigDao::ConfigDao(config_ptr config, std::string path)
@@ -73,6 +73,16 @@ bool ConfigDao::saveConfig(config_ptr cfg)
     out << YAML::Key << "port_ssl" << YAML::Value << cfg->port_ssl;
     out << YAML::Key << "use_service_telnet" << YAML::Value << cfg->use_service_telnet;
     out << YAML::Key << "use_service_ssl" << YAML::Value << cfg->use_service_ssl;
+    out << YAML::Key << "use_native_sockets" << YAML::Value << cfg->use_native_sockets;
+    out << YAML::Key << "use_io_uring" << YAML::Value << cfg->use_io_uring;
+    out << YAML::Key << "io_service_threads" << YAML::Value << cfg->io_service_threads;
+    out << YAML::Key << "output_buffer_high_water" << YAML::Value << cfg->output_buffer_high_water;
+    out << YAML::Key << "output_buffer_low_water" << YAML::Value << cfg->output_buffer_low_water;
+    out << YAML::Key << "max_nodes" << YAML::Value << cfg->max_nodes;
+    out << YAML::Key << "max_connections_per_address" << YAML::Value << cfg->max_connections_per_address;
+    out << YAML::Key << "max_connections_per_minute" << YAML::Value << cfg->max_connections_per_minute;
+    out << YAML::Key << "password_hash_iterations" << YAML::Value << cfg->password_hash_iterations;
+    out << YAML::Key << "telnet_compression_level" << YAML::Value << cfg->telnet_compression_level;
     out << YAML::Key << "directory_screens" << YAML::Value << cfg->directory_screens;
     out << YAML::Key << "directory_boards" << YAML::Value << cfg->directory_boards;
     out << YAML::Key << "directory_files" << YAML::Value << cfg->directory_files;
@@ -210,6 +220,16 @@ void ConfigDao::encode(const Config &rhs)
     m_config->port_ssl = rhs.port_ssl;
     m_config->use_service_telnet = rhs.use_service_telnet;
     m_config->use_service_ssl = rhs.use_service_ssl;
+    m_config->use_native_sockets = rhs.use_native_sockets;
+    m_config->use_io_uring = rhs.use_io_uring;
+    m_config->io_service_threads = rhs.io_service_threads;
+    m_config->output_buffer_high_water = rhs.output_buffer_high_water;
+    m_config->output_buffer_low_water = rhs.output_buffer_low_water;
+    m_config->max_nodes = rhs.max_nodes;
+    m_config->max_connections_per_address = rhs.max_connections_per_address;
+    m_config->max_connections_per_minute = rhs.max_connections_per_minute;
+    m_config->password_hash_iterations = rhs.password_hash_iterations;
+    m_config->telnet_compression_level = rhs.telnet_compression_level;
     m_config->directory_screens = rhs.directory_screens;
     m_config->directory_boards = rhs.directory_boards;
     m_config->directory_files = rhs.directory_files;
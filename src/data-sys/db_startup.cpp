@@ -11,6 +11,8 @@
 // Needed for Initializing and checking users data is setup
 // On startup.
 #include "session_stats_dao.hpp"
+#include "menu_stats_dao.hpp"
+#include "session_stats_daily_dao.hpp"
 #include "security_dao.hpp"
 #include "users_dao.hpp"
 
@@ -99,6 +101,9 @@ void DbStartup::initDatabaseTables()
             std::cout << "user table created successfully." << std::endl;
         }
 
+        // Logon and Signup lookups are answered from memory from here on.
+        user_dao.loadUserDirectory();
+
         // Check Table setup for Session Stats
         SessionStatsDao session_stat_dao(user_database);
         // Verify if the user table exists.
@@ -122,6 +127,58 @@ void DbStartup::initDatabaseTables()
 
             std::cout << "sessionstats table created successfully." << std::endl;
         }
+        else
+        {
+            // Older tables pick up new columns and the time range indexes.
+            if (!session_stat_dao.upgradeTable())
+            {
+                std::cout << "unable to add columns (sessionstats table)." << std::endl;
+            }
+
+            if (!session_stat_dao.createIndex())
+            {
+                std::cout << "unable to create indexes (sessionstats table)." << std::endl;
+            }
+        }
+
+        // Check Table setup for Daily Session Stats, backfilled from sessionstats.
+        SessionStatsDailyDao session_stat_daily_dao(user_database);
+        if (!session_stat_daily_dao.doesTableExist())
+        {
+            std::cout << "doesn't exist (sessionstatsdaily table)." << std::endl;
+
+            // Setup create daily stats table and triggers.
+            if (!session_stat_daily_dao.createTable())
+            {
+                std::cout << "unable to create (sessionstatsdaily table)." << std::endl;
+                assert(false);
+            }
+
+            std::cout << "sessionstatsdaily table created successfully." << std::endl;
+        }
+
+        // Check Table setup for Menu Stats
+        MenuStatsDao menu_stat_dao(user_database);
+        if (!menu_stat_dao.doesTableExist())
+        {
+            std::cout << "doesn't exist (menustats table)." << std::endl;
+
+            // Setup database Param, cache sies etc..
+            if (!menu_stat_dao.firstTimeSetupParams())
+            {
+                std::cout << "unable to execute firstTimeSetupParams (menustats table)." << std::endl;
+                assert(false);
+            }
+
+            // Setup create menu stats table and indexes.
+            if (!menu_stat_dao.createTable())
+            {
+                std::cout << "unable to create (menustats table)." << std::endl;
+                assert(false);
+            }
+
+            std::cout << "menustats table created successfully." << std::endl;
+        }
 
         
 
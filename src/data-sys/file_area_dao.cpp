@@ -168,7 +168,7 @@ void FileAreaDao::fillFileAreaColumnValues(query_ptr qry, file_area_ptr obj,
 std::string FileAreaDao::insertFileAreaQryString(std::string qry, file_area_ptr obj)
 {
     // Mprint statement to avoid injections.
-    std::string result = sqlite3_mprintf(qry.c_str(),
+    std::string result = SQLW::Database::formatQuery(qry.c_str(),
         obj->sName.c_str(),
         obj->sAcsAccess.c_str(),
         obj->sAcsUpload.c_str(),
@@ -195,7 +195,7 @@ std::string FileAreaDao::insertFileAreaQryString(std::string qry, file_area_ptr
 std::string FileAreaDao::updateFileAreaQryString(std::string qry, file_area_ptr obj)
 {    
     // Mprint statement to avoid injections.
-    std::string result = sqlite3_mprintf(qry.c_str(),        
+    std::string result = SQLW::Database::formatQuery(qry.c_str(),        
         obj->sName.c_str(),
         obj->sAcsAccess.c_str(),
         obj->sAcsUpload.c_str(),
@@ -247,7 +247,7 @@ std::vector<file_area_ptr> FileAreaDao::getAllFileAreasByConference(long id)
     }
 
     // Build Query String
-    std::string queryString = sqlite3_mprintf("SELECT a.* FROM %Q a, Grouping g WHERE g.iConferenceId = %ld AND a.iID = g.iFileAreaId;", m_strTableName.c_str(), id);
+    std::string queryString = SQLW::Database::formatQuery("SELECT a.* FROM %Q a, Grouping g WHERE g.iConferenceId = %ld AND a.iID = g.iFileAreaId;", m_strTableName.c_str(), id);
 
     // Execute Query.
     if (qry->getResult(queryString))
@@ -149,7 +149,7 @@ void GroupingDao::fillGroupingColumnValues(query_ptr qry, group_ptr obj,
 std::string GroupingDao::insertGroupingQryString(std::string qry, group_ptr obj)
 {    
     // Mprint statement to avoid injections.
-    std::string result = sqlite3_mprintf(qry.c_str(),
+    std::string result = SQLW::Database::formatQuery(qry.c_str(),
         obj->iConferenceId,
         obj->iAreaId
     );
@@ -166,7 +166,7 @@ std::string GroupingDao::insertGroupingQryString(std::string qry, group_ptr obj)
 std::string GroupingDao::updateGroupingQryString(std::string qry, group_ptr obj)
 {
     // Mprint statement to avoid injections.
-    std::string result = sqlite3_mprintf(qry.c_str(),
+    std::string result = SQLW::Database::formatQuery(qry.c_str(),
         obj->iConferenceId,
         obj->iAreaId,
         obj->iId
@@ -207,7 +207,7 @@ std::vector<group_ptr> GroupingDao::getAllGroupingsByConferenceId(long id)
     }
 
     // Build Query String
-    std::string queryString = sqlite3_mprintf("SELECT * FROM %Q WHERE iConferenceId = %ld;", m_strTableName.c_str(), id);
+    std::string queryString = SQLW::Database::formatQuery("SELECT * FROM %Q WHERE iConferenceId = %ld;", m_strTableName.c_str(), id);
 
     // Execute Query.
     if (qry->getResult(queryString))
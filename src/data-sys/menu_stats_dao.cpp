@@ -1,10 +1,122 @@
 #include "menu_stats_dao.hpp"
+#include "../model-sys/menu_stats.hpp"
 
-menu_stats_dao::menu_stats_dao()
+#include "libSqliteWrapped.h"
+#include <sqlite3.h>
+
+#include <iostream>
+#include <string>
+
+/**
+ * Base Dao Calls for generic Object Data Calls
+ * (Below This Point)
+ */
+
+/**
+ * @brief Check If Database Table Exists.
+ * @return
+ */
+bool MenuStatsDao::doesTableExist()
+{
+    return baseDoesTableExist();
+}
+
+/**
+ * @brief Run Setup Params for SQL Database Table.
+ */
+bool MenuStatsDao::firstTimeSetupParams()
+{
+    return baseFirstTimeSetupParams();
+}
+
+/**
+ * @brief Create Database Table
+ * @return
+ */
+bool MenuStatsDao::createTable()
+{
+    return baseCreateTable();
+}
+
+/**
+ * @brief Drop Database
+ * @return
+ */
+bool MenuStatsDao::dropTable()
+{
+    return baseDropTable();
+}
+
+/**
+ * @brief Updates a Record in the database!
+ * @param obj
+ * @return
+ */
+bool MenuStatsDao::updateRecord(menu_stats_ptr obj)
+{
+    return baseUpdateRecord(obj);
+}
+
+/**
+ * @brief Inserts a New Record in the database!
+ * @param obj
+ * @return
+ */
+long MenuStatsDao::insertRecord(menu_stats_ptr obj)
+{
+    return baseInsertRecord(obj);
+}
+
+/**
+ * @brief Deletes a Record
+ * @param id
+ * @return
+ */
+bool MenuStatsDao::deleteRecord(long id)
+{
+    return baseDeleteRecord(id);
+}
+
+/**
+ * @brief Retrieve Record By Id.
+ * @param id
+ * @return
+ */
+menu_stats_ptr MenuStatsDao::getRecordById(long id)
 {
+    return baseGetRecordById(id);
 }
 
-menu_stats_dao::~menu_stats_dao()
+/**
+ * @brief Retrieve All Records in a Table
+ * @return
+ */
+std::vector<menu_stats_ptr> MenuStatsDao::getAllRecords()
 {
+    return baseGetAllRecords();
 }
 
+/**
+ * @brief Retrieve Count of All Records in a Table
+ * @return
+ */
+long MenuStatsDao::getRecordsCount()
+{
+    return baseGetRecordsCount();
+}
+
+
+/**
+ * Column Descriptors for Typed Statements
+ * (Below This Point)
+ */
+
+
+const DaoColumn<MenuStats> MenuStatsDao::COLUMNS[] =
+{
+    DAO_COLUMN(MenuStats, sMenuName),
+    DAO_COLUMN(MenuStats, sCmdKey),
+    DAO_COLUMN(MenuStats, dtDateTime)
+};
+
+const size_t MenuStatsDao::COLUMN_COUNT = sizeof(MenuStatsDao::COLUMNS) / sizeof(MenuStatsDao::COLUMNS[0]);
@@ -1,20 +1,166 @@
 #ifndef MENU_STATS_DAO_HPP
 #define MENU_STATS_DAO_HPP
 
+#include "../model-sys/menu_stats.hpp"
+#include "../data-sys/base_dao.hpp"
+
+#include <memory>
+#include <vector>
+
+// Forward Declerations
+namespace SQLW
+{
+class Database;
+class Query;
+}
+
+// Handle to Database Queries
+typedef std::shared_ptr<SQLW::Query> query_ptr;
+
+// Base Dao Definition
+typedef BaseDao<MenuStats> baseMenuStatsClass;
+
 /**
- * @class menu_stats_dao
+ * @class MenuStatsDao
  * @author Michael Griffin
  * @date 15/05/2017
  * @file menu_stats_dao.hpp
  * @brief Track Menu Traffic and Command Usage
  */
-class menu_stats_dao
+class MenuStatsDao
+    : public baseMenuStatsClass
 {
 public:
-    
-    explicit menu_stats_dao();
-    ~menu_stats_dao();
+
+    explicit MenuStatsDao(SQLW::Database &database)
+        : baseMenuStatsClass(database)
+    {
+        // Setup Table name
+        m_strTableName = "menustats";
+
+        /**
+         * Pre Popluate Static Queries one Time
+         */
+        m_cmdFirstTimeSetup =
+            "PRAGMA synchronous=Normal; "
+            "PRAGMA encoding=UTF-8; "
+            "PRAGMA foreign_keys=ON; "
+            "PRAGMA default_cache_size=10000; "
+            "PRAGMA cache_size=10000; ";
+
+        // Check if Database Exists.
+        m_cmdTableExists = "SELECT name FROM sqlite_master WHERE type='table' AND name='" + m_strTableName + "' COLLATE NOCASE;";
+
+        // Create Table Query (SQLite Only for the moment)
+        m_cmdCreateTable =
+            "CREATE TABLE IF NOT EXISTS " + m_strTableName + " ( "
+            "iId               INTEGER PRIMARY KEY, "
+            "sMenuName         TEXT NOT NULL COLLATE NOCASE, "
+            "sCmdKey           TEXT NOT NULL, "
+            "dtDateTime        DATETIME NOT NULL "
+            "); ";
+
+        m_cmdCreateIndex =
+            "CREATE INDEX IF NOT EXISTS menu_stats_idx "
+            "ON " + m_strTableName + " (sMenuName); ";
+
+        m_cmdDropTable = "DROP TABLE IF EXISTS " + m_strTableName + "; ";
+        m_cmdDropIndex = "DROP INDEX IF EXISTS menu_stats_idx; ";
+
+        // Typed Columns, Insert, Update and Select statements are generated once.
+        baseSetColumns(COLUMNS, COLUMN_COUNT);
+    }
+
+    ~MenuStatsDao()
+    {
+    }
+
+
+    /**
+     * Base Dao Calls for generic Object Data Calls
+     * (Below This Point)
+     */
+
+
+    /**
+     * @brief Check If Database Table Exists.
+     * @return
+     */
+    bool doesTableExist();
+
+    /**
+     * @brief Run Setup Params for SQL Database Table.
+     */
+    bool firstTimeSetupParams();
+
+    /**
+     * @brief Create Database Table
+     * @return
+     */
+    bool createTable();
+
+    /**
+     * @brief Drop Database
+     * @return
+     */
+    bool dropTable();
+
+    /**
+     * @brief Updates a Record in the database!
+     * @param obj
+     * @return
+     */
+    bool updateRecord(menu_stats_ptr obj);
+
+    /**
+     * @brief Inserts a New Record in the database!
+     * @param obj
+     * @return
+     */
+    long insertRecord(menu_stats_ptr obj);
+
+    /**
+     * @brief Deletes a Record
+     * @param id
+     * @return
+     */
+    bool deleteRecord(long id);
+
+    /**
+     * @brief Retrieve Record By Id.
+     * @param id
+     * @return
+     */
+    menu_stats_ptr getRecordById(long id);
+
+    /**
+     * @brief Retrieve All Records in a Table
+     * @return
+     */
+    std::vector<menu_stats_ptr> getAllRecords();
+
+    /**
+     * @brief Retrieve Count of All Records in a Table
+     * @return
+     */
+    long getRecordsCount();
+
+
+    /**
+     * Column Descriptors for Typed Statements
+     * (Below This Point)
+     */
+
+
+    /**
+     * @brief Columns in Table order, iId is implied as the first column.
+     */
+    static const DaoColumn<MenuStats> COLUMNS[];
+    static const size_t COLUMN_COUNT;
 
 };
 
+// Handle to Database Queries
+typedef std::shared_ptr<MenuStatsDao> menu_stats_dao_ptr;
+
 #endif // MENU_STATS_DAO_HPP
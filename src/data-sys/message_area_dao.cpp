@@ -175,7 +175,7 @@ void MessageAreaDao::fillMessageAreaColumnValues(query_ptr qry, message_area_ptr
 std::string MessageAreaDao::insertMessageAreaQryString(std::string qry, message_area_ptr obj)
 {    
     // Mprint statement to avoid injections.
-    std::string result = sqlite3_mprintf(qry.c_str(),
+    std::string result = SQLW::Database::formatQuery(qry.c_str(),
         obj->sName.c_str(),
         obj->sAcsAccess.c_str(),
         obj->sAcsPost.c_str(),
@@ -206,7 +206,7 @@ std::string MessageAreaDao::insertMessageAreaQryString(std::string qry, message_
 std::string MessageAreaDao::updateMessageAreaQryString(std::string qry, message_area_ptr obj)
 {    
     // Mprint statement to avoid injections.
-    std::string result = sqlite3_mprintf(qry.c_str(),        
+    std::string result = SQLW::Database::formatQuery(qry.c_str(),        
         obj->sName.c_str(),
         obj->sAcsAccess.c_str(),
         obj->sAcsPost.c_str(),
@@ -262,7 +262,7 @@ std::vector<message_area_ptr> MessageAreaDao::getAllMessageAreasByConference(lon
     }
 
     // Build Query String
-    std::string queryString = sqlite3_mprintf("SELECT a.* FROM %Q a, Grouping g WHERE g.iConferenceId = %ld AND a.iID = g.iMsgAreaId;", m_strTableName.c_str(), id);
+    std::string queryString = SQLW::Database::formatQuery("SELECT a.* FROM %Q a, Grouping g WHERE g.iConferenceId = %ld AND a.iID = g.iMsgAreaId;", m_strTableName.c_str(), id);
 
     // Execute Query.
     if (qry->getResult(queryString))
@@ -152,7 +152,7 @@ void NetworkDao::fillNetworkColumnValues(query_ptr qry, network_ptr obj,
 std::string NetworkDao::insertNetworkQryString(std::string qry, network_ptr obj)
 {
     // Mprint statement to avoid injections.
-    std::string result = sqlite3_mprintf(qry.c_str(),
+    std::string result = SQLW::Database::formatQuery(qry.c_str(),
         obj->sName.c_str(),
         obj->sType.c_str(),
         obj->sAddress.c_str()
@@ -170,7 +170,7 @@ std::string NetworkDao::insertNetworkQryString(std::string qry, network_ptr obj)
 std::string NetworkDao::updateNetworkQryString(std::string qry, network_ptr obj)
 {    
     // Mprint statement to avoid injections.
-    std::string result = sqlite3_mprintf(qry.c_str(),        
+    std::string result = SQLW::Database::formatQuery(qry.c_str(),        
         obj->sName.c_str(),
         obj->sType.c_str(),
         obj->sAddress.c_str(),
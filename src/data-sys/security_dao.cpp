@@ -146,7 +146,7 @@ void SecurityDao::fillSecurityColumnValues(query_ptr qry, security_ptr obj, std:
 std::string SecurityDao::insertSecurityQryString(std::string qry, security_ptr obj)
 {    
     // Mprint statement to avoid injections.
-    std::string result = sqlite3_mprintf(qry.c_str(),
+    std::string result = SQLW::Database::formatQuery(qry.c_str(),
         obj->sPasswordHash.c_str(),
         obj->sSaltHash.c_str(),
         obj->sChallengeQuestion.c_str(),
@@ -162,7 +162,7 @@ std::string SecurityDao::insertSecurityQryString(std::string qry, security_ptr o
 std::string SecurityDao::updateSecurityQryString(std::string qry, security_ptr obj)
 {
     // Mprint statement to avoid injections.
-    std::string result = sqlite3_mprintf(qry.c_str(),
+    std::string result = SQLW::Database::formatQuery(qry.c_str(),
         obj->sPasswordHash.c_str(),
         obj->sSaltHash.c_str(),
         obj->sChallengeQuestion.c_str(),
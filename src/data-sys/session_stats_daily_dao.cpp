@@ -0,0 +1,231 @@
+#include "session_stats_daily_dao.hpp"
+#include "../model-sys/session_stats_daily.hpp"
+
+#include "libSqliteWrapped.h"
+#include <sqlite3.h>
+
+#include <iostream>
+#include <string>
+#include <ctime>
+
+/**
+ * Base Dao Calls for generic Object Data Calls
+ * (Below This Point)
+ */
+
+/**
+ * @brief Check If Database Table Exists.
+ * @return
+ */
+bool SessionStatsDailyDao::doesTableExist()
+{
+    return baseDoesTableExist();
+}
+
+/**
+ * @brief Run Setup Params for SQL Database Table.
+ */
+bool SessionStatsDailyDao::firstTimeSetupParams()
+{
+    return baseFirstTimeSetupParams();
+}
+
+/**
+ * @brief Create Database Table
+ * @return
+ */
+bool SessionStatsDailyDao::createTable()
+{
+    return baseCreateTable();
+}
+
+/**
+ * @brief Drop Database
+ * @return
+ */
+bool SessionStatsDailyDao::dropTable()
+{
+    return baseDropTable();
+}
+
+/**
+ * @brief Updates a Record in the database!
+ * @param obj
+ * @return
+ */
+bool SessionStatsDailyDao::updateRecord(session_stats_daily_ptr obj)
+{
+    return baseUpdateRecord(obj);
+}
+
+/**
+ * @brief Inserts a New Record in the database!
+ * @param obj
+ * @return
+ */
+long SessionStatsDailyDao::insertRecord(session_stats_daily_ptr obj)
+{
+    return baseInsertRecord(obj);
+}
+
+/**
+ * @brief Deletes a Record
+ * @param id
+ * @return
+ */
+bool SessionStatsDailyDao::deleteRecord(long id)
+{
+    return baseDeleteRecord(id);
+}
+
+/**
+ * @brief Retrieve Record By Id.
+ * @param id
+ * @return
+ */
+session_stats_daily_ptr SessionStatsDailyDao::getRecordById(long id)
+{
+    return baseGetRecordById(id);
+}
+
+/**
+ * @brief Retrieve All Records in a Table
+ * @return
+ */
+std::vector<session_stats_daily_ptr> SessionStatsDailyDao::getAllRecords()
+{
+    return baseGetAllRecords();
+}
+
+/**
+ * @brief Retrieve Count of All Records in a Table
+ * @return
+ */
+long SessionStatsDailyDao::getRecordsCount()
+{
+    return baseGetRecordsCount();
+}
+
+
+/**
+ * Column Descriptors for Typed Statements
+ * (Below This Point)
+ */
+
+
+const DaoColumn<SessionStatsDaily> SessionStatsDailyDao::COLUMNS[] =
+{
+    DAO_COLUMN(SessionStatsDaily, sDay),
+    DAO_COLUMN(SessionStatsDaily, iCalls),
+    DAO_COLUMN(SessionStatsDaily, iLogons),
+    DAO_COLUMN(SessionStatsDaily, iMsgRead),
+    DAO_COLUMN(SessionStatsDaily, iMsgPost),
+    DAO_COLUMN(SessionStatsDaily, iFilesUl),
+    DAO_COLUMN(SessionStatsDaily, iFilesDl),
+    DAO_COLUMN(SessionStatsDaily, iFilesUlMb),
+    DAO_COLUMN(SessionStatsDaily, iFilesDlMb)
+};
+
+const size_t SessionStatsDailyDao::COLUMN_COUNT = sizeof(SessionStatsDailyDao::COLUMNS) / sizeof(SessionStatsDailyDao::COLUMNS[0]);
+
+
+/**
+ * One Off Methods SQL Queries not included in the BaseDao
+ * (Below This Point)
+ */
+
+
+/**
+ * @brief Local Day of a Time, matches date(x, 'unixepoch', 'localtime').
+ * @param time
+ * @return YYYY-MM-DD
+ */
+std::string SessionStatsDailyDao::getDayString(std::time_t time)
+{
+    char buffer[16] = {0};
+    std::strftime(buffer, sizeof(buffer), "%Y-%m-%d", std::localtime(&time));
+    return buffer;
+}
+
+/**
+ * @brief Totals for a Single Day, zeros when there were no sessions.
+ * @param day YYYY-MM-DD
+ * @return
+ */
+session_stats_daily_ptr SessionStatsDailyDao::getDailyStats(const std::string &day)
+{
+    session_stats_daily_ptr result(new SessionStatsDaily());
+    result->sDay = day;
+
+    baseStreamRecords("WHERE sDay = ?", [&day](query_ptr qry)
+    {
+        return qry->bind(1, day);
+    },
+    [&result](session_stats_daily_ptr stat)
+    {
+        result.reset(new SessionStatsDaily(*stat));
+        return false;
+    });
+
+    return result;
+}
+
+/**
+ * @brief Totals for Today
+ * @return
+ */
+session_stats_daily_ptr SessionStatsDailyDao::getTodaysStats()
+{
+    return getDailyStats(getDayString(std::time(nullptr)));
+}
+
+/**
+ * @brief Totals per Day between two Days Inclusive, oldest first.
+ * @param first_day YYYY-MM-DD
+ * @param last_day YYYY-MM-DD
+ * @return
+ */
+std::vector<session_stats_daily_ptr> SessionStatsDailyDao::getDailyStatsRange(const std::string &first_day, const std::string &last_day)
+{
+    std::vector<session_stats_daily_ptr> list;
+    baseStreamRecords("WHERE sDay BETWEEN ? AND ? ORDER BY sDay", [&first_day, &last_day](query_ptr qry)
+    {
+        return qry->bind(1, first_day) && qry->bind(2, last_day);
+    },
+    [&list](session_stats_daily_ptr stat)
+    {
+        list.push_back(session_stats_daily_ptr(new SessionStatsDaily(*stat)));
+        return true;
+    });
+
+    return list;
+}
+
+/**
+ * @brief Trigger Body adding or removing a Session Row from its Day.
+ * @param row NEW or OLD
+ * @param sign + or -
+ * @return
+ */
+std::string SessionStatsDailyDao::rollupStatements(const std::string &row, const std::string &sign)
+{
+    std::string day = "date(" + row + ".dtStartDate, 'unixepoch', 'localtime')";
+    std::string result =
+        "INSERT OR IGNORE INTO sessionstatsdaily "
+        "(sDay, iCalls, iLogons, iMsgRead, iMsgPost, iFilesUl, iFilesDl, iFilesUlMb, iFilesDlMb) "
+        "VALUES (" + day + ", 0, 0, 0, 0, 0, 0, 0, 0); "
+        "UPDATE sessionstatsdaily SET "
+        "iCalls = iCalls " + sign + " 1, "
+        "iLogons = iLogons " + sign + " " + row + ".bLogonSuccess, ";
+
+    const char *columns[] = { "iMsgRead", "iMsgPost", "iFilesUl", "iFilesDl", "iFilesUlMb", "iFilesDlMb" };
+    for (size_t i = 0; i < sizeof(columns) / sizeof(columns[0]); i++)
+    {
+        std::string column = columns[i];
+        result += column + " = " + column + " " + sign + " " + row + "." + column;
+        result += (i + 1 < sizeof(columns) / sizeof(columns[0])) ? ", " : " ";
+    }
+
+    result += "WHERE sDay = " + day + "; ";
+    return result;
+}
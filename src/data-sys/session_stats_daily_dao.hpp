@@ -0,0 +1,247 @@
+#ifndef SESSION_STATS_DAILY_DAO_HPP
+#define SESSION_STATS_DAILY_DAO_HPP
+
+#include "../model-sys/session_stats_daily.hpp"
+#include "../data-sys/base_dao.hpp"
+
+#include <memory>
+#include <vector>
+#include <string>
+#include <ctime>
+
+// Forward Declerations
+namespace SQLW
+{
+class Database;
+class Query;
+}
+
+// Handle to Database Queries
+typedef std::shared_ptr<SQLW::Query> query_ptr;
+
+// Base Dao Definition
+typedef BaseDao<SessionStatsDaily> baseSessionStatsDailyClass;
+
+/**
+ * @class SessionStatsDailyDao
+ * @author Michael Griffin
+ * @date 17/10/2026
+ * @file session_stats_daily_dao.hpp
+ * @brief Daily Rollup of the Session Stats Table.
+ *        Triggers on sessionstats add each insert and update into its day,
+ *        so reports read one row per day instead of scanning every session.
+ *        Requires the sessionstats table to exist first.
+ */
+class SessionStatsDailyDao
+    : public baseSessionStatsDailyClass
+{
+public:
+
+    explicit SessionStatsDailyDao(SQLW::Database &database)
+        : baseSessionStatsDailyClass(database)
+    {
+        // Setup Table name
+        m_strTableName = "sessionstatsdaily";
+
+        /**
+         * Pre Popluate Static Queries one Time
+         */
+        m_cmdFirstTimeSetup =
+            "PRAGMA synchronous=Normal; "
+            "PRAGMA encoding=UTF-8; "
+            "PRAGMA foreign_keys=ON; "
+            "PRAGMA default_cache_size=10000; "
+            "PRAGMA cache_size=10000; ";
+
+        // Check if Database Exists.
+        m_cmdTableExists = "SELECT name FROM sqlite_master WHERE type='table' AND name='" + m_strTableName + "' COLLATE NOCASE;";
+
+        // Create Table, the Triggers and Backfill existing sessions in one transaction.
+        m_cmdCreateTable =
+            "CREATE TABLE IF NOT EXISTS " + m_strTableName + " ( "
+            "iId               INTEGER PRIMARY KEY, "
+            "sDay              TEXT NOT NULL UNIQUE, "
+            "iCalls            INTEGER NOT NULL, "
+            "iLogons           INTEGER NOT NULL, "
+            "iMsgRead          INTEGER NOT NULL, "
+            "iMsgPost          INTEGER NOT NULL, "
+            "iFilesUl          INTEGER NOT NULL, "
+            "iFilesDl          INTEGER NOT NULL, "
+            "iFilesUlMb        INTEGER NOT NULL, "
+            "iFilesDlMb        INTEGER NOT NULL "
+            "); "
+
+            "CREATE TRIGGER IF NOT EXISTS session_stats_daily_insert "
+            "AFTER INSERT ON sessionstats BEGIN " +
+            rollupStatements("NEW", "+") +
+            "END; "
+
+            "CREATE TRIGGER IF NOT EXISTS session_stats_daily_update "
+            "AFTER UPDATE ON sessionstats BEGIN " +
+            rollupStatements("OLD", "-") +
+            rollupStatements("NEW", "+") +
+            "END; "
+
+            "CREATE TRIGGER IF NOT EXISTS session_stats_daily_delete "
+            "AFTER DELETE ON sessionstats BEGIN " +
+            rollupStatements("OLD", "-") +
+            "END; "
+
+            "INSERT OR IGNORE INTO " + m_strTableName + " "
+            "(sDay, iCalls, iLogons, iMsgRead, iMsgPost, iFilesUl, iFilesDl, iFilesUlMb, iFilesDlMb) "
+            "SELECT date(dtStartDate, 'unixepoch', 'localtime'), COUNT(*), SUM(bLogonSuccess), "
+            "SUM(iMsgRead), SUM(iMsgPost), SUM(iFilesUl), SUM(iFilesDl), SUM(iFilesUlMb), SUM(iFilesDlMb) "
+            "FROM sessionstats GROUP BY 1; ";
+
+        // sDay is UNIQUE, which is the only index needed.
+        m_cmdCreateIndex = "";
+
+        m_cmdDropTable = "DROP TABLE IF EXISTS " + m_strTableName + "; ";
+        m_cmdDropIndex =
+            "DROP TRIGGER IF EXISTS session_stats_daily_insert; "
+            "DROP TRIGGER IF EXISTS session_stats_daily_update; "
+            "DROP TRIGGER IF EXISTS session_stats_daily_delete; ";
+
+        // Typed Columns, Insert, Update and Select statements are generated once.
+        baseSetColumns(COLUMNS, COLUMN_COUNT);
+    }
+
+    ~SessionStatsDailyDao()
+    {
+    }
+
+
+    /**
+     * Base Dao Calls for generic Object Data Calls
+     * (Below This Point)
+     */
+
+
+    /**
+     * @brief Check If Database Table Exists.
+     * @return
+     */
+    bool doesTableExist();
+
+    /**
+     * @brief Run Setup Params for SQL Database Table.
+     */
+    bool firstTimeSetupParams();
+
+    /**
+     * @brief Create Database Table
+     * @return
+     */
+    bool createTable();
+
+    /**
+     * @brief Drop Database
+     * @return
+     */
+    bool dropTable();
+
+    /**
+     * @brief Updates a Record in the database!
+     * @param obj
+     * @return
+     */
+    bool updateRecord(session_stats_daily_ptr obj);
+
+    /**
+     * @brief Inserts a New Record in the database!
+     * @param obj
+     * @return
+     */
+    long insertRecord(session_stats_daily_ptr obj);
+
+    /**
+     * @brief Deletes a Record
+     * @param id
+     * @return
+     */
+    bool deleteRecord(long id);
+
+    /**
+     * @brief Retrieve Record By Id.
+     * @param id
+     * @return
+     */
+    session_stats_daily_ptr getRecordById(long id);
+
+    /**
+     * @brief Retrieve All Records in a Table
+     * @return
+     */
+    std::vector<session_stats_daily_ptr> getAllRecords();
+
+    /**
+     * @brief Retrieve Count of All Records in a Table
+     * @return
+     */
+    long getRecordsCount();
+
+
+    /**
+     * Column Descriptors for Typed Statements
+     * (Below This Point)
+     */
+
+
+    /**
+     * @brief Columns in Table order, iId is implied as the first column.
+     */
+    static const DaoColumn<SessionStatsDaily> COLUMNS[];
+    static const size_t COLUMN_COUNT;
+
+
+    /**
+     * One Off Methods SQL Queries not included in the BaseDao
+     * (Below This Point)
+     */
+
+
+    /**
+     * @brief Local Day of a Time, matches date(x, 'unixepoch', 'localtime').
+     * @param time
+     * @return YYYY-MM-DD
+     */
+    static std::string getDayString(std::time_t time);
+
+    /**
+     * @brief Totals for a Single Day, zeros when there were no sessions.
+     * @param day YYYY-MM-DD
+     * @return
+     */
+    session_stats_daily_ptr getDailyStats(const std::string &day);
+
+    /**
+     * @brief Totals for Today
+     * @return
+     */
+    session_stats_daily_ptr getTodaysStats();
+
+    /**
+     * @brief Totals per Day between two Days Inclusive, oldest first.
+     *        Days without sessions are not returned.
+     * @param first_day YYYY-MM-DD
+     * @param last_day YYYY-MM-DD
+     * @return
+     */
+    std::vector<session_stats_daily_ptr> getDailyStatsRange(const std::string &first_day, const std::string &last_day);
+
+private:
+
+    /**
+     * @brief Trigger Body adding or removing a Session Row from its Day.
+     * @param row NEW or OLD
+     * @param sign + or -
+     * @return
+     */
+    static std::string rollupStatements(const std::string &row, const std::string &sign);
+
+};
+
+// Handle to Database Queries
+typedef std::shared_ptr<SessionStatsDailyDao> session_stats_daily_dao_ptr;
+
+#endif // SESSION_STATS_DAILY_DAO_HPP
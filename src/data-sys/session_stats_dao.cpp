@@ -7,6 +7,7 @@
 
 #include <iostream>
 #include <string>
+#include <ctime>
 
 
 /**
@@ -110,138 +111,36 @@ long SessionStatsDao::getRecordsCount()
 
 
 /**
- * Base Dao Call Back for Object Specific Data Mappings
+ * Column Descriptors for Typed Statements
  * (Below This Point)
  */
 
 
-/**
- * @brief (CallBack) Pulls results by FieldNames into their Class Variables. 
- * @param qry
- * @param obj
- */
-void SessionStatsDao::pullSessionStatsResult(query_ptr qry, session_stats_ptr obj)
-{
-    qry->getFieldByName("iId", obj->iId);
-    qry->getFieldByName("iUserId", obj->iUserId);
-    qry->getFieldByName("sSessionType", obj->sSessionType);
-    qry->getFieldByName("sCodePage", obj->sCodePage);
-    qry->getFieldByName("sTerminal", obj->sTerminal);
-    qry->getFieldByName("sIPAddress", obj->sIPAddress);
-    qry->getFieldByName("iTermWidth", obj->iTermWidth);
-    qry->getFieldByName("iTermHeight", obj->iTermHeight);
-    qry->getFieldByName("dtStartDate", obj->dtStartDate);
-    qry->getFieldByName("dtEndDate", obj->dtEndDate);
-    qry->getFieldByName("iInvalidAttempts", obj->iInvalidAttempts);
-    qry->getFieldByName("bNewUser", obj->bNewUser);
-    qry->getFieldByName("bLogonSuccess", obj->bLogonSuccess);    
-    qry->getFieldByName("bHungup", obj->bHungup);
-    qry->getFieldByName("iMsgRead", obj->iMsgRead);
-    qry->getFieldByName("iMsgPost", obj->iMsgPost);
-    qry->getFieldByName("iFilesUl", obj->iFilesUl);
-    qry->getFieldByName("iFilesDl", obj->iFilesDl);
-    qry->getFieldByName("iFilesUlMb", obj->iFilesUlMb);
-    qry->getFieldByName("iFilesDlMb", obj->iFilesDlMb);
-}
-
-/**
- * @brief (Callback) for Insert Statement translates to (Column, .. ) VALUES (%d, %Q,)
- * @param qry
- * @param obj
- * @param values
- */ 
-void SessionStatsDao::fillSessionStatsColumnValues(query_ptr qry, session_stats_ptr obj, std::vector< std::pair<std::string, std::string> > &values)
+const DaoColumn<SessionStats> SessionStatsDao::COLUMNS[] =
 {
-    //values.push_back(qry->translateFieldName("iId", obj->iId));
-    values.push_back(qry->translateFieldName("iUserId", obj->iUserId));
-    values.push_back(qry->translateFieldName("sSessionType", obj->sSessionType));
-    values.push_back(qry->translateFieldName("sCodePage", obj->sCodePage));
-    values.push_back(qry->translateFieldName("sTerminal", obj->sTerminal));
-    values.push_back(qry->translateFieldName("sIPAddress", obj->sIPAddress));
-    values.push_back(qry->translateFieldName("iTermWidth", obj->iTermWidth));
-    values.push_back(qry->translateFieldName("iTermHeight", obj->iTermHeight));
-    values.push_back(qry->translateFieldName("dtStartDate", obj->dtStartDate));
-    values.push_back(qry->translateFieldName("dtEndDate", obj->dtEndDate));    
-    values.push_back(qry->translateFieldName("iInvalidAttempts", obj->iInvalidAttempts));
-    values.push_back(qry->translateFieldName("bNewUser", obj->bNewUser));
-    values.push_back(qry->translateFieldName("bLogonSuccess", obj->bLogonSuccess));    
-    values.push_back(qry->translateFieldName("bHungup", obj->bHungup));
-    values.push_back(qry->translateFieldName("iMsgRead", obj->iMsgRead));
-    values.push_back(qry->translateFieldName("iMsgPost", obj->iMsgPost));
-    values.push_back(qry->translateFieldName("iFilesUl", obj->iFilesUl));
-    values.push_back(qry->translateFieldName("iFilesDl", obj->iFilesDl));
-    values.push_back(qry->translateFieldName("iFilesUlMb", obj->iFilesUlMb));
-    values.push_back(qry->translateFieldName("iFilesDlMb", obj->iFilesDlMb));
-}
-
-/**
- * @brief (Callback) Create Record Insert Statement, returns query string 
- * @param qry
- * @param obj
- * @return 
- */
-std::string SessionStatsDao::insertSessionStatsQryString(std::string qry, session_stats_ptr obj)
-{
-    // Mprint statement to avoid injections.
-    std::string result = sqlite3_mprintf(qry.c_str(),
-        obj->iUserId,
-        obj->sSessionType.c_str(),
-        obj->sCodePage.c_str(),
-        obj->sTerminal.c_str(),
-        obj->sIPAddress.c_str(),
-        obj->iTermWidth,
-        obj->iTermHeight,
-        obj->dtStartDate,
-        obj->dtEndDate,
-        obj->iInvalidAttempts,
-        obj->bNewUser,
-        obj->bLogonSuccess,
-        obj->bHungup,
-        obj->iMsgRead,
-        obj->iMsgPost,
-        obj->iFilesUl,
-        obj->iFilesDl,
-        obj->iFilesUlMb,
-        obj->iFilesDlMb
-    );
-
-    return result;
-}
-
-/**
- * @brief (CallBack) Update Existing Record. 
- * @param qry
- * @param obj
- * @return 
- */
-std::string SessionStatsDao::updateSessionStatsQryString(std::string qry, session_stats_ptr obj)
-{    
-    // Mprint statement to avoid injections.
-    std::string result = sqlite3_mprintf(qry.c_str(),        
-        obj->iUserId,
-        obj->sSessionType.c_str(),
-        obj->sCodePage.c_str(),
-        obj->sTerminal.c_str(),
-        obj->sIPAddress.c_str(),
-        obj->iTermWidth,
-        obj->iTermHeight,
-        obj->dtStartDate,
-        obj->dtEndDate,
-        obj->iInvalidAttempts,
-        obj->bNewUser,
-        obj->bLogonSuccess,        
-        obj->bHungup,
-        obj->iMsgRead,
-        obj->iMsgPost,
-        obj->iFilesUl,
-        obj->iFilesDl,
-        obj->iFilesUlMb,
-        obj->iFilesDlMb,
-        obj->iId
-    );
-
-    return result;
-}
+    DAO_COLUMN(SessionStats, iUserId),
+    DAO_COLUMN(SessionStats, sSessionType),
+    DAO_COLUMN(SessionStats, sCodePage),
+    DAO_COLUMN(SessionStats, sTerminal),
+    DAO_COLUMN(SessionStats, sIPAddress),
+    DAO_COLUMN(SessionStats, iTermWidth),
+    DAO_COLUMN(SessionStats, iTermHeight),
+    DAO_COLUMN(SessionStats, dtStartDate),
+    DAO_COLUMN(SessionStats, dtEndDate),
+    DAO_COLUMN(SessionStats, iInvalidAttempts),
+    DAO_COLUMN(SessionStats, bNewUser),
+    DAO_COLUMN(SessionStats, bLogonSuccess),
+    DAO_COLUMN(SessionStats, bHungup),
+    DAO_COLUMN(SessionStats, iMsgRead),
+    DAO_COLUMN(SessionStats, iMsgPost),
+    DAO_COLUMN(SessionStats, iFilesUl),
+    DAO_COLUMN(SessionStats, iFilesDl),
+    DAO_COLUMN(SessionStats, iFilesUlMb),
+    DAO_COLUMN(SessionStats, iFilesDlMb),
+    DAO_COLUMN(SessionStats, iNegotiationMs)
+};
+
+const size_t SessionStatsDao::COLUMN_COUNT = sizeof(SessionStatsDao::COLUMNS) / sizeof(SessionStatsDao::COLUMNS[0]);
 
 
 /**
@@ -251,110 +150,106 @@ std::string SessionStatsDao::updateSessionStatsQryString(std::string qry, sessio
  
  
 /**
- * @brief Return List of All Users
+ * @brief Create Indexes, Picks up indexes added since the table was created.
  * @return
  */
-std::vector<session_stats_ptr> SessionStatsDao::getAllStatsPerUser(long userId)
+bool SessionStatsDao::createIndex()
 {
-    session_stats_ptr stat(new SessionStats);
-    std::vector<session_stats_ptr> list;
+    return baseCreateIndex();
+}
 
-    // Make Sure Database Reference is Connected
-    if (!m_database.isConnected())
+/**
+ * @brief Add Columns introduced since the table was created.
+ * @return
+ */
+bool SessionStatsDao::upgradeTable()
+{
+    query_ptr qry(new SQLW::Query(m_database));
+    if (!qry || !qry->isConnected())
     {
-        std::cout << "Error, Database is not connected!" << std::endl;
-        return list;
+        std::cout << "Error, Query has no connection to the database" << std::endl;
+        return false;
     }
 
-    // Create Pointer and Connect Query Object to Database.
-    query_ptr qry(new SQLW::Query(m_database));
-    if (!qry->isConnected())
+    // Telnet Negotiation Time, the prepare fails on older tables.
+    if (qry->execute("SELECT iNegotiationMs FROM " + m_strTableName + " LIMIT 1;"))
     {
-        std::cout << "Error, Query has no connection to the database" << std::endl;
-        return list;
+        return true;
     }
 
-    // Build Query String
-    std::string queryString = sqlite3_mprintf("SELECT * FROM %Q WHERE iUserId = %ld;", m_strTableName.c_str(), userId);
+    std::cout << "Adding iNegotiationMs (sessionstats table)." << std::endl;
+    std::vector<std::string> statements;
+    statements.push_back("ALTER TABLE " + m_strTableName + " ADD COLUMN iNegotiationMs INTEGER NOT NULL DEFAULT 0;");
+    return qry->executeTransaction(statements);
+}
 
-    // Execute Query.
-    if (qry->getResult(queryString))
+/**
+ * @brief Return List of Stats per user
+ * @return
+ */
+std::vector<session_stats_ptr> SessionStatsDao::getAllStatsPerUser(long userId)
+{
+    std::vector<session_stats_ptr> list;
+    baseStreamRecords("WHERE iUserId = ?", [userId](query_ptr qry)
     {
-        long rows = qry->getNumRows();
-        if (rows > 0)
-        {
-            while(qry->fetchRow())
-            {
-                stat.reset(new SessionStats);
-                pullSessionStatsResult(qry, stat);
-                list.push_back(stat);
-            }
-        }
-        else
-        {
-            std::cout << "Error, getAllStatsPerUser Returned Rows: " << rows << std::endl;
-        }
-    }
-    else
+        return qry->bind(1, userId);
+    },
+    [&list](session_stats_ptr stat)
     {
-        std::cout << "Error, getResult()" << std::endl;
-    }
+        list.push_back(session_stats_ptr(new SessionStats(*stat)));
+        return true;
+    });
 
     return list;
 }
 
 /**
- * @brief Return List of All Users
+ * @brief Return List of Last 10 Valid Sessions.
  * @return
  */
 std::vector<session_stats_ptr> SessionStatsDao::getLast10CallerStats()
 {
-    session_stats_ptr stat(new SessionStats);
     std::vector<session_stats_ptr> list;
-
-    // Make Sure Database Reference is Connected
-    if (!m_database.isConnected())
+    streamCallerStats(10, 0, [&list](session_stats_ptr stat)
     {
-        std::cout << "Error, Database is not connected!" << std::endl;
-        return list;
-    }
+        list.push_back(session_stats_ptr(new SessionStats(*stat)));
+        return true;
+    });
 
-    // Create Pointer and Connect Query Object to Database.
-    query_ptr qry(new SQLW::Query(m_database));
-    if (!qry->isConnected())
-    {
-        std::cout << "Error, Query has no connection to the database" << std::endl;
-        return list;
-    }
+    return list;
+}
 
-    // Build Query String
-    std::string queryString = sqlite3_mprintf("SELECT * FROM %Q WHERE bLogonSuccess = '1' "
-        "ORDER BY iID DESC;", m_strTableName.c_str());
+/**
+ * @brief Stream a Page of the Caller Log, Valid Sessions newest first.
+ * @param limit -1 for no limit.
+ * @param offset
+ * @param visitor
+ * @return Rows Visited, -1 on error.
+ */
+long SessionStatsDao::streamCallerStats(long limit, long offset, record_visitor visitor)
+{
+    // Walks session_stats_logon_idx backwards, only the page is read.
+    return baseStreamRecordsPage("WHERE bLogonSuccess = 1 ORDER BY dtStartDate DESC, iId DESC",
+                                 nullptr, limit, offset, visitor);
+}
 
-    // Execute Query.
-    if (qry->getResult(queryString))
-    {
-        long rows = qry->getNumRows();
-        if (rows > 0)
-        {
-            while(qry->fetchRow())
-            {
-                stat.reset(new SessionStats);
-                pullSessionStatsResult(qry, stat);
-                list.push_back(stat);
-            }
-        }
-        else
-        {
-            std::cout << "Error, getLast10CallerStats Returned Rows: " << rows << std::endl;
-        }
-    }
-    else
+/**
+ * @brief Stream Sessions Started in a Time Range, newest first.
+ * @param start_time Inclusive
+ * @param end_time Exclusive
+ * @param visitor
+ * @return Rows Visited, -1 on error.
+ */
+long SessionStatsDao::streamCallerStatsRange(std::time_t start_time, std::time_t end_time, record_visitor visitor)
+{
+    // Bounds are bound as values so session_stats_start_idx is used for the range.
+    return baseStreamRecords("WHERE dtStartDate >= ? AND dtStartDate < ? ORDER BY dtStartDate DESC, iId DESC",
+                             [start_time, end_time](query_ptr qry)
     {
-        std::cout << "Error, getResult()" << std::endl;
-    }
-
-    return list;
+        return qry->bind(1, static_cast<long long>(start_time)) &&
+               qry->bind(2, static_cast<long long>(end_time));
+    },
+    visitor);
 }
 
 /**
@@ -363,52 +258,25 @@ std::vector<session_stats_ptr> SessionStatsDao::getLast10CallerStats()
  */
 std::vector<session_stats_ptr> SessionStatsDao::getTodaysCallerStats()
 {
-    session_stats_ptr stat(new SessionStats);
-    std::vector<session_stats_ptr> list;
-
-    // Make Sure Database Reference is Connected
-    if (!m_database.isConnected())
-    {
-        std::cout << "Error, Database is not connected!" << std::endl;
-        return list;
-    }
-
-    // Create Pointer and Connect Query Object to Database.
-    query_ptr qry(new SQLW::Query(m_database));
-    if (!qry->isConnected())
-    {
-        std::cout << "Error, Query has no connection to the database" << std::endl;
-        return list;
-    }
-
-    // Build Query String
-    std::string queryString = sqlite3_mprintf(
-        "SELECT * FROM %Q "
-        "WHERE datetime(dtStartDate, 'unixepoch', 'localtime') >= datetime('now','start of day') "
-        "ORDER BY iID DESC;", m_strTableName.c_str());
+    // Local Midnight to the next, worked out here instead of per row in SQL.
+    std::time_t now = std::time(nullptr);
+    std::tm day = *std::localtime(&now);
+    day.tm_hour = 0;
+    day.tm_min = 0;
+    day.tm_sec = 0;
+    day.tm_isdst = -1;
+    std::time_t start_time = std::mktime(&day);
+
+    day.tm_mday += 1;
+    day.tm_isdst = -1;
+    std::time_t end_time = std::mktime(&day);
 
-    // Execute Query.
-    if (qry->getResult(queryString))
-    {
-        long rows = qry->getNumRows();
-        if (rows > 0)
-        {
-            while(qry->fetchRow())
-            {
-                stat.reset(new SessionStats);
-                pullSessionStatsResult(qry, stat);
-                list.push_back(stat);
-            }
-        }
-        else
-        {
-            std::cout << "Error, getTodaysCallerStats Returned Rows: " << rows << std::endl;
-        }
-    }
-    else
+    std::vector<session_stats_ptr> list;
+    streamCallerStatsRange(start_time, end_time, [&list](session_stats_ptr stat)
     {
-        std::cout << "Error, getResult()" << std::endl;
-    }
+        list.push_back(session_stats_ptr(new SessionStats(*stat)));
+        return true;
+    });
 
     return list;
 }
@@ -7,6 +7,7 @@
 #include <memory>
 #include <vector>
 #include <functional>
+#include <ctime>
 
 // Forward Declerations
 namespace SQLW
@@ -68,29 +69,28 @@ public:
             "iFilesUl          INTEGER NOT NULL, "
             "iFilesDl          INTEGER NOT NULL, "
             "iFilesUlMb        INTEGER NOT NULL, "
-            "iFilesDlMb        INTEGER NOT NULL "
+            "iFilesDlMb        INTEGER NOT NULL, "
+            "iNegotiationMs    INTEGER NOT NULL DEFAULT 0 "
             "); ";
 
+        // Time Ranges and the Caller Log read these instead of scanning the table.
         m_cmdCreateIndex =
             "CREATE INDEX IF NOT EXISTS session_stats_idx "
-            "ON " + m_strTableName + " (iUserId); ";
+            "ON " + m_strTableName + " (iUserId); "
+            "CREATE INDEX IF NOT EXISTS session_stats_start_idx "
+            "ON " + m_strTableName + " (dtStartDate); "
+            "CREATE INDEX IF NOT EXISTS session_stats_logon_idx "
+            "ON " + m_strTableName + " (bLogonSuccess, dtStartDate); ";
 
         // CREATE INDEX `IDX_testtbl_Name` ON `testtbl` (`Name` COLLATE UTF8CI)
         m_cmdDropTable = "DROP TABLE IF EXISTS " + m_strTableName + "; ";
-        m_cmdDropIndex = "DROP INDEX IF EXISTS session_stats_idx; ";
+        m_cmdDropIndex =
+            "DROP INDEX IF EXISTS session_stats_idx; "
+            "DROP INDEX IF EXISTS session_stats_start_idx; "
+            "DROP INDEX IF EXISTS session_stats_logon_idx; ";
 
-        // Setup the CallBack for Result Field Mapping
-        m_result_callback = std::bind(&SessionStatsDao::pullSessionStatsResult, this,
-                                      std::placeholders::_1, std::placeholders::_2);
-
-        m_columns_callback = std::bind(&SessionStatsDao::fillSessionStatsColumnValues, this,
-                                       std::placeholders::_1, std::placeholders::_2, std::placeholders::_3);
-
-        m_insert_callback = std::bind(&SessionStatsDao::insertSessionStatsQryString, this,
-                                      std::placeholders::_1, std::placeholders::_2);
-
-        m_update_callback = std::bind(&SessionStatsDao::updateSessionStatsQryString, this,
-                                      std::placeholders::_1, std::placeholders::_2);
+        // Typed Columns, Insert, Update and Select statements are generated once.
+        baseSetColumns(COLUMNS, COLUMN_COUNT);
     }
 
     ~SessionStatsDao()
@@ -169,48 +169,35 @@ public:
 
 
     /**
-     * Base Dao Call Back for Object Specific Data Mappings
+     * Column Descriptors for Typed Statements
      * (Below This Point)
      */
 
 
     /**
-     * @brief (Callback) Create Record Insert Statement, returns query string
-     * @param qry
-     * @param obj
-     * @return
+     * @brief Columns in Table order, iId is implied as the first column.
      */
-    std::string insertSessionStatsQryString(std::string qry, session_stats_ptr obj);
+    static const DaoColumn<SessionStats> COLUMNS[];
+    static const size_t COLUMN_COUNT;
 
-    /**
-     * @brief (CallBack) Update Existing Record.
-     * @param qry
-     * @param obj
-     * @return
-     */
-    std::string updateSessionStatsQryString(std::string qry, session_stats_ptr obj);
 
     /**
-     * @brief (CallBack) Pulls results by FieldNames into their Class Variables.
-     * @param qry
-     * @param obj
+     * One Off Methods SQL Queries not included in the BaseDao
+     * (Below This Point)
      */
-    void pullSessionStatsResult(query_ptr qry, session_stats_ptr obj);
+
 
     /**
-     * @brief (Callback) for Insert Statement translates to (Column, .. ) VALUES (%d, %Q,)
-     * @param qry
-     * @param obj
-     * @param values
+     * @brief Create Indexes, Picks up indexes added since the table was created.
+     * @return
      */
-    void fillSessionStatsColumnValues(query_ptr qry, session_stats_ptr obj, std::vector< std::pair<std::string, std::string> > &values);
-
+    bool createIndex();
 
     /**
-     * One Off Methods SQL Queries not included in the BaseDao
-     * (Below This Point)
+     * @brief Add Columns introduced since the table was created.
+     * @return
      */
-
+    bool upgradeTable();
 
     /**
      * @brief Return List of Stats per user
@@ -224,6 +211,24 @@ public:
      */
     std::vector<session_stats_ptr> getLast10CallerStats();
 
+    /**
+     * @brief Stream a Page of the Caller Log, Valid Sessions newest first.
+     * @param limit -1 for no limit.
+     * @param offset
+     * @param visitor
+     * @return Rows Visited, -1 on error.
+     */
+    long streamCallerStats(long limit, long offset, record_visitor visitor);
+
+    /**
+     * @brief Stream Sessions Started in a Time Range, newest first.
+     * @param start_time Inclusive
+     * @param end_time Exclusive
+     * @param visitor
+     * @return Rows Visited, -1 on error.
+     */
+    long streamCallerStatsRange(std::time_t start_time, std::time_t end_time, record_visitor visitor);
+
     /**
      * @brief Return List of All Connections Today
      * @return
@@ -56,7 +56,13 @@ bool UsersDao::dropTable()
  */
 bool UsersDao::updateRecord(user_ptr obj)
 {
-    return baseUpdateRecord(obj);
+    bool result = baseUpdateRecord(obj);
+    user_directory_ptr directory = getUserDirectory();
+    if (result && directory)
+    {
+        directory->upsertUser(obj);
+    }
+    return result;
 }
 
 /**
@@ -66,7 +72,15 @@ bool UsersDao::updateRecord(user_ptr obj)
  */
 long UsersDao::insertRecord(user_ptr obj)
 {
-    return baseInsertRecord(obj);
+    long id = baseInsertRecord(obj);
+    user_directory_ptr directory = getUserDirectory();
+    if (id >= 0 && directory)
+    {
+        user_ptr user(new Users(*obj));
+        user->iId = id;
+        directory->upsertUser(user);
+    }
+    return id;
 }
 
 /**
@@ -76,7 +90,13 @@ long UsersDao::insertRecord(user_ptr obj)
  */
 bool UsersDao::deleteRecord(long id)
 {
-    return baseDeleteRecord(id);
+    bool result = baseDeleteRecord(id);
+    user_directory_ptr directory = getUserDirectory();
+    if (result && directory)
+    {
+        directory->removeUser(id);
+    }
+    return result;
 }
 
 /**
@@ -86,6 +106,12 @@ bool UsersDao::deleteRecord(long id)
  */ 
 user_ptr UsersDao::getRecordById(long id)
 {
+    user_directory_ptr directory = getUserDirectory();
+    if (directory)
+    {
+        user_ptr user = directory->getUserById(id);
+        return user ? user : user_ptr(new Users);
+    }
     return baseGetRecordById(id);
 }
 
@@ -109,276 +135,122 @@ long UsersDao::getRecordsCount()
 
 
 /**
- * Base Dao Call Back for Object Specific Data Mappings
+ * Column Descriptors for Typed Statements
  * (Below This Point)
  */
- 
 
-/**
- * @brief (CallBack) Pulls results by FieldNames into their Class Variables. 
- * @param qry
- * @param obj
- */
-void UsersDao::pullUsersResult(query_ptr qry, user_ptr obj)
-{
-    qry->getFieldByName("iId", obj->iId);
-    qry->getFieldByName("sHandle", obj->sHandle);
-    qry->getFieldByName("sRealName", obj->sRealName);
-    qry->getFieldByName("sAddress", obj->sAddress);
-    qry->getFieldByName("sLocation", obj->sLocation);
-    qry->getFieldByName("sCountry", obj->sCountry);
-    qry->getFieldByName("sEmail", obj->sEmail);
-    qry->getFieldByName("sUserNote", obj->sUserNote);
-    qry->getFieldByName("dtBirthday", obj->dtBirthday);
-    qry->getFieldByName("iLevel", obj->iLevel);
-    qry->getFieldByName("iFileLevel", obj->iFileLevel);
-    qry->getFieldByName("iMessageLevel", obj->iMessageLevel);
-    qry->getFieldByName("iLastFileArea", obj->iLastFileArea);
-    qry->getFieldByName("iLastMessageArea", obj->iLastMessageArea);
-    qry->getFieldByName("iTimeLeft", obj->iTimeLeft);
-    qry->getFieldByName("iTimeLimit", obj->iTimeLimit);
-    qry->getFieldByName("sRegColor", obj->sRegColor);
-    qry->getFieldByName("sPromptColor", obj->sPromptColor);
-    qry->getFieldByName("sInputColor", obj->sInputColor);
-    qry->getFieldByName("sInverseColor", obj->sInverseColor);
-    qry->getFieldByName("sStatColor", obj->sStatColor);
-    qry->getFieldByName("sBoxColor", obj->sBoxColor);
-    qry->getFieldByName("iFilePoints", obj->iFilePoints);    
-    qry->getFieldByName("iPostCallRatio", obj->iPostCallRatio);
-    qry->getFieldByName("sMenuPromptName", obj->sMenuPromptName);
-    qry->getFieldByName("iMenuSelected", obj->iMenuSelected);
-    qry->getFieldByName("iStatusSelected", obj->iStatusSelected);
-    qry->getFieldByName("bAnsi", obj->bAnsi);
-    qry->getFieldByName("bBackSpaceVt100", obj->bBackSpaceVt100);
-    qry->getFieldByName("iNuvVotesYes", obj->iNuvVotesYes);
-    qry->getFieldByName("iNuvVotesNo", obj->iNuvVotesNo);
-    qry->getFieldByName("dtPassChangeDate", obj->dtPassChangeDate);
-    qry->getFieldByName("dtLastReplyDate", obj->dtLastReplyDate);
-    qry->getFieldByName("bScrollFL", obj->bAnsi);
-    qry->getFieldByName("iCSPassChange", obj->iCSPassChange);
-    qry->getFieldByName("iControlFlags1", obj->iControlFlags1);
-    qry->getFieldByName("iControlFlags2", obj->iControlFlags2);
-    qry->getFieldByName("bWanted", obj->bWanted);
-    qry->getFieldByName("sHeaderType", obj->sHeaderType);
-    qry->getFieldByName("iLastMesConf", obj->iLastMesConf);
-    qry->getFieldByName("iLastFileConf", obj->iLastFileConf);
-    qry->getFieldByName("dtExpirationDate", obj->dtExpirationDate);
-    qry->getFieldByName("sGender", obj->sGender);
-    qry->getFieldByName("dtFirstOn", obj->dtFirstOn);
-    qry->getFieldByName("bYesNoBars", obj->bYesNoBars);
-    qry->getFieldByName("iHackAttempts", obj->iHackAttempts);
-    qry->getFieldByName("bDoPause", obj->bDoPause);
-    qry->getFieldByName("bClearOrScroll", obj->bClearOrScroll);
-    qry->getFieldByName("bIgnoreTimeLimit", obj->bIgnoreTimeLimit);
-    qry->getFieldByName("bAllowPurge", obj->bAllowPurge);
-    qry->getFieldByName("iSecurityIndex", obj->iSecurityIndex);
-}
 
-/**
- * @brief (Callback) for Insert Statement translates to (Column, .. ) VALUES (%d, %Q,)
- * @param qry
- * @param obj
- * @param values
- */ 
-void UsersDao::fillUsersColumnValues(query_ptr qry, user_ptr obj, std::vector< std::pair<std::string, std::string> > &values)
+const DaoColumn<Users> UsersDao::COLUMNS[] =
 {
-    // values.push_back(qry->translateFieldName("iId", obj->iId));
-    values.push_back(qry->translateFieldName("sHandle", obj->sHandle));
-    values.push_back(qry->translateFieldName("sRealName", obj->sRealName));
-    values.push_back(qry->translateFieldName("sAddress", obj->sAddress));
-    values.push_back(qry->translateFieldName("sLocation", obj->sLocation));
-    values.push_back(qry->translateFieldName("sCountry", obj->sCountry));
-    values.push_back(qry->translateFieldName("sEmail", obj->sEmail));
-    values.push_back(qry->translateFieldName("sUserNote", obj->sUserNote));
-    values.push_back(qry->translateFieldName("dtBirthday", obj->dtBirthday));
-    values.push_back(qry->translateFieldName("iLevel", obj->iLevel));
-    values.push_back(qry->translateFieldName("iFileLevel", obj->iFileLevel));
-    values.push_back(qry->translateFieldName("iMessageLevel", obj->iMessageLevel));
-    values.push_back(qry->translateFieldName("iLastFileArea", obj->iLastFileArea));
-    values.push_back(qry->translateFieldName("iLastMessageArea", obj->iLastMessageArea));
-    values.push_back(qry->translateFieldName("iTimeLeft", obj->iTimeLeft));
-    values.push_back(qry->translateFieldName("iTimeLimit", obj->iTimeLimit));
-    values.push_back(qry->translateFieldName("sRegColor", obj->sRegColor));
-    values.push_back(qry->translateFieldName("sPromptColor", obj->sPromptColor));
-    values.push_back(qry->translateFieldName("sInputColor", obj->sInputColor));
-    values.push_back(qry->translateFieldName("sInverseColor", obj->sInverseColor));
-    values.push_back(qry->translateFieldName("sStatColor", obj->sStatColor));
-    values.push_back(qry->translateFieldName("sBoxColor", obj->sBoxColor));    
-    values.push_back(qry->translateFieldName("iFilePoints", obj->iFilePoints));
-    values.push_back(qry->translateFieldName("iPostCallRatio", obj->iPostCallRatio));
-    values.push_back(qry->translateFieldName("sMenuPromptName", obj->sMenuPromptName));
-    values.push_back(qry->translateFieldName("iMenuSelected", obj->iMenuSelected));
-    values.push_back(qry->translateFieldName("iStatusSelected", obj->iStatusSelected));
-    values.push_back(qry->translateFieldName("bAnsi", obj->bAnsi));
-    values.push_back(qry->translateFieldName("bBackSpaceVt100", obj->bBackSpaceVt100));
-    values.push_back(qry->translateFieldName("iNuvVotesYes", obj->iNuvVotesYes));
-    values.push_back(qry->translateFieldName("iNuvVotesNo", obj->iNuvVotesNo));
-    values.push_back(qry->translateFieldName("dtPassChangeDate", obj->dtPassChangeDate));
-    values.push_back(qry->translateFieldName("dtLastReplyDate", obj->dtLastReplyDate));
-    values.push_back(qry->translateFieldName("bScrollFL", obj->bAnsi));
-    values.push_back(qry->translateFieldName("iCSPassChange", obj->iCSPassChange));
-    values.push_back(qry->translateFieldName("iControlFlags1", obj->iControlFlags1));
-    values.push_back(qry->translateFieldName("iControlFlags2", obj->iControlFlags2));
-    values.push_back(qry->translateFieldName("bWanted", obj->bWanted));
-    values.push_back(qry->translateFieldName("sHeaderType", obj->sHeaderType));
-    values.push_back(qry->translateFieldName("iLastMesConf", obj->iLastMesConf));
-    values.push_back(qry->translateFieldName("iLastFileConf", obj->iLastFileConf));
-    values.push_back(qry->translateFieldName("dtExpirationDate", obj->dtExpirationDate));
-    values.push_back(qry->translateFieldName("sGender", obj->sGender));
-    values.push_back(qry->translateFieldName("dtFirstOn", obj->dtFirstOn));
-    values.push_back(qry->translateFieldName("bYesNoBars", obj->bYesNoBars));
-    values.push_back(qry->translateFieldName("iHackAttempts", obj->iHackAttempts));
-    values.push_back(qry->translateFieldName("bDoPause", obj->bDoPause));
-    values.push_back(qry->translateFieldName("bClearOrScroll", obj->bClearOrScroll));
-    values.push_back(qry->translateFieldName("bIgnoreTimeLimit", obj->bIgnoreTimeLimit));
-    values.push_back(qry->translateFieldName("bAllowPurge", obj->bAllowPurge));
-    values.push_back(qry->translateFieldName("iSecurityIndex", obj->iSecurityIndex));
-}
+    DAO_COLUMN(Users, sHandle),
+    DAO_COLUMN(Users, sRealName),
+    DAO_COLUMN(Users, sAddress),
+    DAO_COLUMN(Users, sLocation),
+    DAO_COLUMN(Users, sCountry),
+    DAO_COLUMN(Users, sEmail),
+    DAO_COLUMN(Users, sUserNote),
+    DAO_COLUMN(Users, dtBirthday),
+    DAO_COLUMN(Users, iLevel),
+    DAO_COLUMN(Users, iFileLevel),
+    DAO_COLUMN(Users, iMessageLevel),
+    DAO_COLUMN(Users, iLastFileArea),
+    DAO_COLUMN(Users, iLastMessageArea),
+    DAO_COLUMN(Users, iTimeLeft),
+    DAO_COLUMN(Users, iTimeLimit),
+    DAO_COLUMN(Users, sRegColor),
+    DAO_COLUMN(Users, sPromptColor),
+    DAO_COLUMN(Users, sInputColor),
+    DAO_COLUMN(Users, sInverseColor),
+    DAO_COLUMN(Users, sStatColor),
+    DAO_COLUMN(Users, sBoxColor),
+    DAO_COLUMN(Users, iFilePoints),
+    DAO_COLUMN(Users, iPostCallRatio),
+    DAO_COLUMN(Users, sMenuPromptName),
+    DAO_COLUMN(Users, iMenuSelected),
+    DAO_COLUMN(Users, iStatusSelected),
+    DAO_COLUMN(Users, bAnsi),
+    DAO_COLUMN(Users, bBackSpaceVt100),
+    DAO_COLUMN(Users, iNuvVotesYes),
+    DAO_COLUMN(Users, iNuvVotesNo),
+    DAO_COLUMN(Users, dtPassChangeDate),
+    DAO_COLUMN(Users, dtLastReplyDate),
+    DAO_COLUMN(Users, bScrollFL),
+    DAO_COLUMN(Users, iCSPassChange),
+    DAO_COLUMN(Users, iControlFlags1),
+    DAO_COLUMN(Users, iControlFlags2),
+    DAO_COLUMN(Users, bWanted),
+    DAO_COLUMN(Users, sHeaderType),
+    DAO_COLUMN(Users, iLastMesConf),
+    DAO_COLUMN(Users, iLastFileConf),
+    DAO_COLUMN(Users, dtExpirationDate),
+    DAO_COLUMN(Users, sGender),
+    DAO_COLUMN(Users, dtFirstOn),
+    DAO_COLUMN(Users, bYesNoBars),
+    DAO_COLUMN(Users, iHackAttempts),
+    DAO_COLUMN(Users, bDoPause),
+    DAO_COLUMN(Users, bClearOrScroll),
+    DAO_COLUMN(Users, bIgnoreTimeLimit),
+    DAO_COLUMN(Users, bAllowPurge),
+    DAO_COLUMN(Users, iSecurityIndex)
+};
+
+const size_t UsersDao::COLUMN_COUNT = sizeof(UsersDao::COLUMNS) / sizeof(UsersDao::COLUMNS[0]);
+
 
 /**
- * @brief (Callback) Create Record Insert Statement, returns query string 
- * @param qry
- * @param obj
- * @return 
+ * One Off Methods SQL Queries not included in the BaseDao
+ * (Below This Point)
  */
-std::string UsersDao::insertUsersQryString(std::string qry, user_ptr obj)
-{    
-    // Mprint statement to avoid injections.
-    std::string result = sqlite3_mprintf(qry.c_str(),
-        obj->sHandle.c_str(),
-        obj->sRealName.c_str(),
-        obj->sAddress.c_str(),
-        obj->sLocation.c_str(),
-        obj->sCountry.c_str(),
-        obj->sEmail.c_str(),
-        obj->sUserNote.c_str(),
-        obj->dtBirthday,
-        obj->iLevel,
-        obj->iFileLevel,
-        obj->iMessageLevel,
-        obj->iLastFileArea,
-        obj->iLastMessageArea,
-        obj->iTimeLeft,
-        obj->iTimeLimit,
-        obj->sRegColor.c_str(),
-        obj->sPromptColor.c_str(),
-        obj->sInputColor.c_str(),
-        obj->sInverseColor.c_str(),
-        obj->sStatColor.c_str(),
-        obj->sBoxColor.c_str(),
-        obj->iFilePoints,
-        obj->iPostCallRatio,
-        obj->sMenuPromptName.c_str(),
-        obj->iMenuSelected,
-        obj->iStatusSelected,
-        obj->bAnsi,
-        obj->bBackSpaceVt100,
-        obj->iNuvVotesYes,
-        obj->iNuvVotesNo,
-        obj->dtPassChangeDate,
-        obj->dtLastReplyDate,
-        obj->bAnsi,
-        obj->iCSPassChange,
-        obj->iControlFlags1,
-        obj->iControlFlags2,
-        obj->bWanted,
-        obj->sHeaderType.c_str(),
-        obj->iLastMesConf,
-        obj->iLastFileConf,
-        obj->dtExpirationDate,
-        obj->sGender.c_str(),
-        obj->dtFirstOn,
-        obj->bYesNoBars,
-        obj->iHackAttempts,
-        obj->bDoPause,
-        obj->bClearOrScroll,
-        obj->bIgnoreTimeLimit,
-        obj->bAllowPurge,
-        obj->iSecurityIndex
-    );
-
-    return result;
-}
-
+ 
+ 
 /**
- * @brief (CallBack) Update Existing Record. 
- * @param qry
- * @param obj
- * @return 
+ * @brief Load every User into the In Memory Directory for this Database.
+ * @return
  */
-std::string UsersDao::updateUsersQryString(std::string qry, user_ptr obj)
+user_directory_ptr UsersDao::loadUserDirectory()
 {
-    // Mprint statement to avoid injections.
-    std::string result = sqlite3_mprintf(qry.c_str(),
-        obj->sHandle.c_str(),
-        obj->sRealName.c_str(),
-        obj->sAddress.c_str(),
-        obj->sLocation.c_str(),
-        obj->sCountry.c_str(),
-        obj->sEmail.c_str(),
-        obj->sUserNote.c_str(),
-        obj->dtBirthday,
-        obj->iLevel,
-        obj->iFileLevel,
-        obj->iMessageLevel,
-        obj->iLastFileArea,
-        obj->iLastMessageArea,
-        obj->iTimeLeft,
-        obj->iTimeLimit,
-        obj->sRegColor.c_str(),
-        obj->sPromptColor.c_str(),
-        obj->sInputColor.c_str(),
-        obj->sInverseColor.c_str(),
-        obj->sStatColor.c_str(),
-        obj->sBoxColor.c_str(),
-        obj->iFilePoints,
-        obj->iPostCallRatio,
-        obj->sMenuPromptName.c_str(),
-        obj->iMenuSelected,
-        obj->iStatusSelected,
-        obj->bAnsi,
-        obj->bBackSpaceVt100,
-        obj->iNuvVotesYes,
-        obj->iNuvVotesNo,
-        obj->dtPassChangeDate,
-        obj->dtLastReplyDate,
-        obj->bAnsi,
-        obj->iCSPassChange,
-        obj->iControlFlags1,
-        obj->iControlFlags2,
-        obj->bWanted,
-        obj->sHeaderType.c_str(),
-        obj->iLastMesConf,
-        obj->iLastFileConf,
-        obj->dtExpirationDate,
-        obj->sGender.c_str(),
-        obj->dtFirstOn,
-        obj->bYesNoBars,
-        obj->iHackAttempts,
-        obj->bDoPause,
-        obj->bClearOrScroll,
-        obj->bIgnoreTimeLimit,
-        obj->bAllowPurge,
-        obj->iSecurityIndex,
-        obj->iId
-    );
+    // Filled before it's attached, lookups never see a partial directory.
+    user_directory_ptr directory(new UserDirectory());
+    long rows = baseStreamRecords("", nullptr, [directory](user_ptr user)
+    {
+        directory->upsertUser(user);
+        return true;
+    });
 
-    return result;
-}
+    if (rows < 0)
+    {
+        // Lookups stay on the database.
+        std::cout << "Error, unable to load the user directory" << std::endl;
+        return nullptr;
+    }
 
+    UserDirectory::attach(m_database.getDatabaseName(), directory);
+    std::cout << "User Directory Loaded: " << directory->getUserCount() << " users" << std::endl;
+    return directory;
+}
 
 /**
- * One Off Methods SQL Queries not included in the BaseDao
- * (Below This Point)
+ * @brief Directory Loaded for this Database, nullptr when lookups go to SQL.
+ * @return
  */
- 
- 
+user_directory_ptr UsersDao::getUserDirectory()
+{
+    return UserDirectory::find(m_database.getDatabaseName());
+}
+
 /**
  * @brief Return User Record By Handle.
  * @return
  */
 user_ptr UsersDao::getUserByHandle(std::string name)
 {
+    user_directory_ptr directory = getUserDirectory();
+    if (directory)
+    {
+        user_ptr user = directory->getUserByHandle(name);
+        return user ? user : user_ptr(new Users);
+    }
+
     user_ptr user(new Users);
 
     // Make Sure Database Reference is Connected
@@ -396,18 +268,15 @@ user_ptr UsersDao::getUserByHandle(std::string name)
         return user;
     }
 
-    // Build Query String
-    std::string queryString = sqlite3_mprintf("SELECT * FROM %Q WHERE sHandle = %Q; COLLATE NOCASE;",
-        m_strTableName.c_str(), name.c_str());
-
-    // Execute Query.
-    if (qry->getResult(queryString))
+    // Column is COLLATE NOCASE, prepared once per connection then only bound.
+    if (qry->prepare(baseSelectFrom() + " WHERE sHandle = ?;") && qry->bind(1, name)
+            && qry->getResult())
     {
         long rows = qry->getNumRows();
         if (rows > 0)
         {
             qry->fetchRow();
-            pullUsersResult(qry, user);
+            basePullResult(qry, user);
         }
         else
         {
@@ -428,6 +297,13 @@ user_ptr UsersDao::getUserByHandle(std::string name)
  */
 user_ptr UsersDao::getUserByRealName(std::string name)
 {
+    user_directory_ptr directory = getUserDirectory();
+    if (directory)
+    {
+        user_ptr user = directory->getUserByRealName(name);
+        return user ? user : user_ptr(new Users);
+    }
+
     user_ptr user(new Users);
 
     // Make Sure Database Reference is Connected
@@ -445,18 +321,15 @@ user_ptr UsersDao::getUserByRealName(std::string name)
         return user;
     }
 
-    // Build Query String
-    std::string queryString = sqlite3_mprintf("SELECT * FROM %Q WHERE sRealName = %Q COLLATE NOCASE;",
-        m_strTableName.c_str(), name.c_str());
-
-    // Execute Query.
-    if (qry->getResult(queryString))
+    // Column is COLLATE NOCASE, prepared once per connection then only bound.
+    if (qry->prepare(baseSelectFrom() + " WHERE sRealName = ?;") && qry->bind(1, name)
+            && qry->getResult())
     {
         long rows = qry->getNumRows();
         if (rows > 0)
         {
             qry->fetchRow();
-            pullUsersResult(qry, user);
+            basePullResult(qry, user);
         }
         else
         {
@@ -476,6 +349,13 @@ user_ptr UsersDao::getUserByRealName(std::string name)
  */
 user_ptr UsersDao::getUserByEmail(std::string email)
 {
+    user_directory_ptr directory = getUserDirectory();
+    if (directory)
+    {
+        user_ptr user = directory->getUserByEmail(email);
+        return user ? user : user_ptr(new Users);
+    }
+
     user_ptr user(new Users);
 
     // Make Sure Database Reference is Connected
@@ -493,18 +373,15 @@ user_ptr UsersDao::getUserByEmail(std::string email)
         return user;
     }
 
-    // Build Query String
-    std::string queryString = sqlite3_mprintf("SELECT * FROM %Q WHERE sEmail = %Q COLLATE NOCASE;",
-        m_strTableName.c_str(), email.c_str());
-
-    // create a test3 table
-    if (qry->getResult(queryString))
+    // Column is COLLATE NOCASE, prepared once per connection then only bound.
+    if (qry->prepare(baseSelectFrom() + " WHERE sEmail = ?;") && qry->bind(1, email)
+            && qry->getResult())
     {
         long rows = qry->getNumRows();
         if (rows > 0)
         {
             qry->fetchRow();
-            pullUsersResult(qry, user);
+            basePullResult(qry, user);
         }
         else
         {
@@ -525,53 +402,136 @@ user_ptr UsersDao::getUserByEmail(std::string email)
  */
 std::vector<user_ptr> UsersDao::getUsersByWildcard(std::string filter)
 {
-    user_ptr obj(new Users());
     std::vector<user_ptr> list;
+    streamUsersPage(filter, -1, 0, [&list](user_ptr user)
+    {
+        list.push_back(user_ptr(new Users(*user)));
+        return true;
+    });
 
-    // Make Sure Database Reference is Connected
-    if (!m_database.isConnected())
+    return list;
+}
+
+/**
+ * @brief Stream a Page of the User Listing, only the rows shown are read.
+ *        Filtered listings are ordered by Handle, otherwise by Id.
+ * @param filter Handle WildCard, empty for all users.
+ * @param limit  -1 for no limit.
+ * @param offset
+ * @param visitor
+ * @return Rows Visited, -1 on error.
+ */
+long UsersDao::streamUsersPage(std::string filter, long limit, long offset, record_visitor visitor)
+{
+    if (filter.size() == 0)
     {
-        std::cout << "Error, Database is not connected!" << std::endl;
-        return list;
+        return baseStreamRecordsPage("ORDER BY iId", nullptr, limit, offset, visitor);
     }
 
-    // Create Pointer and Connect Query Object to Database.
-    query_ptr qry(new SQLW::Query(m_database));
-    if (!qry->isConnected())
+    // Replace * with %
+    std::replace(filter.begin(), filter.end(), '*', '%');
+    return baseStreamRecordsPage("WHERE sHandle like ? ORDER BY sHandle COLLATE NOCASE asc, iId",
+                                 [filter](query_ptr qry)
     {
-        std::cout << "Error, Query has no connection to the database" << std::endl;
-        return list;
+        return qry->bind(1, filter);
+    },
+    limit, offset, visitor);
+}
+
+/**
+ * @brief Count of Users in the Listing
+ * @param filter Handle WildCard, empty for all users.
+ * @return
+ */
+long UsersDao::getUsersCount(std::string filter)
+{
+    if (filter.size() == 0)
+    {
+        return baseCountRecords("", nullptr);
     }
 
     // Replace * with %
-    std::replace( filter.begin(), filter.end(), '*', '%');
+    std::replace(filter.begin(), filter.end(), '*', '%');
+    return baseCountRecords("WHERE sHandle like ?", [filter](query_ptr qry)
+    {
+        return qry->bind(1, filter);
+    });
+}
 
-    // Build Query String
-    std::string queryString = sqlite3_mprintf("SELECT * FROM %Q WHERE sHandle like %Q ORDER BY sHandle COLLATE NOCASE asc;",
-        m_strTableName.c_str(), filter.c_str());
+/**
+ * @brief Next or Previous User in Listing order (Keyset), iId is -1 at either end.
+ * @param filter Handle WildCard, empty for all users.
+ * @param user   Current User
+ * @param is_next
+ * @return
+ */
+user_ptr UsersDao::getAdjacentUser(std::string filter, user_ptr user, bool is_next)
+{
+    user_ptr adjacent(new Users());
+    record_visitor visitor = [adjacent](user_ptr row)
+    {
+        *adjacent = *row;
+        return false;
+    };
 
-    // Execute Query.
-    if (qry->getResult(queryString))
+    std::string compare = is_next ? ">" : "<";
+    std::string order = is_next ? "asc" : "desc";
+    if (filter.size() == 0)
     {
-        long rows = qry->getNumRows();
-        if (rows > 0)
+        baseStreamRecords("WHERE iId " + compare + " ? ORDER BY iId " + order + " LIMIT 1",
+                          [user](query_ptr qry)
         {
-            while(qry->fetchRow())
-            {
-                obj.reset(new Users());
-                pullUsersResult(qry, obj);
-                list.push_back(obj);
-            }
-        }
-        else
+            return qry->bind(1, user->iId);
+        },
+        visitor);
+        return adjacent;
+    }
+
+    // Replace * with %
+    std::replace(filter.begin(), filter.end(), '*', '%');
+    baseStreamRecords("WHERE sHandle like ? AND (sHandle " + compare + " ? OR (sHandle = ? AND iId " + compare + " ?)) "
+                      "ORDER BY sHandle COLLATE NOCASE " + order + ", iId " + order + " LIMIT 1",
+                      [filter, user](query_ptr qry)
+    {
+        return qry->bind(1, filter) && qry->bind(2, user->sHandle) && qry->bind(3, user->sHandle)
+               && qry->bind(4, user->iId);
+    },
+    visitor);
+    return adjacent;
+}
+
+/**
+ * @brief Zero based Position of a User in Listing order.
+ * @param filter Handle WildCard, empty for all users.
+ * @param user
+ * @return -1 if the User is not in the Listing.
+ */
+long UsersDao::getUserPosition(std::string filter, user_ptr user)
+{
+    if (filter.size() == 0)
+    {
+        return baseCountRecords("WHERE iId < ?", [user](query_ptr qry)
         {
-            std::cout << "Error, getUsersByWildcard Returned Rows: " << rows << std::endl;
-        }
+            return qry->bind(1, user->iId);
+        });
     }
-    else
+
+    // Replace * with %
+    std::replace(filter.begin(), filter.end(), '*', '%');
+    long matched = baseCountRecords("WHERE iId = ? AND sHandle like ?", [filter, user](query_ptr qry)
     {
-        std::cout << "Error, getResult()" << std::endl;
+        return qry->bind(1, user->iId) && qry->bind(2, filter);
+    });
+
+    if (matched != 1)
+    {
+        return -1;
     }
 
-    return list;    
+    return baseCountRecords("WHERE sHandle like ? AND (sHandle < ? OR (sHandle = ? AND iId < ?))",
+                            [filter, user](query_ptr qry)
+    {
+        return qry->bind(1, filter) && qry->bind(2, user->sHandle) && qry->bind(3, user->sHandle)
+               && qry->bind(4, user->iId);
+    });
 }
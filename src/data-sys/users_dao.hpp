@@ -3,6 +3,7 @@
 
 #include "../model-sys/users.hpp"
 #include "../data-sys/base_dao.hpp"
+#include "../user_directory.hpp"
 
 #include <memory>
 #include <vector>
@@ -121,18 +122,8 @@ public:
         // CREATE INDEX `IDX_testtbl_Name` ON `testtbl` (`Name` COLLATE UTF8CI)
         m_cmdDropTable = "DROP TABLE IF EXISTS " + m_strTableName + "; ";
         
-        // Setup the CallBack for Result Field Mapping
-        m_result_callback = std::bind(&UsersDao::pullUsersResult, this, 
-            std::placeholders::_1, std::placeholders::_2);
-            
-        m_columns_callback = std::bind(&UsersDao::fillUsersColumnValues, this, 
-            std::placeholders::_1, std::placeholders::_2, std::placeholders::_3);
-            
-        m_insert_callback = std::bind(&UsersDao::insertUsersQryString, this, 
-            std::placeholders::_1, std::placeholders::_2);
-        
-        m_update_callback = std::bind(&UsersDao::updateUsersQryString, this, 
-            std::placeholders::_1, std::placeholders::_2);
+        // Typed Columns, Insert, Update and Select statements are generated once.
+        baseSetColumns(COLUMNS, COLUMN_COUNT);
     }
 
     ~UsersDao()
@@ -212,41 +203,16 @@ public:
 
     
     /**
-     * Base Dao Call Back for Object Specific Data Mappings
+     * Column Descriptors for Typed Statements
      * (Below This Point)
      */
-     
-     
-    /**
-     * @brief (Callback) Create Record Insert Statement, returns query string 
-     * @param qry
-     * @param obj
-     * @return 
-     */
-    std::string insertUsersQryString(std::string qry, user_ptr obj);
 
-    /**
-     * @brief (CallBack) Update Existing Record. 
-     * @param qry
-     * @param obj
-     * @return 
-     */
-    std::string updateUsersQryString(std::string qry, user_ptr obj);
-    
-    /**
-     * @brief (CallBack) Pulls results by FieldNames into their Class Variables. 
-     * @param qry
-     * @param obj
-     */
-    void pullUsersResult(query_ptr qry, user_ptr obj);
 
     /**
-     * @brief (Callback) for Insert Statement translates to (Column, .. ) VALUES (%d, %Q,)
-     * @param qry
-     * @param obj
-     * @param values
-     */ 
-    void fillUsersColumnValues(query_ptr qry, user_ptr obj, std::vector< std::pair<std::string, std::string> > &values);
+     * @brief Columns in Table order, iId is implied as the first column.
+     */
+    static const DaoColumn<Users> COLUMNS[];
+    static const size_t COLUMN_COUNT;
 
 
     /**
@@ -255,6 +221,13 @@ public:
      */
      
      
+    /**
+     * @brief Load every User into the In Memory Directory for this Database.
+     *        Handle, Real Name, Email and Id lookups are then answered from memory.
+     * @return
+     */
+    user_directory_ptr loadUserDirectory();
+
     /**
      * @brief Return User Record By Handle.
      * @return
@@ -279,6 +252,49 @@ public:
      */
     std::vector<user_ptr> getUsersByWildcard(std::string filter);
 
+    /**
+     * @brief Stream a Page of the User Listing, only the rows shown are read.
+     *        Filtered listings are ordered by Handle, otherwise by Id.
+     * @param filter Handle WildCard, empty for all users.
+     * @param limit  -1 for no limit.
+     * @param offset
+     * @param visitor
+     * @return Rows Visited, -1 on error.
+     */
+    long streamUsersPage(std::string filter, long limit, long offset, record_visitor visitor);
+
+    /**
+     * @brief Count of Users in the Listing
+     * @param filter Handle WildCard, empty for all users.
+     * @return
+     */
+    long getUsersCount(std::string filter);
+
+    /**
+     * @brief Next or Previous User in Listing order (Keyset), iId is -1 at either end.
+     * @param filter Handle WildCard, empty for all users.
+     * @param user   Current User
+     * @param is_next
+     * @return
+     */
+    user_ptr getAdjacentUser(std::string filter, user_ptr user, bool is_next);
+
+    /**
+     * @brief Zero based Position of a User in Listing order.
+     * @param filter Handle WildCard, empty for all users.
+     * @param user
+     * @return -1 if the User is not in the Listing.
+     */
+    long getUserPosition(std::string filter, user_ptr user);
+
+private:
+
+    /**
+     * @brief Directory Loaded for this Database, nullptr when lookups go to SQL.
+     * @return
+     */
+    user_directory_ptr getUserDirectory();
+
 };
 
 // Handle to Database Queries
@@ -0,0 +1,286 @@
+#ifndef DATABASE_EXECUTOR_HPP
+#define DATABASE_EXECUTOR_HPP
+
+#include "async_completion.hpp"
+#include "io_service.hpp"
+
+#include "libSqliteWrapped.h"
+
+#include <iostream>
+#include <string>
+#include <algorithm>
+#include <vector>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <functional>
+#include <chrono>
+#include <memory>
+
+class DatabaseExecutor;
+typedef std::shared_ptr<DatabaseExecutor> database_executor_ptr;
+
+/**
+ * @class DatabaseExecutor
+ * @author Michael Griffin
+ * @date 17/10/2026
+ * @file database_executor.hpp
+ * @brief Runs DAO calls on dedicated Database threads, each with it's own connection.
+ *        Sessions queue work instead of blocking their IOService thread on a slow query
+ *        or lock wait. Results come back through AsyncCompletion.
+ *        Queue depth, wait and run times are kept per method name.
+ */
+class DatabaseExecutor
+{
+public:
+
+    /**
+     * @brief Metrics per Method, wait is queued till started, run is the DAO call itself.
+     */
+    struct MethodStats
+    {
+        MethodStats()
+            : calls(0)
+            , wait_total_ms(0)
+            , wait_max_ms(0)
+            , run_total_ms(0)
+            , run_max_ms(0)
+        { }
+
+        unsigned long calls;
+        long          wait_total_ms;
+        long          wait_max_ms;
+        long          run_total_ms;
+        long          run_max_ms;
+    };
+
+    /**
+     * @class Request
+     * @author Michael Griffin
+     * @date 17/10/2026
+     * @file database_executor.hpp
+     * @brief Handle to Queued Work, cancelling only drops the callback,
+     *        the work itself still runs so writes are not lost.
+     */
+    class Request : public AsyncCompletion
+    {
+    public:
+        Request(IOService &io_service, const std::string &method)
+            : AsyncCompletion(io_service)
+            , m_method(method)
+        { }
+
+        std::string                           m_method;
+        std::function<void(SQLW::Database &)> m_work;
+        std::chrono::steady_clock::time_point m_queued;
+    };
+    typedef std::shared_ptr<Request> request_ptr;
+
+    DatabaseExecutor(const std::string &database_file, int worker_count)
+        : m_database_file(database_file)
+        , m_worker_count(worker_count > 0 ? worker_count : 1)
+        , m_is_running(false)
+        , m_is_accepting(true)
+    { }
+
+    ~DatabaseExecutor()
+    {
+        std::cout << "~DatabaseExecutor" << std::endl;
+        shutdown();
+    }
+
+    /**
+     * @brief Start the Database Threads.
+     */
+    void start()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_is_running || !m_is_accepting)
+        {
+            return;
+        }
+        m_is_running = true;
+        for (int i = 0; i < m_worker_count; i++)
+        {
+            m_workers.push_back(std::thread(&DatabaseExecutor::run, this));
+        }
+    }
+
+    /**
+     * @brief Stop accepting work, finish whatever is queued then join the threads.
+     */
+    void shutdown()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_is_accepting = false;
+            m_is_running = false;
+        }
+        m_condition.notify_all();
+
+        for (std::thread &worker : m_workers)
+        {
+            if (worker.joinable())
+            {
+                worker.join();
+            }
+        }
+        m_workers.clear();
+    }
+
+    /**
+     * @brief Queue Work for a Database Thread.
+     *        The callback is executed on the IOService thread with the result,
+     *        unless the returned request has been cancelled or released first.
+     * @param io_service
+     * @param method Name the metrics are kept under, ie. "UsersDao::insertRecord"
+     * @param work Runs on the database thread with it's own connection.
+     * @param callback
+     * @return Keep this while waiting on the callback, nullptr once shutdown.
+     */
+    template <class Result>
+    request_ptr execute(IOService &io_service, const std::string &method,
+                        std::function<Result(SQLW::Database &)> work,
+                        std::function<void(Result)> callback)
+    {
+        request_ptr request(new Request(io_service, method));
+
+        // Result is filled on the database thread, read back on the IOService thread.
+        std::shared_ptr<Result> result(new Result());
+        request->m_work = [work, result](SQLW::Database &database)
+        {
+            *result = work(database);
+        };
+        if (callback)
+        {
+            request->m_completion = [callback, result]()
+            {
+                callback(*result);
+            };
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (!m_is_accepting)
+            {
+                std::cout << "DatabaseExecutor shutdown, dropped: " << method << std::endl;
+                return nullptr;
+            }
+            request->m_queued = std::chrono::steady_clock::now();
+            m_requests.push_back(request);
+        }
+        m_condition.notify_one();
+        return request;
+    }
+
+    /**
+     * @brief Number of Requests waiting for a Database Thread
+     * @return
+     */
+    size_t getQueueDepth()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_requests.size();
+    }
+
+    /**
+     * @brief Copy of the Metrics per Method
+     * @return
+     */
+    std::map<std::string, MethodStats> getMethodStats()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_method_stats;
+    }
+
+private:
+
+    /**
+     * @brief Database Thread, drains the queue before exiting on shutdown.
+     */
+    void run()
+    {
+        // Only this thread uses the connection.
+        SQLW::Database database(m_database_file);
+        database.setMaxConnections(1);
+        database.setConnectionPragmas(SQLW::Database::POOL_PRAGMAS);
+
+        while (true)
+        {
+            request_ptr request;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_condition.wait(lock, [this]
+                {
+                    return !m_is_running || !m_requests.empty();
+                });
+
+                if (m_requests.empty())
+                {
+                    return;
+                }
+
+                request = m_requests.front();
+                m_requests.pop_front();
+            }
+
+            processRequest(database, request);
+        }
+    }
+
+    /**
+     * @brief Run the Work and Post the Completion back to the IOService.
+     * @param database
+     * @param request
+     */
+    void processRequest(SQLW::Database &database, request_ptr request)
+    {
+        std::chrono::steady_clock::time_point started = std::chrono::steady_clock::now();
+        try
+        {
+            request->m_work(database);
+        }
+        catch (std::exception &ex)
+        {
+            std::cout << "Exception DatabaseExecutor " << request->m_method << ": " << ex.what() << std::endl;
+        }
+        std::chrono::steady_clock::time_point finished = std::chrono::steady_clock::now();
+
+        updateMethodStats(request->m_method,
+                          std::chrono::duration_cast<std::chrono::milliseconds>(started - request->m_queued).count(),
+                          std::chrono::duration_cast<std::chrono::milliseconds>(finished - started).count());
+
+        AsyncCompletion::post(request);
+    }
+
+    /**
+     * @brief Add Timings to the Method Metrics
+     * @param method
+     * @param wait_ms
+     * @param run_ms
+     */
+    void updateMethodStats(const std::string &method, long wait_ms, long run_ms)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        MethodStats &stats = m_method_stats[method];
+        ++stats.calls;
+        stats.wait_total_ms += wait_ms;
+        stats.run_total_ms += run_ms;
+        stats.wait_max_ms = std::max(stats.wait_max_ms, wait_ms);
+        stats.run_max_ms = std::max(stats.run_max_ms, run_ms);
+    }
+
+    std::string                           m_database_file;
+    int                                   m_worker_count;
+    bool                                  m_is_running;
+    bool                                  m_is_accepting;
+    std::mutex                            m_mutex;
+    std::condition_variable               m_condition;
+    std::deque<request_ptr>               m_requests;
+    std::vector<std::thread>              m_workers;
+    std::map<std::string, MethodStats>    m_method_stats;
+};
+
+#endif // DATABASE_EXECUTOR_HPP
@@ -1,10 +1,10 @@
 #ifndef DEADLINE_TIMER_HPP
 #define DEADLINE_TIMER_HPP
 
-#include "communicator.hpp"
+#include "io_service.hpp"
+#include "timer_wheel.hpp"
 
 #include <iostream>
-#include <future>
 #include <thread>
 #include <chrono>
 #include <memory>
@@ -17,13 +17,16 @@
  * @date 17/02/2018
  * @file deadline_timer.hpp
  * @brief Timer class for Wait and AsyncWait.
+ *        AsyncWait is a handle onto the IOService's Timer Wheel, callbacks
+ *        are executed on the IOService thread the timer was created for.
  */
 class DeadlineTimer
 {
 public:
-    explicit DeadlineTimer() 
+    explicit DeadlineTimer(IOService &io_service)
         : m_expires_from_now(0)
-        , m_cancellation_token(false)
+        , m_timer_wheel(io_service.getTimerWheel())
+        , m_entry()
     { 
         std::cout << "DeadlineTimer Created" << std::endl;
     }
@@ -31,14 +34,12 @@ public:
     ~DeadlineTimer()
     { 
         std::cout << "~DeadlineTimer" << std::endl;
-        std::vector<std::future<void>>().swap(m_future_list);
+        cancel();
     }
 
     typedef std::function<void(int)> function_callback;
     
     int m_expires_from_now;
-    std::atomic_bool m_cancellation_token;
-    std::vector<std::future<void>> m_future_list;
             
     /**
      * @brief Sets the waiting period for the timer.
@@ -51,49 +52,38 @@ public:
             
     /**
      * @brief Async Non-Block Wait (MilliSeconds) with Callback
+     *        If one is already waiting, it's replaced with the new one.
      * @param callback
      */
     template <typename Callback>
     void asyncWait(const Callback &callback)
     {   
-        int i = m_expires_from_now;      
-        //std::atomic_bool cancel = &m_cancellation_token;
-        // If one exist, remove and re-create it.
-        checkAsyncClean();
-        
-        // Add to container to keep in an active scope
-        m_future_list.emplace_back(
-            std::async(std::launch::async, [i, callback, this]() { 
-                std::this_thread::sleep_for(std::chrono::milliseconds(i));
-                function_callback fncCallBack = callback;          
-      
-                // If not Canceled, Execute CallBack with a default status, update lateron
-                // Cancel seems to still execute, but i'm thinking we still need to execute
-                // On Double ESC's HITS.
-                if (!m_cancellation_token)
-                {
-                    fncCallBack(0);                    
-                }
-            })
-        );
+        timer_wheel_ptr timer_wheel = m_timer_wheel.lock();
+        if (!timer_wheel)
+        {
+            return;
+        }
+
+        // Execute CallBack with a default status, update lateron
+        function_callback fncCallBack = callback;
+        timer_wheel->schedule(&m_entry, m_expires_from_now, [fncCallBack]()
+        {
+            fncCallBack(0);
+        });
     }
     
     /**
-     * @brief Clean any unfinished, or cancels on overwrites with new.
+     * @brief Cancel a waiting AsyncWait, the callback is not executed.
+     * @return true if the timer was waiting
      */
-    void checkAsyncClean()
+    bool cancel()
     {
-        if (m_future_list.size() > 0)
+        timer_wheel_ptr timer_wheel = m_timer_wheel.lock();
+        if (timer_wheel)
         {
-            m_cancellation_token = true;
-            std::cout << "Async Canceled OK" << std::endl;
-            m_future_list.pop_back();
-            m_cancellation_token = false;
-        }
-        else 
-        {
-            m_cancellation_token = false;
+            return timer_wheel->cancel(&m_entry);
         }
+        return false;
     }
        
     /**
@@ -103,6 +93,11 @@ public:
     {
         std::this_thread::sleep_for(std::chrono::milliseconds(m_expires_from_now));
     }
+
+private:
+
+    timer_wheel_wptr  m_timer_wheel;
+    TimerWheel::Entry m_entry;
     
 };
 
@@ -5,8 +5,6 @@
 
 #include <iostream>
 #include <string>
-#include <sstream>
-#include <iomanip>
 
 Encrypt::Encrypt()
 {
@@ -42,6 +40,33 @@ void EVP_MD_CTX_free(EVP_MD_CTX *ctx)
 
 #endif
 
+namespace
+{
+    const char HEX_DIGITS[] = "0123456789abcdef";
+
+    /**
+     * @brief SHA1 Digest, resolved once instead of a name lookup on every hash.
+     * @return
+     */
+    const EVP_MD *getSHA1Digest()
+    {
+        static const EVP_MD *md = EVP_sha1();
+        return md;
+    }
+
+    /**
+     * @brief SHA512 Digest for PBKDF2, resolved once.
+     * @return
+     */
+    const EVP_MD *getSHA512Digest()
+    {
+        static const EVP_MD *md = EVP_sha512();
+        return md;
+    }
+}
+
+const std::string Encrypt::PBKDF2_PREFIX = "pbkdf2-sha512$";
+
 /**
  * @brief Unsigned Char to Hex
  * @param inchar
@@ -49,9 +74,24 @@ void EVP_MD_CTX_free(EVP_MD_CTX *ctx)
  */
 std::string Encrypt::unsignedToHex(unsigned char inchar)
 {
-    std::ostringstream oss(std::ostringstream::out);
-    oss << std::setw(2) << std::setfill('0') << std::hex << static_cast<int>(inchar);
-    return oss.str();
+    return bytesToHex(&inchar, 1);
+}
+
+/**
+ * @brief Bytes to Lowercase Hex, table lookup per nibble.
+ * @param data
+ * @param length
+ * @return
+ */
+std::string Encrypt::bytesToHex(const unsigned char *data, size_t length)
+{
+    std::string result(length * 2, '0');
+    for(size_t i = 0; i < length; i++)
+    {
+        result[i * 2]     = HEX_DIGITS[data[i] >> 4];
+        result[i * 2 + 1] = HEX_DIGITS[data[i] & 0x0f];
+    }
+    return result;
 }
 
 
@@ -62,53 +102,34 @@ std::string Encrypt::unsignedToHex(unsigned char inchar)
  */
 std::string Encrypt::SHA1(std::string key, std::string salt)
 {
-    bool EncryptOk = true;
-
-    // Setup Encryption for User Password.
-    EVP_MD_CTX *mdctx = EVP_MD_CTX_new();       
-    
-    const EVP_MD *md;
-    
-    unsigned char md_value[EVP_MAX_MD_SIZE]= {0};
-    unsigned int  md_len = 0;
-
-    OpenSSL_add_all_digests();
-
-    md = EVP_get_digestbyname("SHA1");
+    const EVP_MD *md = getSHA1Digest();
     if(!md)
     {
-        EncryptOk = false;
-    }
-
-    std::string salt_result = "";
-    for(unsigned char c : salt)
-    {
-        salt_result += unsignedToHex(c);
+        std::cout << "SHA1 failed" << std::endl;
+        return "";
     }
 
-    std::string result = "";
-    if(EncryptOk)
-    {        
-        EVP_MD_CTX_init(mdctx);
-        EVP_DigestInit_ex(mdctx, md, NULL);
-        EVP_DigestUpdate(mdctx, (char *)salt_result.c_str(), salt_result.size());
-        EVP_DigestUpdate(mdctx, (char *)key.c_str(), key.size());
-        EVP_DigestFinal_ex(mdctx, md_value, &md_len);     
-        
-        EVP_MD_CTX_free(mdctx);
-
-        for(size_t i = 0; i < md_len; i++)
-        {
-            result += unsignedToHex(md_value[i]);
-        }
-    }
-    else
+    // Setup Encryption for User Password.
+    EVP_MD_CTX *mdctx = EVP_MD_CTX_new();
+    if(!mdctx)
     {
         std::cout << "SHA1 failed" << std::endl;
+        return "";
     }
 
-    EVP_cleanup();
-    return result;
+    unsigned char md_value[EVP_MAX_MD_SIZE]= {0};
+    unsigned int  md_len = 0;
+
+    std::string salt_result = bytesToHex((const unsigned char *)salt.data(), salt.size());
+
+    EVP_MD_CTX_init(mdctx);
+    EVP_DigestInit_ex(mdctx, md, NULL);
+    EVP_DigestUpdate(mdctx, (char *)salt_result.c_str(), salt_result.size());
+    EVP_DigestUpdate(mdctx, (char *)key.c_str(), key.size());
+    EVP_DigestFinal_ex(mdctx, md_value, &md_len);
+
+    EVP_MD_CTX_free(mdctx);
+    return bytesToHex(md_value, md_len);
 }
 
 
@@ -116,39 +137,30 @@ std::string Encrypt::SHA1(std::string key, std::string salt)
  * @brief PKCS5_PBKDF2 password encryption
  * @param key
  * @param salt
+ * @param iterations
  */
-std::string Encrypt::PKCS5_PBKDF2(std::string key, std::string salt)
+std::string Encrypt::PKCS5_PBKDF2(std::string key, std::string salt, int iterations)
 {
-    size_t i;
-    unsigned char *out;
-    out = (unsigned char *) malloc(sizeof(unsigned char) * SHA512_OUTPUT_BYTES);
+    unsigned char out[SHA512_OUTPUT_BYTES] = {0};
 
-    std::string salt_result = "";
-    for(i = 0; i < salt.size(); i++)
-    {
-        salt_result += unsignedToHex(salt[i]);
-    }
+    std::string salt_result = bytesToHex((const unsigned char *)salt.data(), salt.size());
 
     std::string result = "";
     if(PKCS5_PBKDF2_HMAC(
         (const char *)key.c_str(), key.size(),
         (const unsigned char *)salt_result.c_str(), salt_result.size(),
-        ITERATION,
-        EVP_sha512(),
+        iterations,
+        getSHA512Digest(),
         SHA512_OUTPUT_BYTES,
-        (unsigned char *)out) != 0)
+        out) != 0)
     {
-        for(i = 0; i < SHA512_OUTPUT_BYTES; i++)
-        {
-            result += unsignedToHex(out[i]);
-        }
+        result = bytesToHex(out, SHA512_OUTPUT_BYTES);
     }
     else
     {
         std::cout << "PKCS5_PBKDF2_HMAC failed" << std::endl;
     }
 
-    free(out);
     return result;
 }
 
@@ -170,10 +182,62 @@ std::string Encrypt::generate_salt(std::string key, std::string salt)
  * @param key
  * @param salt
  */
-std::string Encrypt::generate_password(std::string key, std::string salt)
+std::string Encrypt::generate_password(std::string key, std::string salt, int iterations)
 {
-    std::string generated_password = PKCS5_PBKDF2(key, salt);
-    return generated_password;
+    std::string generated_password = PKCS5_PBKDF2(key, salt, iterations);
+    if(iterations == ITERATION || generated_password.size() == 0)
+    {
+        return generated_password;
+    }
+    return PBKDF2_PREFIX + std::to_string(iterations) + "$" + generated_password;
+}
+
+
+/**
+ * @brief Verify a password against a stored hash, with the iterations it was created with.
+ * @param key
+ * @param salt
+ * @param password_hash
+ * @return
+ */
+bool Encrypt::verify_password(std::string key, std::string salt, std::string password_hash)
+{
+    int iterations = hash_iterations(password_hash);
+    if(iterations <= 0)
+    {
+        return false;
+    }
+    return compare(generate_password(key, salt, iterations), password_hash);
+}
+
+
+/**
+ * @brief Iterations a stored hash was created with
+ * @param password_hash
+ * @return ITERATION for plain hex hashes, 0 if the hash is malformed.
+ */
+int Encrypt::hash_iterations(const std::string &password_hash)
+{
+    if(password_hash.compare(0, PBKDF2_PREFIX.size(), PBKDF2_PREFIX) != 0)
+    {
+        return ITERATION;
+    }
+
+    int iterations = 0;
+    for(size_t i = PBKDF2_PREFIX.size(); i < password_hash.size(); i++)
+    {
+        char c = password_hash[i];
+        if(c == '$')
+        {
+            return iterations;
+        }
+        if(c < '0' || c > '9' || iterations > 100000000)
+        {
+            break;
+        }
+        iterations = iterations * 10 + (c - '0');
+    }
+    return 0;
 }
 
 
@@ -14,6 +14,10 @@ private:
 
 public:
 
+    // Hashes with their own work factor are stored as PBKDF2_PREFIX<iterations>$<hex>,
+    // plain hex hashes from before are ITERATION rounds.
+    static const std::string PBKDF2_PREFIX;
+
     explicit Encrypt();
     ~Encrypt();
 
@@ -31,12 +35,21 @@ public:
      */
     std::string SHA1(std::string key, std::string salt);
 
+    /**
+     * @brief Bytes to Lowercase Hex
+     * @param data
+     * @param length
+     * @return
+     */
+    static std::string bytesToHex(const unsigned char *data, size_t length);
+
     /**
      * @brief PKCS5_PBKDF2 password encryption
      * @param password
      * @param salt
+     * @param iterations
      */
-    std::string PKCS5_PBKDF2(std::string key, std::string salt);
+    std::string PKCS5_PBKDF2(std::string key, std::string salt, int iterations = ITERATION);
 
     /**
      * @brief generate salt hash key
@@ -47,10 +60,28 @@ public:
 
     /**
      * @brief generate password hash key
+     *        The default matches existing hashes, anything else is stored with its iterations.
      * @param password
      * @param salt
+     * @param iterations
+     */
+    std::string generate_password(std::string key, std::string salt, int iterations = ITERATION);
+
+    /**
+     * @brief Verify a password against a stored hash, with the iterations it was created with.
+     * @param key
+     * @param salt
+     * @param password_hash
+     * @return
+     */
+    bool verify_password(std::string key, std::string salt, std::string password_hash);
+
+    /**
+     * @brief Iterations a stored hash was created with
+     * @param password_hash
+     * @return ITERATION for plain hex hashes, 0 if the hash is malformed.
      */
-    std::string generate_password(std::string key, std::string salt);
+    static int hash_iterations(const std::string &password_hash);
 
     /**
      * @brief Compare valid password hash
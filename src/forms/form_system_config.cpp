@@ -43,6 +43,16 @@ bool FormSystemConfig::onEnter()
     setupBuildOptions("port_ssl", m_config->port_ssl);    
     setupBuildOptions("use_service_telnet", m_config->use_service_telnet);
     setupBuildOptions("use_service_ssl", m_config->use_service_ssl);       
+    setupBuildOptions("use_native_sockets", m_config->use_native_sockets);
+    setupBuildOptions("use_io_uring", m_config->use_io_uring);
+    setupBuildOptions("io_service_threads", m_config->io_service_threads);
+    setupBuildOptions("output_buffer_high_water", m_config->output_buffer_high_water);
+    setupBuildOptions("output_buffer_low_water", m_config->output_buffer_low_water);
+    setupBuildOptions("max_nodes", m_config->max_nodes);
+    setupBuildOptions("max_connections_per_address", m_config->max_connections_per_address);
+    setupBuildOptions("max_connections_per_minute", m_config->max_connections_per_minute);
+    setupBuildOptions("password_hash_iterations", m_config->password_hash_iterations);
+    setupBuildOptions("telnet_compression_level", m_config->telnet_compression_level);
 
     setupBuildOptions("directory_screens", m_config->directory_screens);
     setupBuildOptions("directory_boards", m_config->directory_boards);
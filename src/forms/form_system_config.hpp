@@ -56,6 +56,16 @@ namespace YAML
             node["port_ssl"] = rhs->port_ssl;
             node["use_service_telnet"] = rhs->use_service_telnet;
             node["use_service_ssl"] = rhs->use_service_ssl;
+            node["use_native_sockets"] = rhs->use_native_sockets;
+            node["use_io_uring"] = rhs->use_io_uring;
+            node["io_service_threads"] = rhs->io_service_threads;
+            node["output_buffer_high_water"] = rhs->output_buffer_high_water;
+            node["output_buffer_low_water"] = rhs->output_buffer_low_water;
+            node["max_nodes"] = rhs->max_nodes;
+            node["max_connections_per_address"] = rhs->max_connections_per_address;
+            node["max_connections_per_minute"] = rhs->max_connections_per_minute;
+            node["password_hash_iterations"] = rhs->password_hash_iterations;
+            node["telnet_compression_level"] = rhs->telnet_compression_level;
             node["directory_screens"] = rhs->directory_screens;
             node["directory_boards"] = rhs->directory_boards;
             node["directory_files"] = rhs->directory_files;
@@ -179,6 +189,16 @@ namespace YAML
             rhs->port_ssl                        = node["port_ssl"].as<int>();
             rhs->use_service_telnet              = node["use_service_telnet"].as<bool>();
             rhs->use_service_ssl                 = node["use_service_ssl"].as<bool>();
+            rhs->use_native_sockets              = node["use_native_sockets"].as<bool>();
+            rhs->use_io_uring                    = node["use_io_uring"].as<bool>();
+            rhs->io_service_threads              = node["io_service_threads"].as<int>();
+            rhs->output_buffer_high_water        = node["output_buffer_high_water"].as<int>();
+            rhs->output_buffer_low_water         = node["output_buffer_low_water"].as<int>();
+            rhs->max_nodes                       = node["max_nodes"].as<int>();
+            rhs->max_connections_per_address     = node["max_connections_per_address"].as<int>();
+            rhs->max_connections_per_minute      = node["max_connections_per_minute"].as<int>();
+            rhs->password_hash_iterations        = node["password_hash_iterations"].as<int>();
+            rhs->telnet_compression_level        = node["telnet_compression_level"].as<int>();
             rhs->directory_screens               = node["directory_screens"].as<std::string>();
             rhs->directory_boards                = node["directory_boards"].as<std::string>();
             rhs->directory_files                 = node["directory_files"].as<std::string>();
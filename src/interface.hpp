@@ -14,6 +14,8 @@
 // For Startup.
 #include <sdl2_net/SDL_net.hpp>
 #include <thread>
+#include <vector>
+#include <algorithm>
 
 class Interface;
 typedef std::unique_ptr<Interface> interface_ptr;
@@ -34,9 +36,9 @@ public:
      * @brief Create IO_Service Working thread for socket communications.
      * @return
      */
-    std::thread create_thread()
+    std::thread create_thread(IOService &io_service)
     {
-        return std::thread([&] { m_io_service.run(); });
+        return std::thread([&io_service] { io_service.run(); });
     }
 
     /**
@@ -44,14 +46,20 @@ public:
      * @param io_service
      * @param protocol
      * @param port
+     * @param config
      * @return
      */
-    Interface(IOService& io_service, std::string protocol, int port)
+    Interface(IOService& io_service, std::string protocol, int port, config_ptr config)
         : m_io_service(io_service)
+        , m_config(config)
         , m_session_manager(new SessionManager())
         , m_socket_acceptor(new SocketHandler())
+        , m_admission_control(new AdmissionControl(config->max_nodes,
+                                                   config->max_connections_per_address,
+                                                   config->max_connections_per_minute))
         , m_async_listener(new AsyncAcceptor(io_service, m_socket_acceptor))
         , m_protocol(protocol)
+        , m_next_service(0)
     {
 
         // Startup SDL NET.
@@ -62,12 +70,36 @@ public:
         }
 
         std::cout << "Interface Created" << std::endl;
-        // Start up worker thread of ASIO. We want socket communications in a separate thread.
-        // We only spawn a single thread for IO_Service on start up
-        m_thread = create_thread();
+
+        // Start up worker threads of ASIO. We want socket communications in a separate thread.
+        // The main IO_Service runs the listener and the first shard of sessions, each
+        // additional thread runs its own IO_Service with the sessions assigned to it.
+        int io_threads = m_config->io_service_threads;
+        if (io_threads <= 0)
+        {
+            io_threads = std::max(1u, std::thread::hardware_concurrency());
+        }
+
+        m_services.push_back(&m_io_service);
+        for (int i = 1; i < io_threads; i++)
+        {
+            m_worker_services.push_back(std::unique_ptr<IOService>(new IOService()));
+            m_services.push_back(m_worker_services.back().get());
+        }
+
+        for (IOService *service : m_services)
+        {
+            if (m_config->use_io_uring)
+            {
+                service->enableIoUring();
+            }
+            m_threads.push_back(create_thread(*service));
+        }
+
+        std::cout << "IO_Service Threads: " << m_services.size() << std::endl;
 
         // Setup Telnet Server Connection Listener.
-        if (!m_socket_acceptor->createTelnetAcceptor("127.0.0.1", port))
+        if (!m_socket_acceptor->createTelnetAcceptor("127.0.0.1", port, m_config->use_native_sockets))
         {
             std::cout << "Unable to start Telnet Acceptor" << std::endl;
             TheCommunicator::instance()->shutdown();
@@ -85,8 +117,14 @@ public:
     ~Interface()
     {
         std::cout << "~Interface" << std::endl;
-        m_io_service.stop();
-        m_thread.join();
+        for (IOService *service : m_services)
+        {
+            service->stop();
+        }
+        for (std::thread &thread : m_threads)
+        {
+            thread.join();
+        }
         SDLNet_Quit();
     }
 
@@ -106,6 +144,18 @@ public:
 
 private:
 
+    /**
+     * @brief Assign new connections to the IO_Services Round Robin
+     * Only called from handle_accept on the listener thread.
+     * @return
+     */
+    IOService &nextIOService()
+    {
+        IOService *service = m_services.at(m_next_service);
+        m_next_service = (m_next_service + 1) % m_services.size();
+        return *service;
+    }
+
     /**
      * @brief Callback on connections, creates new sessions
      * @param new_connection
@@ -116,16 +166,40 @@ private:
         if(!error)
         {
             std::cout << "TCP Connection accepted" << std::endl;
-            connection_ptr async_conn(new AsyncConnection(m_io_service, socket_handler));
+
+            // Admission Control, turn away floods before any Session work is done.
+            int reason = AdmissionControl::ADMIT_ACCEPTED;
+            std::string address = socket_handler->getRemoteAddress();
+            admission_ticket_ptr ticket = m_admission_control->admit(address, reason);
+            if (!ticket)
+            {
+                std::cout << "Connection rejected from " << address << ", reason: " << reason << std::endl;
+                std::string message = AdmissionControl::getRejectMessage(reason);
+                socket_handler->sendSocket((unsigned char *)message.c_str(), message.size());
+                socket_handler->close();
+                return;
+            }
+            socket_handler->setAdmissionTicket(ticket);
+
+            // Bound how much output can back up for a slow client.
+            if (m_config->output_buffer_high_water > 0)
+            {
+                socket_handler->setOutputWatermarks(m_config->output_buffer_high_water,
+                                                    std::max(0, m_config->output_buffer_low_water));
+            }
+
+            // MCCP2 is offered during negotiation when a level is set.
+            socket_handler->setCompressionLevel(m_config->telnet_compression_level);
+
+            // The Session stays on this IO_Service, keeping its callbacks in order.
+            IOService &io_service = nextIOService();
+            connection_ptr async_conn(new AsyncConnection(io_service, socket_handler));
 
             // Create DeadlineTimer and attach to new session
-            deadline_timer_ptr deadline_timer(new DeadlineTimer(
-                                                  //m_io_service,
-                                                  //socket_handler
-                                              ));
+            deadline_timer_ptr deadline_timer(new DeadlineTimer(io_service));
 
             // Create the new Session
-            session_ptr new_session = Session::create(m_io_service,
+            session_ptr new_session = Session::create(io_service,
                                       async_conn,
                                       deadline_timer,
                                       m_session_manager);
@@ -140,11 +214,18 @@ private:
     }
 
     IOService&          m_io_service;
+    config_ptr          m_config;
     session_manager_ptr m_session_manager;
     socket_handler_ptr  m_socket_acceptor;
+    admission_control_ptr m_admission_control;
     acceptor_ptr        m_async_listener;
     std::string         m_protocol;
-    std::thread         m_thread;
+
+    // IO_Service Shards, m_services[0] is m_io_service.
+    std::vector<IOService*>                 m_services;
+    std::vector<std::unique_ptr<IOService>> m_worker_services;
+    std::vector<std::thread>                m_threads;
+    std::vector<IOService*>::size_type      m_next_service;
 
 };
 
@@ -1,6 +1,7 @@
 #include "io_service.hpp"
 #include "common_io.hpp"
 #include "socket_handler.hpp"
+#include "io_uring_engine.hpp"
 
 
 #include <iostream>
@@ -9,18 +10,337 @@
 #include <thread>
 #include <chrono>
 #include <system_error>
+#include <cerrno>
+
+#ifdef __linux__
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#include <stdint.h>
+#endif
 
 IOService::IOService()
     : m_is_active(false)
+    , m_timer_wheel(new TimerWheel())
+    , m_epoll_fd(-1)
+    , m_wakeup_fd(-1)
+    , m_reactor_thread()
+    , m_is_io_uring_mode(false)
 {
     std::cout << "IOService Started" << std::endl;
+
+    // New timers may be sooner than the reactor's current wait.
+    m_timer_wheel->setNotify(std::bind(&IOService::wakeUp, this));
+
+#ifdef __linux__
+    // Setup the Reactor, if unavailable we fall back to Polling.
+    m_epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    if (m_epoll_fd == -1)
+    {
+        std::cout << "IOService epoll_create1 failed, using polling: " << strerror(errno) << std::endl;
+        return;
+    }
+
+    m_wakeup_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (m_wakeup_fd == -1)
+    {
+        std::cout << "IOService eventfd failed, using polling: " << strerror(errno) << std::endl;
+        close(m_epoll_fd);
+        m_epoll_fd = -1;
+        return;
+    }
+
+    struct epoll_event event;
+    memset(&event, 0, sizeof(event));
+    event.events = EPOLLIN;
+    event.data.fd = m_wakeup_fd;
+    if (epoll_ctl(m_epoll_fd, EPOLL_CTL_ADD, m_wakeup_fd, &event) == -1)
+    {
+        std::cout << "IOService epoll_ctl wakeup failed, using polling: " << strerror(errno) << std::endl;
+        close(m_wakeup_fd);
+        close(m_epoll_fd);
+        m_wakeup_fd = -1;
+        m_epoll_fd = -1;
+    }
+#endif
 }
 
 IOService::~IOService()
 {
     std::cout << "~IOService" << std::endl;
-    m_service_list.clear();
-    m_listener_list.clear();
+    m_timer_wheel->setNotify(nullptr);
+    clearJobs();
+
+#ifdef __linux__
+    if (m_wakeup_fd != -1)
+    {
+        close(m_wakeup_fd);
+    }
+    if (m_epoll_fd != -1)
+    {
+        close(m_epoll_fd);
+    }
+#endif
+}
+
+/**
+ * @Brief Always check all timers (Priority each iteration)
+ */
+void IOService::checkPriorityTimers()
+{
+    try
+    {
+        m_timer_wheel->process();
+    }
+    catch (std::exception &ex)
+    {
+        std::cout << "Exception Timer Callback: " << ex.what() << std::endl;
+    }
+}
+
+/**
+ * @brief Timer Wheel for DeadlineTimers run on this IOService
+ * @return
+ */
+timer_wheel_ptr IOService::getTimerWheel()
+{
+    return m_timer_wheel;
+}
+
+/**
+ * @brief Check if readiness events are available (epoll on Linux)
+ * @return
+ */
+bool IOService::isReactorMode() const
+{
+    return m_epoll_fd != -1;
+}
+
+/**
+ * @brief Switch to the io_uring Completion Engine, call before run().
+ *        Only available when built with USE_IO_URING on Linux.
+ * @return false if unavailable, the Reactor (epoll) is used.
+ */
+bool IOService::enableIoUring()
+{
+#if defined(USE_IO_URING) && defined(__linux__)
+    if (!isReactorMode() || m_is_active)
+    {
+        return false;
+    }
+
+    if (!m_io_uring)
+    {
+        m_io_uring.reset(new IoUringEngine());
+    }
+
+    m_is_io_uring_mode = m_io_uring->isActive();
+    if (!m_is_io_uring_mode)
+    {
+        m_io_uring.reset();
+    }
+    return m_is_io_uring_mode;
+#else
+    std::cout << "IOService built without USE_IO_URING, using the Reactor." << std::endl;
+    return false;
+#endif
+}
+
+/**
+ * @brief Check if the io_uring Completion Engine is in use.
+ * @return
+ */
+bool IOService::isIoUringMode() const
+{
+    return m_is_io_uring_mode;
+}
+
+/**
+ * @brief Register a Socket Handle with the Reactor (Edge Triggered)
+ * @param handle
+ */
+void IOService::attachSocketHandle(socket_handler_ptr handle)
+{
+#ifdef __linux__
+    if (!isReactorMode() || !handle || handle->isRegistered())
+    {
+        return;
+    }
+
+    // Sockets without a descriptor (SSH) are polled each pass instead.
+    int socket_descriptor = handle->getSocketDescriptor();
+    if (socket_descriptor == -1)
+    {
+        return;
+    }
+
+    struct epoll_event event;
+    memset(&event, 0, sizeof(event));
+    event.events = EPOLLIN | EPOLLOUT | EPOLLET | EPOLLRDHUP;
+    event.data.fd = socket_descriptor;
+
+    std::lock_guard<std::mutex> lock(m_reactor_mutex);
+    if (epoll_ctl(m_epoll_fd, EPOLL_CTL_ADD, socket_descriptor, &event) == -1)
+    {
+        // Descriptor was reused from a closed session still in the set.
+        if (errno != EEXIST || epoll_ctl(m_epoll_fd, EPOLL_CTL_MOD, socket_descriptor, &event) == -1)
+        {
+            std::cout << "IOService epoll_ctl failed: " << strerror(errno) << std::endl;
+            return;
+        }
+    }
+
+    m_reactor_handles[socket_descriptor] = handle;
+    handle->setRegistered(true);
+
+    // Data can arrive before registration, Edge Triggered will not report it.
+    handle->setReadReady(true);
+#else
+    (void)handle;
+#endif
+}
+
+/**
+ * @brief Wake the Reactor if it's blocked waiting on events.
+ */
+void IOService::wakeUp()
+{
+#ifdef __linux__
+    // Jobs added from callbacks on the Reactor are picked up on the next pass.
+    if (m_wakeup_fd == -1 || m_reactor_thread.load() == std::this_thread::get_id())
+    {
+        return;
+    }
+
+    uint64_t value = 1;
+    ssize_t result = write(m_wakeup_fd, &value, sizeof(value));
+    (void)result;
+#endif
+}
+
+/**
+ * @brief Collect Readiness Events and Flag the Socket Handles.
+ * @param timeout
+ */
+void IOService::waitForEvents(int timeout)
+{
+#ifdef __linux__
+    struct epoll_event events[MAX_REACTOR_EVENTS];
+    int num_events = epoll_wait(m_epoll_fd, events, MAX_REACTOR_EVENTS, timeout);
+    if (num_events == -1)
+    {
+        if (errno != EINTR)
+        {
+            std::cout << "IOService epoll_wait failed: " << strerror(errno) << std::endl;
+        }
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_reactor_mutex);
+    for (int i = 0; i < num_events; i++)
+    {
+        int socket_descriptor = events[i].data.fd;
+        if (socket_descriptor == m_wakeup_fd)
+        {
+            uint64_t value = 0;
+            ssize_t result = read(m_wakeup_fd, &value, sizeof(value));
+            (void)result;
+            continue;
+        }
+
+        auto it = m_reactor_handles.find(socket_descriptor);
+        if (it == m_reactor_handles.end())
+        {
+            continue;
+        }
+
+        // Hangups and errors are flagged as well, poll() will pick up the close.
+        socket_handler_ptr handle = it->second.lock();
+        if (handle)
+        {
+            if (events[i].events & (EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR))
+            {
+                handle->setReadReady(true);
+            }
+            if (events[i].events & (EPOLLOUT | EPOLLHUP | EPOLLERR))
+            {
+                handle->setWriteBlocked(false);
+            }
+        }
+        else
+        {
+            m_reactor_handles.erase(it);
+        }
+    }
+#else
+    std::this_thread::sleep_for(std::chrono::milliseconds(timeout));
+#endif
+}
+
+/**
+ * @brief Work out how long the Reactor can block, 0 when jobs are ready.
+ * @return
+ */
+int IOService::getReactorTimeout()
+{
+    int timeout = REACTOR_IDLE_TIMEOUT;
+
+    // Jobs submitted since the last drain.
+    if (!m_submit_queue.is_empty())
+    {
+        return 0;
+    }
+
+    for(job_node *node = m_listener_list.front(); node != nullptr; node = node->m_next)
+    {
+        const service_base_ptr &listener_work = node->m_value;
+        if (!listener_work || !listener_work->getSocketHandle()->isActive()
+                || listener_work->getSocketHandle()->isReadReady())
+        {
+            return 0;
+        }
+        if (listener_work->getSocketHandle()->getSocketDescriptor() == -1)
+        {
+            timeout = REACTOR_POLL_TIMEOUT;
+        }
+    }
+
+    for(job_node *node = m_service_list.front(); node != nullptr; node = node->m_next)
+    {
+        const service_base_ptr &job_work = node->m_value;
+        if (!job_work || !job_work->getSocketHandle()->isActive())
+        {
+            return 0;
+        }
+
+        if (job_work->getServiceType() == SERVICE_TYPE_WRITE)
+        {
+            if (!job_work->getSocketHandle()->isWriteBlocked())
+            {
+                return 0;
+            }
+
+            // No writable event will come, retry after the poll interval.
+            if (job_work->getSocketHandle()->getSocketDescriptor() == -1)
+            {
+                timeout = REACTOR_POLL_TIMEOUT;
+            }
+            continue;
+        }
+
+        if (job_work->getServiceType() != SERVICE_TYPE_READ
+                || job_work->getSocketHandle()->isReadReady())
+        {
+            return 0;
+        }
+        if (job_work->getSocketHandle()->getSocketDescriptor() == -1)
+        {
+            timeout = REACTOR_POLL_TIMEOUT;
+        }
+    }
+
+    // Wake for the next timer if it's sooner.
+    return m_timer_wheel->getTimeout(timeout);
 }
 
 /**
@@ -31,31 +351,50 @@ void IOService::checkAsyncListenersForConnections()
     // Timers are not removed each iteration
     // Async stay active until exprired or canceled
     // And wait, will block socket polling for (x) amount of time
-    for(unsigned int i = 0; i < m_listener_list.size(); i++)
+    job_node *next = nullptr;
+    for(job_node *node = m_listener_list.front(); node != nullptr; node = next)
     {
-        service_base_ptr listener_work = m_listener_list.get(i);
+        next = node->m_next;
+        service_base_ptr listener_work = node->m_value;
         if (!listener_work || !listener_work->getSocketHandle()->isActive())
         {
-            m_listener_list.remove(i);
-            --i; // Compensate for item removed.
+            m_listener_list.erase(node);
             continue;
         }
 
-        socket_handler_ptr handler = listener_work->getSocketHandle()->acceptTelnetConnection();
-        if (handler != nullptr)
+        // With the Reactor, only check Listeners that have been signaled
+        // then drain the backlog since the event will not repeat.
+        socket_handler_ptr listener = listener_work->getSocketHandle();
+        bool is_draining = isReactorMode() && listener->getSocketDescriptor() != -1;
+        if (is_draining)
+        {
+            if (!listener->isReadReady())
+            {
+                continue;
+            }
+            listener->setReadReady(false);
+        }
+
+        socket_handler_ptr handler;
+        while ((handler = listener->acceptTelnetConnection()) != nullptr)
         {
             std::cout << "async accept - connection created." << std::endl;
             std::error_code success_code (0, std::generic_category());
             try
             {
-                // Check for max nodes here, if we like can limit, send a message and drop
-                // connection on hander by not passing it through the callback.
+                // Admission Control (max nodes, per address limits) is done in the
+                // callback, rejected connections are sent a banner and dropped.
                 listener_work->executeCallback(success_code, handler);
             }
             catch (std::exception &ex)
             {
                 std::cout << "Exception Async-Accept: " << ex.what() << std::endl;
             }
+
+            if (!is_draining)
+            {
+                break;
+            }
         }
     }
 }
@@ -66,239 +405,468 @@ void IOService::checkAsyncListenersForConnections()
  */
 void IOService::run()
 {
-    char msg_buffer[MAX_BUFFER_SIZE];
     m_is_active = true;
 
+    if (isIoUringMode())
+    {
+        runIoUring();
+    }
+    else if (isReactorMode())
+    {
+        runReactor();
+    }
+    else
+    {
+        runPolling();
+    }
+
+    // Release all jobs and attached handles.
+    clearJobs();
+}
+
+/**
+ * @brief Move Submitted Jobs into the Active Lists.
+ */
+void IOService::drainSubmittedJobs()
+{
+    // Nodes are moved from the queue to the lists, not reallocated.
+    job_node *node;
+    while ((node = m_submit_queue.pop_node()) != nullptr)
+    {
+        if (!node->m_value)
+        {
+            delete node;
+            continue;
+        }
+
+        if (SERVICE_TIMER(node->m_value->getServiceType()))
+        {
+            // Timer (Priority List Job)
+            m_timer_list.push_back(node);
+        }
+        else if (SERVICE_LISTENER(node->m_value->getServiceType()))
+        {
+            // Server Connection Listener Job (1) for each Service.
+            m_listener_list.push_back(node);
+        }
+        else
+        {
+            // Standard Async Job
+            m_service_list.push_back(node);
+        }
+    }
+}
+
+/**
+ * @brief Clear all Active and Submitted Jobs, IOService thread only.
+ */
+void IOService::clearJobs()
+{
+    m_submit_queue.clear();
+    m_service_list.clear();
+    m_timer_list.clear();
+    m_listener_list.clear();
+}
+
+/**
+ * @brief Polling Loop, Checks each socket then sleeps (Fallback)
+ */
+void IOService::runPolling()
+{
+    char msg_buffer[MAX_BUFFER_SIZE];
+
     while(m_is_active)
     {
+        drainSubmittedJobs();
+
         // Check for incomming connections
         checkAsyncListenersForConnections();
 
-        // This will wait for another job to be inserted on next call
-        // Do we want to insert the job back, if poll is empty or
-        // move to vector then look polls..  i think #2.
-        for(unsigned int i = 0; i < m_service_list.size(); i++)
+        processServiceJobs(msg_buffer);
+
+        checkPriorityTimers();
+
+        // Temp timer, change to 10/20 miliseconds for cpu useage
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    }
+}
+
+/**
+ * @brief Reactor Loop, Blocks until the kernel reports readiness.
+ */
+void IOService::runReactor()
+{
+    char msg_buffer[MAX_BUFFER_SIZE];
+    m_reactor_thread = std::this_thread::get_id();
+
+    while(m_is_active)
+    {
+        // Blocks while nothing is ready, wakeUp() breaks out for new jobs.
+        waitForEvents(getReactorTimeout());
+        if (!m_is_active)
         {
-            service_base_ptr job_work = m_service_list.get(i);
-            if (!job_work || !job_work->getSocketHandle()->isActive())
-            {
-                m_service_list.remove(i);
-                --i; // Compensate for item removed.
-                continue;
-            }
+            break;
+        }
+
+        checkPriorityTimers();
+
+        drainSubmittedJobs();
+
+        // Check for incomming connections
+        checkAsyncListenersForConnections();
+
+        processServiceJobs(msg_buffer);
+    }
+
+    m_reactor_thread = std::thread::id();
+}
+
+/**
+ * @brief Completion Loop, io_uring with the Reactor (epoll) for Listeners.
+ */
+void IOService::runIoUring()
+{
+#if defined(USE_IO_URING) && defined(__linux__)
+    char msg_buffer[MAX_BUFFER_SIZE];
+    m_reactor_thread = std::this_thread::get_id();
+
+    // Listener and wakeUp() events still arrive on epoll, the ring watches it.
+    m_io_uring->watchDescriptor(m_epoll_fd);
+
+    while(m_is_active)
+    {
+        // Submits the Writes queued last pass, then waits on completions.
+        if (m_io_uring->wait(getReactorTimeout()))
+        {
+            waitForEvents(0);
+        }
+
+        if (!m_is_active)
+        {
+            break;
+        }
+
+        checkPriorityTimers();
+
+        drainSubmittedJobs();
+
+        // Check for incomming connections
+        checkAsyncListenersForConnections();
+
+        processServiceJobs(msg_buffer);
+    }
 
-            /**
-             * Handle Read Service if Data is Available.
-             */
-            if (job_work->getServiceType() == SERVICE_TYPE_READ)
+    m_reactor_thread = std::thread::id();
+#else
+    runReactor();
+#endif
+}
+
+/**
+ * @brief Run Read/Write Jobs whose Sockets are ready.
+ * @param msg_buffer
+ */
+void IOService::processServiceJobs(char *msg_buffer)
+{
+    // This will wait for another job to be inserted on next call
+    // Do we want to insert the job back, if poll is empty or
+    // move to vector then look polls..  i think #2.
+    // Callbacks only submit new jobs, so the current node is the only one removed.
+    job_node *next = nullptr;
+    for(job_node *node = m_service_list.front(); node != nullptr; node = next)
+    {
+        next = node->m_next;
+        service_base_ptr job_work = node->m_value;
+        if (!job_work || !job_work->getSocketHandle()->isActive())
+        {
+            m_service_list.erase(node);
+            continue;
+        }
+
+        /**
+         * Handle Read Service if Data is Available.
+         */
+        if (job_work->getServiceType() == SERVICE_TYPE_READ)
+        {
+            socket_handler_ptr handle = job_work->getSocketHandle();
+#if defined(USE_IO_URING) && defined(__linux__)
+            // Data arrives from the Multishot Receive, no poll or recv calls.
+            if (m_io_uring && handle->getSocketDescriptor() != -1)
             {
-                // If Data Available, read, then populate buffer
-                // Otherwise keep polling till data is available.
-                int result = job_work->getSocketHandle()->poll();
-                if (result > 0)
+                int length = m_io_uring->receive(handle, msg_buffer, MAX_BUFFER_SIZE - 1);
+                if (length == 0)
                 {
-                    memset(&msg_buffer, 0, MAX_BUFFER_SIZE);
-                    int length = job_work->getSocketHandle()->recvSocket(msg_buffer);
-                    if(length < 0)
-                    {
-                        // Error - Lost Connection
-                        std::cout << "async_read - lost connection!: " << length << std::endl;
-                        job_work->getSocketHandle()->setInactive();
-                        std::error_code lost_connect_error_code (1, std::system_category());
-                        job_work->executeCallback(lost_connect_error_code, nullptr);
-                        m_service_list.remove(i);
-                        --i; // Compensate for item removed.
-                    }
-                    else
-                    {
-                        job_work->setBuffer((unsigned char *)msg_buffer);
-                        std::error_code success_code (0, std::generic_category());
-                        job_work->executeCallback(success_code, nullptr);
-                        m_service_list.remove(i);
-                        --i; // Compensate for item removed.
-                    }
+                    continue;
                 }
-                else if (result == -1)
+
+                m_service_list.erase(node);
+                if (length < 0)
                 {
-                    std::cout << "async_poll - lost connection" << std::endl;
+                    std::cout << "async_read - lost connection!" << std::endl;
+                    handle->setInactive();
                     std::error_code lost_connect_error_code (1, std::system_category());
                     job_work->executeCallback(lost_connect_error_code, nullptr);
-                    m_service_list.remove(i);
-                    --i; // Compensate for item removed.
                 }
+                else
+                {
+                    msg_buffer[length] = 0;
+                    job_work->setBuffer((unsigned char *)msg_buffer, length);
+                    std::error_code success_code (0, std::generic_category());
+                    job_work->executeCallback(success_code, nullptr);
+                }
+                continue;
             }
+#endif
 
-            /**
-             * Handle Write Service if Data is Available.
-             */
-            else if (job_work->getServiceType() == SERVICE_TYPE_WRITE)
+            // Registered sockets are skipped until the Reactor signals them,
+            // the poll() below confirms since accepted sockets are blocking.
+            if (handle->isRegistered() && !handle->isReadReady())
             {
-                // std::cout << "* SERVICE_TYPE_WRITE" << std::endl;
-                int result = job_work->getSocketHandle()->sendSocket(
-                                 (unsigned char*)job_work->getStringSequence().c_str(),
-                                 job_work->getStringSequence().size());
+                continue;
+            }
 
-                if (result <= 0)
+            // If Data Available, read, then populate buffer
+            // Otherwise keep polling till data is available.
+            int result = handle->poll();
+            if (result > 0)
+            {
+                int length = handle->recvSocket(msg_buffer);
+                if(length == 0)
+                {
+                    // EAGAIN, nothing to read after all. Keep the read
+                    // pending till the next readiness event.
+                    handle->setReadReady(false);
+                }
+                else if(length < 0)
                 {
                     // Error - Lost Connection
-                    std::cout << "async_write - lost connection!" << std::endl;
-                    job_work->getSocketHandle()->setInactive();
+                    std::cout << "async_read - lost connection!: " << length << std::endl;
+                    handle->setInactive();
                     std::error_code lost_connect_error_code (1, std::system_category());
                     job_work->executeCallback(lost_connect_error_code, nullptr);
-                    m_service_list.remove(i);
-                    --i; // Compensate for item removed.
+                    m_service_list.erase(node);
                 }
                 else
                 {
+                    // Short read means the socket is drained, wait for the next edge.
+                    if (length < MAX_BUFFER_SIZE - 1)
+                    {
+                        handle->setReadReady(false);
+                    }
+
+                    job_work->setBuffer((unsigned char *)msg_buffer, length);
                     std::error_code success_code (0, std::generic_category());
                     job_work->executeCallback(success_code, nullptr);
-                    m_service_list.remove(i);
-                    --i; // Compensate for item removed.
+                    m_service_list.erase(node);
                 }
             }
+            else if (result == -1)
+            {
+                std::cout << "async_poll - lost connection" << std::endl;
+                std::error_code lost_connect_error_code (1, std::system_category());
+                job_work->executeCallback(lost_connect_error_code, nullptr);
+                m_service_list.erase(node);
+            }
+            else
+            {
+                handle->setReadReady(false);
+            }
+        }
 
-            /*
-            else if (job_work->getServiceType() == SERVICE_TYPE_CONNECT_TELNET)
+        /**
+         * Handle Write Service if Data is Available.
+         */
+        else if (job_work->getServiceType() == SERVICE_TYPE_WRITE)
+        {
+            // Socket buffer was full, wait for the Reactor to signal it's writable.
+            // Sockets without a descriptor (SSH) are retried on the next pass,
+            // which the Reactor holds back for the poll interval.
+            socket_handler_ptr handle = job_work->getSocketHandle();
+            if (handle->isWriteBlocked())
             {
-                // Get host and port from string.
-                // This would better as a vector<std::string> for the sequqnce,
-                // More versitile.!
-                std::vector<std::string> ip_address = split(job_work->getStringSequence(), ':');
-                bool is_success = false;
-                if (ip_address.size() > 1)
-                {
-                    is_success = job_work->getSocketHandle()->connectTelnetSocket(
-                                     ip_address.at(0),
-                                     std::atoi(ip_address.at(1).c_str())
-                                 );
-                }
-                else
+                if (handle->getSocketDescriptor() != -1)
                 {
-                    is_success = job_work->getSocketHandle()->connectTelnetSocket(
-                                     ip_address.at(0),
-                                     23
-                                 );
+                    continue;
                 }
+                handle->setWriteBlocked(false);
+            }
 
-                if (is_success)
-                {
-                    std::error_code success_code (0, std::generic_category());
-                    job_work->executeCallback(success_code, nullptr);
-                    m_service_list.remove(i);
-                }
-                else
+            // Flush everything queued on the socket in one gathered write.
+            int result;
+#if defined(USE_IO_URING) && defined(__linux__)
+            if (m_io_uring && handle->getSocketDescriptor() != -1)
+            {
+                // Queued as an SQE, submitted with the rest at the top of the loop.
+                result = m_io_uring->send(handle);
+                if (result == 0)
                 {
-                    // Error - Unable to connect
-                    std::cout << "async_connection - unable to connect" << std::endl;
-                    job_work->getSocketHandle()->setInactive();
-                    std::error_code not_connected_error_code (1, std::system_category());
-                    job_work->executeCallback(not_connected_error_code, nullptr);
-                    m_service_list.remove(i);
+                    continue;
                 }
             }
+            else
+#endif
+            {
+                result = handle->flushOutput();
+            }
 
-            else if (job_work->getServiceType() == SERVICE_TYPE_CONNECT_SSH)
+            if (result == 0)
             {
-                // Get host and port from string.
-                // This would better as a vector<std::string> for the sequqnce,
-                // More versitile.!
-                std::vector<std::string> ip_address = split(job_work->getStringSequence(), ':');
-                std::cout << "ip_address: " << ip_address.size();
-                bool is_success = false;
-                if (ip_address.size() >= 4)
-                {
-                    std::cout << "1. " << ip_address.at(0) << std::endl;
-                    std::cout << "2. " << ip_address.at(1) << std::endl;
-                    std::cout << "3. " << ip_address.at(2) << std::endl;
-                    std::cout << "4. " << ip_address.at(3) << std::endl;
-
-                    is_success = job_work->getSocketHandle()->connectSshSocket(
-                                     ip_address.at(0),
-                                     std::atoi(ip_address.at(1).c_str()),
-                                     ip_address.at(2),
-                                     ip_address.at(3)
-                                 );
-                }
+                // Partial write, the rest stays queued with this job.
+                handle->setWriteBlocked(handle->isRegistered() || handle->getSocketDescriptor() == -1);
+            }
+            else if (result < 0)
+            {
+                // Error - Lost Connection
+                std::cout << "async_write - lost connection!" << std::endl;
+                job_work->getSocketHandle()->setInactive();
+                std::error_code lost_connect_error_code (1, std::system_category());
+                job_work->executeCallback(lost_connect_error_code, nullptr);
+                m_service_list.erase(node);
+            }
+            else
+            {
+                std::error_code success_code (0, std::generic_category());
+                job_work->executeCallback(success_code, nullptr);
+                m_service_list.erase(node);
+            }
+        }
 
-                if (is_success)
-                {
-                    std::error_code success_code (0, std::generic_category());
-                    job_work->executeCallback(success_code, nullptr);
-                    m_service_list.remove(i);
-                }
-                else
-                {
-                    // Error - Unable to connect
-                    std::cout << "async_connection - unable to connect" << std::endl;
-                    job_work->getSocketHandle()->setInactive();
-                    std::error_code not_connected_error_code (1, std::system_category());
-                    job_work->executeCallback(not_connected_error_code, nullptr);
-                    m_service_list.remove(i);
-                }
-            }*/
+        /*
+        else if (job_work->getServiceType() == SERVICE_TYPE_CONNECT_TELNET)
+        {
+            // Get host and port from string.
+            // This would better as a vector<std::string> for the sequqnce,
+            // More versitile.!
+            std::vector<std::string> ip_address = split(job_work->getStringSequence(), ':');
+            bool is_success = false;
+            if (ip_address.size() > 1)
+            {
+                is_success = job_work->getSocketHandle()->connectTelnetSocket(
+                                 ip_address.at(0),
+                                 std::atoi(ip_address.at(1).c_str())
+                             );
+            }
+            else
+            {
+                is_success = job_work->getSocketHandle()->connectTelnetSocket(
+                                 ip_address.at(0),
+                                 23
+                             );
+            }
 
-            // SERVICE_TYPE_CONNECT_IRC
-            /*
-            else if (job_work->getServiceType() == SERVICE_TYPE_CONNECT_IRC)
+            if (is_success)
             {
-                // Get host and port from string.
-                // This would better as a vector<std::string> for the sequqnce,
-                // More versitile.!
-                std::vector<std::string> ip_address = split(job_work->getStringSequence(), ':');
-                bool is_success = false;
-                if (ip_address.size() > 1)
-                {
-                    is_success = job_work->getSocketHandle()->connectIrcSocket(
-                                     ip_address.at(0),
-                                     std::atoi(ip_address.at(1).c_str())
-                                 );
-                }
-                else
-                {
-                    is_success = job_work->getSocketHandle()->connectIrcSocket(
-                                     ip_address.at(0),
-                                     6667
-                                 );
-                }
+                std::error_code success_code (0, std::generic_category());
+                job_work->executeCallback(success_code, nullptr);
+                m_service_list.erase(node);
+            }
+            else
+            {
+                // Error - Unable to connect
+                std::cout << "async_connection - unable to connect" << std::endl;
+                job_work->getSocketHandle()->setInactive();
+                std::error_code not_connected_error_code (1, std::system_category());
+                job_work->executeCallback(not_connected_error_code, nullptr);
+                m_service_list.erase(node);
+            }
+        }
 
-                if (is_success)
-                {
-                    // Send Initial Connection Information
-                    std::string nick = "mercyful1";
-                    std::string ident = "mercyful1";
-                    std::string read_name = "michael";
-                    std::string host = "localhost";
+        else if (job_work->getServiceType() == SERVICE_TYPE_CONNECT_SSH)
+        {
+            // Get host and port from string.
+            // This would better as a vector<std::string> for the sequqnce,
+            // More versitile.!
+            std::vector<std::string> ip_address = split(job_work->getStringSequence(), ':');
+            std::cout << "ip_address: " << ip_address.size();
+            bool is_success = false;
+            if (ip_address.size() >= 4)
+            {
+                std::cout << "1. " << ip_address.at(0) << std::endl;
+                std::cout << "2. " << ip_address.at(1) << std::endl;
+                std::cout << "3. " << ip_address.at(2) << std::endl;
+                std::cout << "4. " << ip_address.at(3) << std::endl;
 
-                    std::stringstream ss;
-                    ss  << "NICK " << nick << "\r\n"
-                        << "USER " << ident << " " << host << " bla : " << read_name << "\r\n";
+                is_success = job_work->getSocketHandle()->connectSshSocket(
+                                 ip_address.at(0),
+                                 std::atoi(ip_address.at(1).c_str()),
+                                 ip_address.at(2),
+                                 ip_address.at(3)
+                             );
+            }
 
-                    std::string output = ss.str();
-                    job_work->getSocketHandle()->sendSocket((unsigned char *)output.c_str(), output.size());
+            if (is_success)
+            {
+                std::error_code success_code (0, std::generic_category());
+                job_work->executeCallback(success_code, nullptr);
+                m_service_list.erase(node);
+            }
+            else
+            {
+                // Error - Unable to connect
+                std::cout << "async_connection - unable to connect" << std::endl;
+                job_work->getSocketHandle()->setInactive();
+                std::error_code not_connected_error_code (1, std::system_category());
+                job_work->executeCallback(not_connected_error_code, nullptr);
+                m_service_list.erase(node);
+            }
+        }*/
 
-                    callback_function_handler run_callback(job_work->getCallback());
-                    std::error_code success_code (0, std::generic_category());
-                    run_callback(success_code);
-                    m_service_list.remove(i);
-                }
-                else
-                {
-                    // Error - Unable to connect
-                    std::cout << "async_connection - unable to connect" << std::endl;
-                    job_work->getSocketHandle()->setInactive();
-                    callback_function_handler run_callback(job_work->getCallback());
-                    std::error_code not_connected_error_code (1, std::system_category());
-                    run_callback(not_connected_error_code);
-                    m_service_list.remove(i);
-                }
-            }*/
+        // SERVICE_TYPE_CONNECT_IRC
+        /*
+        else if (job_work->getServiceType() == SERVICE_TYPE_CONNECT_IRC)
+        {
+            // Get host and port from string.
+            // This would better as a vector<std::string> for the sequqnce,
+            // More versitile.!
+            std::vector<std::string> ip_address = split(job_work->getStringSequence(), ':');
+            bool is_success = false;
+            if (ip_address.size() > 1)
+            {
+                is_success = job_work->getSocketHandle()->connectIrcSocket(
+                                 ip_address.at(0),
+                                 std::atoi(ip_address.at(1).c_str())
+                             );
+            }
+            else
+            {
+                is_success = job_work->getSocketHandle()->connectIrcSocket(
+                                 ip_address.at(0),
+                                 6667
+                             );
+            }
 
-        }
+            if (is_success)
+            {
+                // Send Initial Connection Information
+                std::string nick = "mercyful1";
+                std::string ident = "mercyful1";
+                std::string read_name = "michael";
+                std::string host = "localhost";
 
-        // Temp timer, change to 10/20 miliseconds for cpu useage
-        std::this_thread::sleep_for(std::chrono::milliseconds(20));
-    }
+                std::stringstream ss;
+                ss  << "NICK " << nick << "\r\n"
+                    << "USER " << ident << " " << host << " bla : " << read_name << "\r\n";
+
+                std::string output = ss.str();
+                job_work->getSocketHandle()->sendSocket((unsigned char *)output.c_str(), output.size());
 
+                callback_function_handler run_callback(job_work->getCallback());
+                std::error_code success_code (0, std::generic_category());
+                run_callback(success_code);
+                m_service_list.erase(node);
+            }
+            else
+            {
+                // Error - Unable to connect
+                std::cout << "async_connection - unable to connect" << std::endl;
+                job_work->getSocketHandle()->setInactive();
+                callback_function_handler run_callback(job_work->getCallback());
+                std::error_code not_connected_error_code (1, std::system_category());
+                run_callback(not_connected_error_code);
+                m_service_list.erase(node);
+            }
+        }*/
+    }
 }
 
 /**
@@ -307,8 +875,7 @@ void IOService::run()
 void IOService::stop()
 {
     m_is_active = false;
-    // Clear All Lists and attached handles.
-    m_service_list.clear();
-    m_timer_list.clear();
-    m_listener_list.clear();
+
+    // Lists are cleared by the IOService thread once run() returns.
+    wakeUp();
 }
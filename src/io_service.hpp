@@ -1,13 +1,18 @@
 #ifndef IO_SERVICE_HPP
 #define IO_SERVICE_HPP
 
-#include "safe_vector.hpp"
+#include "job_queue.hpp"
+#include "timer_wheel.hpp"
 
 #include <functional>
 #include <sstream>
 #include <vector>
 #include <memory>
 #include <typeinfo>
+#include <atomic>
+#include <mutex>
+#include <map>
+#include <thread>
 
 class SocketHandler;
 typedef std::shared_ptr<SocketHandler> socket_handler_ptr;
@@ -15,6 +20,10 @@ typedef std::shared_ptr<SocketHandler> socket_handler_ptr;
 class Session;
 typedef std::shared_ptr<Session> session_ptr;
 
+#ifdef USE_IO_URING
+class IoUringEngine;
+#endif
+
 const int SERVICE_TYPE_NONE              = 0;
 const int SERVICE_TYPE_READ              = 1;
 const int SERVICE_TYPE_WRITE             = 2;
@@ -53,6 +62,9 @@ public:
     typedef std::function<void(const std::error_code&, socket_handler_ptr)> callback_function_handler;
 
     static const int MAX_BUFFER_SIZE = 8193;
+    static const int MAX_REACTOR_EVENTS = 64;
+    static const int REACTOR_POLL_TIMEOUT = 20;
+    static const int REACTOR_IDLE_TIMEOUT = 250;
 
     /**
      * @class ServiceBase
@@ -64,7 +76,7 @@ public:
     class ServiceBase
     {
     public:
-        virtual void setBuffer(unsigned char *buffer) = 0;
+        virtual void setBuffer(unsigned char *buffer, int length) = 0;
         virtual std::vector<unsigned char> &getBuffer() = 0;
         virtual std::string getStringSequence() = 0;
         virtual socket_handler_ptr getSocketHandle() = 0;
@@ -84,12 +96,11 @@ public:
     class ServiceJob : public ServiceBase
     {
     public:
-        virtual void setBuffer(unsigned char *buffer)
+        virtual void setBuffer(unsigned char *buffer, int length)
         {
-            for(int i = 0; i < MAX_BUFFER_SIZE; i++)
-            {
-                m_buffer.push_back(buffer[i]);
-            }
+            // Copy only what was received, the callers buffer keeps its
+            // capacity between reads so this doesn't allocate once warmed up.
+            m_buffer.assign(buffer, buffer + length);
         }
 
         virtual std::vector<unsigned char> &getBuffer()
@@ -135,7 +146,7 @@ public:
     };
 
     /**
-     * @brief Add Async Jobs to the Vector Queue
+     * @brief Add Async Jobs to the Submission Queue, Safe from any thread.
      * @param buffer
      * @param string_sequence
      * @param socket_handle
@@ -150,21 +161,17 @@ public:
             = new ServiceJob <MutableBufferSequence, StringSequence, SocketHandle, Callback, ServiceType>
         (buffer, string_sequence, socket_handle, callback, service_type);
 
-        if (SERVICE_TIMER(service_type))
-        {
-            // Timer (Priority List Job)
-            m_timer_list.push_back(std::shared_ptr<ServiceBase>(job));
-        }
-        else if (SERVICE_LISTENER(service_type))
+        // With io_uring, session sockets are armed by the engine, only Listeners use epoll.
+        if (SERVICE_LISTENER(service_type) || (!SERVICE_TIMER(service_type) && !isIoUringMode()))
         {
-            // Server Connection Listener Job (1) for each Service.
-            m_listener_list.push_back(std::shared_ptr<ServiceBase>(job));
-        }
-        else
-        {
-            // Standard Async Job
-            m_service_list.push_back(std::shared_ptr<ServiceBase>(job));
+            attachSocketHandle(socket_handle);
         }
+
+        // Sorted into the Active Lists by the IOService thread.
+        m_submit_queue.push(std::shared_ptr<ServiceBase>(job));
+
+        // Reactor may be blocked waiting on events, let it pick up the new job.
+        wakeUp();
     }
 
     /**
@@ -206,6 +213,12 @@ public:
      */
     void checkPriorityTimers();
 
+    /**
+     * @brief Timer Wheel for DeadlineTimers run on this IOService
+     * @return
+     */
+    timer_wheel_ptr getTimerWheel();
+
     /**
      * @brief Async Listener, check for incomming connections
      */
@@ -221,10 +234,102 @@ public:
      */
     void stop();
 
-    SafeVector<service_base_ptr>  m_service_list;
-    SafeVector<service_base_ptr>  m_timer_list;
-    SafeVector<service_base_ptr>  m_listener_list;
-    bool                          m_is_active;
+    /**
+     * @brief Register a Socket Handle with the Reactor (Edge Triggered)
+     * @param handle
+     */
+    void attachSocketHandle(socket_handler_ptr handle);
+
+    /**
+     * @brief Wake the Reactor if it's blocked waiting on events.
+     */
+    void wakeUp();
+
+    /**
+     * @brief Check if readiness events are available (epoll on Linux)
+     * @return
+     */
+    bool isReactorMode() const;
+
+    /**
+     * @brief Switch to the io_uring Completion Engine, call before run().
+     *        Only available when built with USE_IO_URING on Linux.
+     * @return false if unavailable, the Reactor (epoll) is used.
+     */
+    bool enableIoUring();
+
+    /**
+     * @brief Check if the io_uring Completion Engine is in use.
+     * @return
+     */
+    bool isIoUringMode() const;
+
+    typedef JobList<service_base_ptr>::Node job_node;
+
+    // New Jobs from any thread, Active lists are only touched by the IOService thread.
+    JobQueue<service_base_ptr>    m_submit_queue;
+    JobList<service_base_ptr>     m_service_list;
+    JobList<service_base_ptr>     m_timer_list;
+    JobList<service_base_ptr>     m_listener_list;
+    std::atomic<bool>             m_is_active;
+
+private:
+
+    /**
+     * @brief Polling Loop, Checks each socket then sleeps (Fallback)
+     */
+    void runPolling();
+
+    /**
+     * @brief Reactor Loop, Blocks until the kernel reports readiness.
+     */
+    void runReactor();
+
+    /**
+     * @brief Completion Loop, io_uring with the Reactor (epoll) for Listeners.
+     */
+    void runIoUring();
+
+    /**
+     * @brief Collect Readiness Events and Flag the Socket Handles.
+     * @param timeout
+     */
+    void waitForEvents(int timeout);
+
+    /**
+     * @brief Move Submitted Jobs into the Active Lists.
+     */
+    void drainSubmittedJobs();
+
+    /**
+     * @brief Clear all Active and Submitted Jobs, IOService thread only.
+     */
+    void clearJobs();
+
+    /**
+     * @brief Work out how long the Reactor can block, 0 when jobs are ready.
+     * @return
+     */
+    int getReactorTimeout();
+
+    /**
+     * @brief Run Read/Write Jobs whose Sockets are ready.
+     * @param msg_buffer
+     */
+    void processServiceJobs(char *msg_buffer);
+
+    timer_wheel_ptr                  m_timer_wheel;
+    int                              m_epoll_fd;
+    int                              m_wakeup_fd;
+    std::atomic<std::thread::id>     m_reactor_thread;
+    std::atomic<bool>                m_is_io_uring_mode;
+#ifdef USE_IO_URING
+    std::unique_ptr<IoUringEngine>   m_io_uring;
+#endif
+
+    // Descriptor to Handle lookup for events, weak so closed sessions are not held.
+    std::mutex                                  m_reactor_mutex;
+    std::map<int, std::weak_ptr<SocketHandler>> m_reactor_handles;
 
 };
 
@@ -0,0 +1,665 @@
+#ifndef IO_URING_ENGINE_HPP
+#define IO_URING_ENGINE_HPP
+
+// Build with -DUSE_IO_URING, needs Linux 6.0+ headers and kernel
+// for Multishot Receives and Provided Buffer Rings.
+#if defined(USE_IO_URING) && defined(__linux__)
+
+#include "socket_handler.hpp"
+
+#include <linux/io_uring.h>
+#include <sys/syscall.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#include <poll.h>
+#include <signal.h>
+#include <time.h>
+
+#include <iostream>
+#include <cstring>
+#include <cerrno>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <map>
+#include <memory>
+#include <algorithm>
+
+/**
+ * @class IoUringEngine
+ * @author Michael Griffin
+ * @date 17/10/2026
+ * @file io_uring_engine.hpp
+ * @brief Completion Engine for IOService on io_uring (Raw Syscalls, no liburing)
+ *        Keeps a Multishot Receive armed per Socket into Provided Buffers,
+ *        and queues Writes as SQEs which are submitted together each loop.
+ *        Only used from the IOService thread.
+ */
+class IoUringEngine
+{
+public:
+
+    static const unsigned QUEUE_ENTRIES     = 256;
+    static const unsigned BUFFER_COUNT      = 256;  // Power of 2
+    static const unsigned BUFFER_SIZE       = 4096;
+    static const unsigned BUFFER_GROUP      = 0;
+    static const int      MAX_IOVEC_BUFFERS = 64;
+
+    IoUringEngine()
+        : m_ring_fd(-1)
+        , m_sq_ring(nullptr)
+        , m_sq_ring_size(0)
+        , m_cq_ring(nullptr)
+        , m_cq_ring_size(0)
+        , m_sqes(nullptr)
+        , m_sqes_size(0)
+        , m_sq_head(nullptr)
+        , m_sq_tail(nullptr)
+        , m_sq_mask(0)
+        , m_sq_entries(0)
+        , m_sq_array(nullptr)
+        , m_cq_head(nullptr)
+        , m_cq_tail(nullptr)
+        , m_cq_mask(0)
+        , m_cqes(nullptr)
+        , m_sq_local_tail(0)
+        , m_sq_submitted(0)
+        , m_buffer_ring(nullptr)
+        , m_buffer_ring_size(0)
+        , m_buffer_tail(0)
+        , m_buffers(BUFFER_COUNT * BUFFER_SIZE)
+        , m_next_id(1)
+        , m_watch_fd(-1)
+        , m_is_watch_armed(false)
+        , m_is_watch_ready(false)
+    {
+        if (!setupRing() || !setupBuffers())
+        {
+            std::cout << "IoUringEngine unavailable, using epoll." << std::endl;
+            shutdown();
+            return;
+        }
+        std::cout << "IoUringEngine Started" << std::endl;
+    }
+
+    ~IoUringEngine()
+    {
+        std::cout << "~IoUringEngine" << std::endl;
+        shutdown();
+    }
+
+    /**
+     * @brief Check if the Ring was setup
+     * @return
+     */
+    bool isActive() const
+    {
+        return m_ring_fd != -1;
+    }
+
+    /**
+     * @brief Watch a Descriptor (Reactor epoll) for Readability
+     *        wait() returns true when it fires.
+     * @param socket_descriptor
+     */
+    void watchDescriptor(int socket_descriptor)
+    {
+        m_watch_fd = socket_descriptor;
+        armWatch();
+    }
+
+    /**
+     * @brief Take Received Data for a Socket, Arms the Multishot Receive.
+     * @param handle
+     * @param buffer
+     * @param size
+     * @return bytes copied, 0 when nothing is waiting, -1 when closed.
+     */
+    int receive(socket_handler_ptr handle, char *buffer, int size)
+    {
+        Connection *connection = getConnection(handle);
+        if (!connection->m_received.empty())
+        {
+            int length = std::min(size, static_cast<int>(connection->m_received.size()));
+            memcpy(buffer, connection->m_received.data(), length);
+            connection->m_received.erase(0, length);
+            handle->setReadReady(!connection->m_received.empty());
+            return length;
+        }
+
+        if (connection->m_is_closed)
+        {
+            return -1;
+        }
+
+        if (!connection->m_is_armed)
+        {
+            armReceive(connection);
+        }
+        handle->setReadReady(false);
+        return 0;
+    }
+
+    /**
+     * @brief Queue a Gathered Send of the Socket's Output
+     * @param handle
+     * @return 1 when all output is sent, 0 while a send is in flight, -1 on errors.
+     */
+    int send(socket_handler_ptr handle)
+    {
+        Connection *connection = getConnection(handle);
+        if (connection->m_is_closed)
+        {
+            return -1;
+        }
+        if (connection->m_write_hold)
+        {
+            return 0;
+        }
+
+        int count = handle->gatherOutput(connection->m_iov, MAX_IOVEC_BUFFERS);
+        if (count == 0)
+        {
+            return 1;
+        }
+
+        memset(&connection->m_msg, 0, sizeof(connection->m_msg));
+        connection->m_msg.msg_iov = connection->m_iov;
+        connection->m_msg.msg_iovlen = count;
+
+        struct io_uring_sqe *sqe = getSqe();
+        sqe->opcode = IORING_OP_SENDMSG;
+        sqe->fd = connection->m_fd;
+        sqe->addr = reinterpret_cast<uint64_t>(&connection->m_msg);
+        sqe->len = 1;
+        sqe->msg_flags = MSG_NOSIGNAL;
+        sqe->user_data = makeUserData(connection->m_id, KIND_SEND);
+
+        // Queued output must stay alive till the kernel is done with it.
+        connection->m_write_hold = handle;
+        handle->setWriteBlocked(true);
+        return 0;
+    }
+
+    /**
+     * @brief Submit Queued SQEs and Wait for Completions
+     * @param timeout milliseconds, 0 does not block.
+     * @return true if the Watched Descriptor is Readable.
+     */
+    bool wait(int timeout)
+    {
+        releaseClosed();
+
+        unsigned to_submit = m_sq_local_tail - m_sq_submitted;
+        bool is_empty = __atomic_load_n(m_cq_head, __ATOMIC_RELAXED)
+                        == __atomic_load_n(m_cq_tail, __ATOMIC_ACQUIRE);
+
+        if (timeout != 0 && is_empty)
+        {
+            struct __kernel_timespec ts;
+            ts.tv_sec = timeout / 1000;
+            ts.tv_nsec = (timeout % 1000) * 1000000LL;
+
+            struct io_uring_getevents_arg arg;
+            memset(&arg, 0, sizeof(arg));
+            arg.sigmask_sz = _NSIG / 8;
+            arg.ts = reinterpret_cast<uint64_t>(&ts);
+
+            enter(to_submit, 1, IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG, &arg, sizeof(arg));
+        }
+        else if (to_submit > 0)
+        {
+            enter(to_submit, 0, 0, nullptr, 0);
+        }
+
+        reapCompletions();
+
+        bool is_watch_ready = m_is_watch_ready;
+        m_is_watch_ready = false;
+        return is_watch_ready;
+    }
+
+private:
+
+    static const uint64_t KIND_WATCH  = 0;
+    static const uint64_t KIND_RECV   = 1;
+    static const uint64_t KIND_SEND   = 2;
+    static const uint64_t KIND_CANCEL = 3;
+
+    /**
+     * @brief Per Socket State, found through the Handler's Completion Token.
+     */
+    struct Connection
+    {
+        Connection()
+            : m_id(0)
+            , m_fd(-1)
+            , m_is_armed(false)
+            , m_is_closed(false)
+            , m_is_cancelled(false)
+        {
+            memset(&m_msg, 0, sizeof(m_msg));
+        }
+
+        uint64_t                     m_id;
+        int                          m_fd;
+        std::weak_ptr<SocketHandler> m_handler;
+        socket_handler_ptr           m_write_hold;
+        bool                         m_is_armed;
+        bool                         m_is_closed;
+        bool                         m_is_cancelled;
+        std::string                  m_received;
+        struct msghdr                m_msg;
+        struct iovec                 m_iov[MAX_IOVEC_BUFFERS];
+    };
+
+    int       m_ring_fd;
+    void     *m_sq_ring;
+    size_t    m_sq_ring_size;
+    void     *m_cq_ring;
+    size_t    m_cq_ring_size;
+    struct io_uring_sqe *m_sqes;
+    size_t    m_sqes_size;
+
+    unsigned *m_sq_head;
+    unsigned *m_sq_tail;
+    unsigned  m_sq_mask;
+    unsigned  m_sq_entries;
+    unsigned *m_sq_array;
+    unsigned *m_cq_head;
+    unsigned *m_cq_tail;
+    unsigned  m_cq_mask;
+    struct io_uring_cqe *m_cqes;
+
+    unsigned  m_sq_local_tail;
+    unsigned  m_sq_submitted;
+
+    struct io_uring_buf_ring *m_buffer_ring;
+    size_t                    m_buffer_ring_size;
+    uint16_t                  m_buffer_tail;
+    std::vector<char>         m_buffers;
+
+    uint64_t m_next_id;
+    int      m_watch_fd;
+    bool     m_is_watch_armed;
+    bool     m_is_watch_ready;
+    std::map<uint64_t, std::unique_ptr<Connection>> m_connections;
+
+    static uint64_t makeUserData(uint64_t id, uint64_t kind)
+    {
+        return (id << 2) | kind;
+    }
+
+    int enter(unsigned to_submit, unsigned min_complete, unsigned flags, void *arg, size_t arg_size)
+    {
+        int result = syscall(__NR_io_uring_enter, m_ring_fd, to_submit, min_complete, flags, arg, arg_size);
+        if (result >= 0)
+        {
+            m_sq_submitted += result;
+        }
+        else if (errno != ETIME && errno != EINTR && errno != EBUSY)
+        {
+            std::cout << "io_uring_enter: " << strerror(errno) << std::endl;
+        }
+        return result;
+    }
+
+    /**
+     * @brief Map the Submission and Completion Rings
+     * @return
+     */
+    bool setupRing()
+    {
+        struct io_uring_params params;
+        memset(&params, 0, sizeof(params));
+        params.flags = IORING_SETUP_CQSIZE;
+        params.cq_entries = QUEUE_ENTRIES * 4;
+
+        m_ring_fd = syscall(__NR_io_uring_setup, QUEUE_ENTRIES, &params);
+        if (m_ring_fd == -1)
+        {
+            std::cout << "io_uring_setup: " << strerror(errno) << std::endl;
+            return false;
+        }
+
+        if (!(params.features & IORING_FEAT_SINGLE_MMAP) || !(params.features & IORING_FEAT_EXT_ARG))
+        {
+            std::cout << "io_uring: kernel is missing required features" << std::endl;
+            return false;
+        }
+
+        m_sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        m_cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+        m_sq_ring_size = std::max(m_sq_ring_size, m_cq_ring_size);
+        m_cq_ring_size = 0;
+
+        m_sq_ring = mmap(nullptr, m_sq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                         m_ring_fd, IORING_OFF_SQ_RING);
+        if (m_sq_ring == MAP_FAILED)
+        {
+            m_sq_ring = nullptr;
+            return false;
+        }
+        m_cq_ring = m_sq_ring;
+
+        m_sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+        void *sqes = mmap(nullptr, m_sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                          m_ring_fd, IORING_OFF_SQES);
+        if (sqes == MAP_FAILED)
+        {
+            return false;
+        }
+        m_sqes = static_cast<struct io_uring_sqe *>(sqes);
+
+        char *sq = static_cast<char *>(m_sq_ring);
+        m_sq_head    = reinterpret_cast<unsigned *>(sq + params.sq_off.head);
+        m_sq_tail    = reinterpret_cast<unsigned *>(sq + params.sq_off.tail);
+        m_sq_mask    = *reinterpret_cast<unsigned *>(sq + params.sq_off.ring_mask);
+        m_sq_entries = *reinterpret_cast<unsigned *>(sq + params.sq_off.ring_entries);
+        m_sq_array   = reinterpret_cast<unsigned *>(sq + params.sq_off.array);
+
+        char *cq = static_cast<char *>(m_cq_ring);
+        m_cq_head = reinterpret_cast<unsigned *>(cq + params.cq_off.head);
+        m_cq_tail = reinterpret_cast<unsigned *>(cq + params.cq_off.tail);
+        m_cq_mask = *reinterpret_cast<unsigned *>(cq + params.cq_off.ring_mask);
+        m_cqes    = reinterpret_cast<struct io_uring_cqe *>(cq + params.cq_off.cqes);
+
+        m_sq_local_tail = *m_sq_tail;
+        m_sq_submitted = m_sq_local_tail;
+        return true;
+    }
+
+    /**
+     * @brief Register the Provided Buffer Ring used by Multishot Receives
+     * @return
+     */
+    bool setupBuffers()
+    {
+        m_buffer_ring_size = BUFFER_COUNT * sizeof(struct io_uring_buf);
+        void *ring = mmap(nullptr, m_buffer_ring_size, PROT_READ | PROT_WRITE,
+                          MAP_ANONYMOUS | MAP_PRIVATE, -1, 0);
+        if (ring == MAP_FAILED)
+        {
+            return false;
+        }
+        m_buffer_ring = static_cast<struct io_uring_buf_ring *>(ring);
+
+        struct io_uring_buf_reg reg;
+        memset(&reg, 0, sizeof(reg));
+        reg.ring_addr = reinterpret_cast<uint64_t>(m_buffer_ring);
+        reg.ring_entries = BUFFER_COUNT;
+        reg.bgid = BUFFER_GROUP;
+        if (syscall(__NR_io_uring_register, m_ring_fd, IORING_REGISTER_PBUF_RING, &reg, 1) != 0)
+        {
+            std::cout << "io_uring_register pbuf ring: " << strerror(errno) << std::endl;
+            return false;
+        }
+
+        for (unsigned i = 0; i < BUFFER_COUNT; i++)
+        {
+            addBuffer(i);
+        }
+        __atomic_store_n(&m_buffer_ring->tail, m_buffer_tail, __ATOMIC_RELEASE);
+        return true;
+    }
+
+    /**
+     * @brief Hand a Buffer back to the Kernel, Tail is published by the caller.
+     * @param buffer_id
+     */
+    void addBuffer(unsigned buffer_id)
+    {
+        // Field by Field, the ring tail overlays the first entry's resv.
+        // Index from the ring base, in C++ the header's flex array bufs[]
+        // follows an empty struct and is offset by 8 bytes.
+        struct io_uring_buf *buffer = reinterpret_cast<struct io_uring_buf *>(m_buffer_ring)
+                                      + (m_buffer_tail & (BUFFER_COUNT - 1));
+        buffer->addr = reinterpret_cast<uint64_t>(&m_buffers[buffer_id * BUFFER_SIZE]);
+        buffer->len = BUFFER_SIZE;
+        buffer->bid = buffer_id;
+        ++m_buffer_tail;
+    }
+
+    void shutdown()
+    {
+        // Closing the Ring cancels everything in flight.
+        if (m_ring_fd != -1)
+        {
+            close(m_ring_fd);
+            m_ring_fd = -1;
+        }
+        if (m_buffer_ring)
+        {
+            munmap(m_buffer_ring, m_buffer_ring_size);
+            m_buffer_ring = nullptr;
+        }
+        if (m_sqes)
+        {
+            munmap(m_sqes, m_sqes_size);
+            m_sqes = nullptr;
+        }
+        if (m_sq_ring)
+        {
+            munmap(m_sq_ring, m_sq_ring_size);
+            m_sq_ring = nullptr;
+            m_cq_ring = nullptr;
+        }
+        m_connections.clear();
+    }
+
+    /**
+     * @brief Next Free SQE, submits what's queued if the ring is full.
+     * @return
+     */
+    struct io_uring_sqe *getSqe()
+    {
+        while (m_sq_local_tail - __atomic_load_n(m_sq_head, __ATOMIC_ACQUIRE) >= m_sq_entries)
+        {
+            enter(m_sq_local_tail - m_sq_submitted, 0, 0, nullptr, 0);
+            if (m_sq_local_tail - __atomic_load_n(m_sq_head, __ATOMIC_ACQUIRE) >= m_sq_entries)
+            {
+                // Completions are backed up, make room.
+                reapCompletions();
+            }
+        }
+
+        unsigned index = m_sq_local_tail & m_sq_mask;
+        struct io_uring_sqe *sqe = &m_sqes[index];
+        memset(sqe, 0, sizeof(*sqe));
+        m_sq_array[index] = index;
+        ++m_sq_local_tail;
+        __atomic_store_n(m_sq_tail, m_sq_local_tail, __ATOMIC_RELEASE);
+        return sqe;
+    }
+
+    /**
+     * @brief Lookup or Create the State for a Socket Handler
+     * @param handle
+     * @return
+     */
+    Connection *getConnection(socket_handler_ptr handle)
+    {
+        auto it = m_connections.find(handle->getCompletionToken());
+        if (it != m_connections.end())
+        {
+            return it->second.get();
+        }
+
+        std::unique_ptr<Connection> connection(new Connection());
+        connection->m_id = m_next_id++;
+        connection->m_fd = handle->getSocketDescriptor();
+        connection->m_handler = handle;
+        handle->setCompletionToken(connection->m_id);
+
+        Connection *result = connection.get();
+        m_connections[connection->m_id] = std::move(connection);
+        return result;
+    }
+
+    void armReceive(Connection *connection)
+    {
+        struct io_uring_sqe *sqe = getSqe();
+        sqe->opcode = IORING_OP_RECV;
+        sqe->fd = connection->m_fd;
+        sqe->ioprio = IORING_RECV_MULTISHOT;
+        sqe->flags = IOSQE_BUFFER_SELECT;
+        sqe->buf_group = BUFFER_GROUP;
+        sqe->user_data = makeUserData(connection->m_id, KIND_RECV);
+        connection->m_is_armed = true;
+    }
+
+    void armWatch()
+    {
+        if (m_watch_fd == -1 || m_is_watch_armed)
+        {
+            return;
+        }
+
+        struct io_uring_sqe *sqe = getSqe();
+        sqe->opcode = IORING_OP_POLL_ADD;
+        sqe->fd = m_watch_fd;
+        sqe->len = IORING_POLL_ADD_MULTI;
+        sqe->poll32_events = POLLIN;
+        sqe->user_data = makeUserData(0, KIND_WATCH);
+        m_is_watch_armed = true;
+    }
+
+    /**
+     * @brief Cancel Receives on Closed Sockets and drop their State.
+     */
+    void releaseClosed()
+    {
+        for (auto it = m_connections.begin(); it != m_connections.end(); )
+        {
+            Connection *connection = it->second.get();
+            socket_handler_ptr handle = connection->m_handler.lock();
+            if (handle && handle->isActive())
+            {
+                ++it;
+                continue;
+            }
+
+            if (connection->m_is_armed && !connection->m_is_cancelled)
+            {
+                struct io_uring_sqe *sqe = getSqe();
+                sqe->opcode = IORING_OP_ASYNC_CANCEL;
+                sqe->fd = -1;
+                sqe->addr = makeUserData(connection->m_id, KIND_RECV);
+                sqe->user_data = makeUserData(connection->m_id, KIND_CANCEL);
+                connection->m_is_cancelled = true;
+            }
+
+            if (!connection->m_is_armed && !connection->m_write_hold)
+            {
+                it = m_connections.erase(it);
+                continue;
+            }
+            ++it;
+        }
+    }
+
+    /**
+     * @brief Process all Completions
+     */
+    void reapCompletions()
+    {
+        bool is_buffer_returned = false;
+
+        unsigned head = __atomic_load_n(m_cq_head, __ATOMIC_RELAXED);
+        unsigned tail = __atomic_load_n(m_cq_tail, __ATOMIC_ACQUIRE);
+        for (; head != tail; ++head)
+        {
+            struct io_uring_cqe cqe = m_cqes[head & m_cq_mask];
+            uint64_t kind = cqe.user_data & 3;
+            uint64_t id = cqe.user_data >> 2;
+
+            if (kind == KIND_WATCH)
+            {
+                m_is_watch_ready = true;
+                if (!(cqe.flags & IORING_CQE_F_MORE))
+                {
+                    m_is_watch_armed = false;
+                }
+                continue;
+            }
+
+            if (kind == KIND_CANCEL)
+            {
+                continue;
+            }
+
+            auto it = m_connections.find(id);
+            Connection *connection = (it == m_connections.end()) ? nullptr : it->second.get();
+
+            if (kind == KIND_RECV)
+            {
+                if (cqe.flags & IORING_CQE_F_BUFFER)
+                {
+                    unsigned buffer_id = cqe.flags >> IORING_CQE_BUFFER_SHIFT;
+                    if (connection && cqe.res > 0)
+                    {
+                        connection->m_received.append(&m_buffers[buffer_id * BUFFER_SIZE], cqe.res);
+                    }
+                    addBuffer(buffer_id);
+                    is_buffer_returned = true;
+                }
+
+                if (!connection)
+                {
+                    continue;
+                }
+
+                if (!(cqe.flags & IORING_CQE_F_MORE))
+                {
+                    connection->m_is_armed = false;
+                }
+
+                // Out of Buffers just re-arms on the next receive, anything else ends the Socket.
+                if (cqe.res == 0 || (cqe.res < 0 && cqe.res != -ENOBUFS))
+                {
+                    connection->m_is_closed = true;
+                }
+
+                socket_handler_ptr handle = connection->m_handler.lock();
+                if (handle)
+                {
+                    handle->setReadReady(true);
+                }
+            }
+            else if (kind == KIND_SEND && connection)
+            {
+                socket_handler_ptr handle = connection->m_write_hold;
+                connection->m_write_hold.reset();
+                if (!handle)
+                {
+                    continue;
+                }
+
+                if (cqe.res < 0)
+                {
+                    std::cout << "io_uring sendmsg: " << strerror(-cqe.res) << std::endl;
+                    connection->m_is_closed = true;
+                }
+                else
+                {
+                    handle->completeOutput(cqe.res);
+                }
+                handle->setWriteBlocked(false);
+            }
+        }
+        __atomic_store_n(m_cq_head, head, __ATOMIC_RELEASE);
+
+        if (is_buffer_returned)
+        {
+            __atomic_store_n(&m_buffer_ring->tail, m_buffer_tail, __ATOMIC_RELEASE);
+        }
+
+        armWatch();
+    }
+};
+
+#endif // USE_IO_URING
+
+#endif // IO_URING_ENGINE_HPP
@@ -0,0 +1,274 @@
+#ifndef JOB_QUEUE_HPP
+#define JOB_QUEUE_HPP
+
+#include <atomic>
+#include <utility>
+
+/**
+ * @class JobNode
+ * @author Michael Griffin
+ * @date 17/10/2026
+ * @file job_queue.hpp
+ * @brief Link for a Job, shared by the JobQueue and JobList so a submitted
+ *        job moves into the active list without another allocation.
+ */
+template <class T>
+class JobNode
+{
+public:
+    JobNode()
+        : m_link(nullptr)
+        , m_prev(nullptr)
+        , m_next(nullptr)
+        , m_value()
+    { }
+
+    explicit JobNode(T &&value)
+        : m_link(nullptr)
+        , m_prev(nullptr)
+        , m_next(nullptr)
+        , m_value(std::move(value))
+    { }
+
+    std::atomic<JobNode*> m_link;  // JobQueue
+    JobNode              *m_prev;  // JobList
+    JobNode              *m_next;  // JobList
+    T                     m_value;
+};
+
+
+/**
+ * @class JobQueue
+ * @author Michael Griffin
+ * @date 17/10/2026
+ * @file job_queue.hpp
+ * @brief Lock Free Multiple Producer, Single Consumer Queue.
+ *        Any thread can push jobs, only the owning IOService thread pops.
+ */
+template <class T>
+class JobQueue
+{
+public:
+
+    typedef JobNode<T> Node;
+
+    explicit JobQueue(void)
+        : m_head(new Node())
+        , m_tail(m_head.load())
+        , m_size(0)
+    { }
+
+    JobQueue(const JobQueue&) = delete;
+    JobQueue& operator=(const JobQueue&) = delete;
+
+    ~JobQueue(void)
+    {
+        clear();
+        delete m_tail;
+    }
+
+    /**
+     * @brief Add Item to the Queue, Safe from any thread.
+     * @param t
+     */
+    void push(T t)
+    {
+        Node *node = new Node(std::move(t));
+        Node *previous = m_head.exchange(node, std::memory_order_acq_rel);
+
+        // Consumer will see an empty queue till the link is made.
+        previous->m_link.store(node, std::memory_order_release);
+        m_size.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Remove Item from the Queue, Consumer thread only.
+     * @param t
+     * @return false when empty.
+     */
+    bool pop(T &t)
+    {
+        Node *node = pop_node();
+        if (node == nullptr)
+        {
+            return false;
+        }
+
+        t = std::move(node->m_value);
+        delete node;
+        return true;
+    }
+
+    /**
+     * @brief Remove the Next Node from the Queue, Consumer thread only.
+     *        The old head stub is handed back holding the value, the caller
+     *        owns it and can link it straight into a JobList.
+     * @return nullptr when empty.
+     */
+    Node *pop_node(void)
+    {
+        Node *tail = m_tail;
+        Node *next = tail->m_link.load(std::memory_order_acquire);
+        if (next == nullptr)
+        {
+            return nullptr;
+        }
+
+        // next becomes the new stub, so it's value moves back to the old one.
+        tail->m_value = std::move(next->m_value);
+        next->m_value = T();
+        tail->m_link.store(nullptr, std::memory_order_relaxed);
+        m_tail = next;
+        m_size.fetch_sub(1, std::memory_order_relaxed);
+        return tail;
+    }
+
+    /**
+     * @brief Clear out the Entire Queue, Consumer thread only.
+     */
+    void clear(void)
+    {
+        T t;
+        while (pop(t))
+        {
+            t = T();
+        }
+    }
+
+    // Check for Non-Blocking Wait.
+    bool is_empty(void) const
+    {
+        return m_tail->m_link.load(std::memory_order_acquire) == nullptr;
+    }
+
+    // Approximate while producers are pushing.
+    unsigned long size(void) const
+    {
+        return m_size.load(std::memory_order_relaxed);
+    }
+
+private:
+
+    std::atomic<Node*>         m_head;
+    Node                      *m_tail;
+    std::atomic<unsigned long> m_size;
+};
+
+
+/**
+ * @class JobList
+ * @author Michael Griffin
+ * @date 17/10/2026
+ * @file job_queue.hpp
+ * @brief Doubly Linked List of Active Jobs for a single thread.
+ *        Removal while iterating is O(1), nothing is copied or shifted.
+ *        Nodes popped from the JobQueue are relinked, not reallocated.
+ */
+template <class T>
+class JobList
+{
+public:
+
+    typedef JobNode<T> Node;
+
+    explicit JobList(void)
+        : m_first(nullptr)
+        , m_last(nullptr)
+        , m_size(0)
+    { }
+
+    JobList(const JobList&) = delete;
+    JobList& operator=(const JobList&) = delete;
+
+    ~JobList(void)
+    {
+        clear();
+    }
+
+    // Add Item to the back of the List.
+    void push_back(T t)
+    {
+        push_back(new Node(std::move(t)));
+    }
+
+    // Link a Node to the back of the List, the List owns it after.
+    void push_back(Node *node)
+    {
+        node->m_prev = m_last;
+        node->m_next = nullptr;
+        if (m_last)
+        {
+            m_last->m_next = node;
+        }
+        else
+        {
+            m_first = node;
+        }
+        m_last = node;
+        ++m_size;
+    }
+
+    // First Node for iterating, nullptr when empty.
+    Node *front(void) const
+    {
+        return m_first;
+    }
+
+    /**
+     * @brief Unlink and delete the node
+     * @param node
+     * @return the next node to continue iterating from.
+     */
+    Node *erase(Node *node)
+    {
+        Node *next = node->m_next;
+        if (node->m_prev)
+        {
+            node->m_prev->m_next = next;
+        }
+        else
+        {
+            m_first = next;
+        }
+
+        if (next)
+        {
+            next->m_prev = node->m_prev;
+        }
+        else
+        {
+            m_last = node->m_prev;
+        }
+
+        delete node;
+        --m_size;
+        return next;
+    }
+
+    // Clear out the Entire List.
+    void clear(void)
+    {
+        while (m_first)
+        {
+            erase(m_first);
+        }
+    }
+
+    // Check for Non-Blocking Wait.
+    bool is_empty(void) const
+    {
+        return m_first == nullptr;
+    }
+
+    unsigned long size(void) const
+    {
+        return m_size;
+    }
+
+private:
+    Node         *m_first;
+    Node         *m_last;
+    unsigned long m_size;
+};
+
+#endif // JOB_QUEUE_HPP
@@ -133,7 +133,8 @@ auto main() -> int
         {
             // Create Handles to Services, and starts up connection listener and ASIO Thread Worker
             IOService io_service;
-            interface_ptr setupAndRunAsioServer(new Interface(io_service, "TELNET", cfg.m_config->port_telnet));
+            interface_ptr setupAndRunAsioServer(new Interface(io_service, "TELNET", cfg.m_config->port_telnet,
+                                                              cfg.m_config));
 
             while(TheCommunicator::instance()->isActive())
             {
@@ -0,0 +1,183 @@
+#ifndef MCCP_COMPRESSOR_HPP
+#define MCCP_COMPRESSOR_HPP
+
+#include <zlib.h>
+
+#include <iostream>
+#include <string>
+#include <cstring>
+#include <cstdint>
+#include <memory>
+
+class MccpCompressor;
+typedef std::shared_ptr<MccpCompressor> mccp_compressor_ptr;
+
+/**
+ * @class MccpCompressor
+ * @author Michael Griffin
+ * @date 17/10/2026
+ * @file mccp_compressor.hpp
+ * @brief Per Session zlib Deflate Stream for MCCP2 (TELOPT_COMPRESS2).
+ *        Output is deflated as it's queued, then sync flushed at the end of
+ *        each output batch so the client can draw everything sent so far.
+ *        Bytes before and after compression are counted.
+ *        Not thread safe, the socket's output lock is held.
+ */
+class MccpCompressor
+{
+public:
+
+    explicit MccpCompressor()
+        : m_is_ready(false)
+        , m_is_pending(false)
+        , m_bytes_in(0)
+        , m_bytes_out(0)
+    {
+        memset(&m_stream, 0, sizeof(m_stream));
+    }
+
+    ~MccpCompressor()
+    {
+        if (m_is_ready)
+        {
+            deflateEnd(&m_stream);
+        }
+    }
+
+    /**
+     * @brief Setup the Deflate Stream
+     * @param level zlib level 1 - 9
+     * @return false if zlib could not be initialized.
+     */
+    bool init(int level)
+    {
+        if (level < Z_BEST_SPEED || level > Z_BEST_COMPRESSION)
+        {
+            level = Z_DEFAULT_COMPRESSION;
+        }
+
+        m_is_ready = (deflateInit(&m_stream, level) == Z_OK);
+        if (!m_is_ready)
+        {
+            std::cout << "MCCP2 deflateInit failed: " << (m_stream.msg ? m_stream.msg : "") << std::endl;
+        }
+        return m_is_ready;
+    }
+
+    /**
+     * @brief Check if the stream is still open for output.
+     * @return
+     */
+    bool isActive() const
+    {
+        return m_is_ready;
+    }
+
+    /**
+     * @brief Deflate Output, zlib may hold it till the next flush.
+     * @param data
+     * @param output Compressed bytes are appended.
+     */
+    void compress(const std::string &data, std::string &output)
+    {
+        if (!m_is_ready || data.empty())
+        {
+            return;
+        }
+
+        m_bytes_in += data.size();
+        m_is_pending = true;
+        deflateData(data.data(), data.size(), Z_NO_FLUSH, output);
+    }
+
+    /**
+     * @brief Sync Flush, ends the output batch on a byte boundary.
+     * @param output Compressed bytes are appended.
+     * @return false if nothing was compressed since the last flush.
+     */
+    bool flush(std::string &output)
+    {
+        if (!m_is_ready || !m_is_pending)
+        {
+            return false;
+        }
+
+        m_is_pending = false;
+        deflateData(nullptr, 0, Z_SYNC_FLUSH, output);
+        return true;
+    }
+
+    /**
+     * @brief End the Stream, output following is sent uncompressed.
+     * @param output Compressed bytes are appended.
+     */
+    void finish(std::string &output)
+    {
+        if (!m_is_ready)
+        {
+            return;
+        }
+
+        deflateData(nullptr, 0, Z_FINISH, output);
+        deflateEnd(&m_stream);
+        m_is_ready = false;
+        m_is_pending = false;
+    }
+
+    /**
+     * @brief Bytes Queued before Compression
+     * @return
+     */
+    uint64_t getBytesIn() const
+    {
+        return m_bytes_in;
+    }
+
+    /**
+     * @brief Compressed Bytes Sent on to the Socket
+     * @return
+     */
+    uint64_t getBytesOut() const
+    {
+        return m_bytes_out;
+    }
+
+private:
+
+    static const size_t CHUNK_SIZE = 4096;
+
+    /**
+     * @brief Run Deflate till zlib has no more output for this flush mode.
+     * @param data
+     * @param length
+     * @param flush_mode
+     * @param output
+     */
+    void deflateData(const char *data, size_t length, int flush_mode, std::string &output)
+    {
+        unsigned char chunk[CHUNK_SIZE];
+        m_stream.next_in = reinterpret_cast<Bytef *>(const_cast<char *>(data));
+        m_stream.avail_in = static_cast<uInt>(length);
+
+        int result = Z_OK;
+        do
+        {
+            m_stream.next_out = chunk;
+            m_stream.avail_out = CHUNK_SIZE;
+            result = deflate(&m_stream, flush_mode);
+
+            size_t have = CHUNK_SIZE - m_stream.avail_out;
+            output.append(reinterpret_cast<char *>(chunk), have);
+            m_bytes_out += have;
+        }
+        while (m_stream.avail_out == 0 && result != Z_STREAM_ERROR);
+    }
+
+    z_stream m_stream;
+    bool     m_is_ready;
+    bool     m_is_pending;  // Data deflated since the last flush.
+    uint64_t m_bytes_in;
+    uint64_t m_bytes_out;
+};
+
+#endif // MCCP_COMPRESSOR_HPP
@@ -2,6 +2,7 @@
 
 #include "data-sys/menu_dao.hpp"
 #include "data-sys/menu_prompt_dao.hpp"
+#include "model-sys/menu_stats.hpp"
 #include "access_condition.hpp"
 #include "directory.hpp"
 
@@ -1153,6 +1154,13 @@ bool MenuBase::executeMenuOptions(const MenuOption &option)
         return false;
     }
 
+    // Anonymous Command Usage, queued for the background writer.
+    menu_stats_ptr stats(new MenuStats());
+    stats->sMenuName = m_current_menu;
+    stats->sCmdKey = option.command_key;
+    stats->dtDateTime = std::time(nullptr);
+    TheCommunicator::instance()->getStatsWriter()->pushMenuStats(stats);
+
     // Execute Menu Option Commands per Callback
     return m_execute_callback.back()(option);
 }
@@ -61,6 +61,19 @@ public:
 // bool
     bool use_service_telnet;    // new
     bool use_service_ssl;       // new
+    bool use_native_sockets;    // new { posix sockets instead of sdl_net, ipv6 and reuseport }
+    bool use_io_uring;          // new { linux io_uring completion engine, needs USE_IO_URING build }
+
+// int
+    int io_service_threads;    // new { reactor threads, 0 = one per cpu core }
+    int output_buffer_high_water; // new { bytes queued per node before output is throttled }
+    int output_buffer_low_water;  // new { bytes queued per node before output resumes }
+    int max_nodes;                // new { connections admitted at once, 0 = unlimited }
+    int max_connections_per_address; // new { concurrent connections from one ip, 0 = unlimited }
+    int max_connections_per_minute;  // new { connection attempts per minute from one ip, 0 = unlimited }
+    int password_hash_iterations;    // new { pbkdf2 rounds for new passwords, existing ones keep theirs }
+    int telnet_compression_level;    // new { mccp2 zlib level 1-9 for telnet output, 0 = off }
+
     std::string directory_screens;     // TextDir,
     std::string directory_boards;      // BoardDir,
     std::string directory_files;       // FilesDir,
@@ -224,6 +237,16 @@ public:
         , port_ssl(443)
         , use_service_telnet(true)
         , use_service_ssl(false)
+        , use_native_sockets(false)
+        , use_io_uring(false)
+        , io_service_threads(0)
+        , output_buffer_high_water(262144)
+        , output_buffer_low_water(65536)
+        , max_nodes(0)
+        , max_connections_per_address(5)
+        , max_connections_per_minute(20)
+        , password_hash_iterations(10000)
+        , telnet_compression_level(6)
         , directory_screens("")
         , directory_boards("")
         , directory_files("")
@@ -364,6 +387,16 @@ namespace YAML
             node["port_ssl"] = rhs.port_ssl;
             node["use_service_telnet"] = rhs.use_service_telnet;
             node["use_service_ssl"] = rhs.use_service_ssl;
+            node["use_native_sockets"] = rhs.use_native_sockets;
+            node["use_io_uring"] = rhs.use_io_uring;
+            node["io_service_threads"] = rhs.io_service_threads;
+            node["output_buffer_high_water"] = rhs.output_buffer_high_water;
+            node["output_buffer_low_water"] = rhs.output_buffer_low_water;
+            node["max_nodes"] = rhs.max_nodes;
+            node["max_connections_per_address"] = rhs.max_connections_per_address;
+            node["max_connections_per_minute"] = rhs.max_connections_per_minute;
+            node["password_hash_iterations"] = rhs.password_hash_iterations;
+            node["telnet_compression_level"] = rhs.telnet_compression_level;
             node["directory_screens"] = rhs.directory_screens;
             node["directory_boards"] = rhs.directory_boards;
             node["directory_files"] = rhs.directory_files;
@@ -485,6 +518,16 @@ namespace YAML
             rhs.port_ssl                        = node["port_ssl"].as<int>();
             rhs.use_service_telnet              = node["use_service_telnet"].as<bool>();
             rhs.use_service_ssl                 = node["use_service_ssl"].as<bool>();
+            rhs.use_native_sockets              = node["use_native_sockets"].as<bool>();
+            rhs.use_io_uring                    = node["use_io_uring"].as<bool>();
+            rhs.io_service_threads              = node["io_service_threads"].as<int>();
+            rhs.output_buffer_high_water        = node["output_buffer_high_water"].as<int>();
+            rhs.output_buffer_low_water         = node["output_buffer_low_water"].as<int>();
+            rhs.max_nodes                       = node["max_nodes"].as<int>();
+            rhs.max_connections_per_address     = node["max_connections_per_address"].as<int>();
+            rhs.max_connections_per_minute      = node["max_connections_per_minute"].as<int>();
+            rhs.password_hash_iterations        = node["password_hash_iterations"].as<int>();
+            rhs.telnet_compression_level        = node["telnet_compression_level"].as<int>();
             rhs.directory_screens               = node["directory_screens"].as<std::string>();
             rhs.directory_boards                = node["directory_boards"].as<std::string>();
             rhs.directory_files                 = node["directory_files"].as<std::string>();
@@ -41,6 +41,7 @@ public:
     long iFilesDl;
     long iFilesUlMb;
     long iFilesDlMb;
+    int  iNegotiationMs;
 
     explicit SessionStats()
         : iId(-1)
@@ -63,6 +64,7 @@ public:
         , iFilesDl(0)
         , iFilesUlMb(0)
         , iFilesDlMb(0)
+        , iNegotiationMs(0)
     { }
         
     ~SessionStats()
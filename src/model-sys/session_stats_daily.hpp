@@ -0,0 +1,50 @@
+#ifndef SESSION_STATS_DAILY_HPP
+#define SESSION_STATS_DAILY_HPP
+
+#include <string>
+#include <memory>
+
+class SessionStatsDaily;
+typedef std::shared_ptr<SessionStatsDaily> session_stats_daily_ptr;
+
+/**
+ * @class SessionStatsDaily
+ * @author Michael Griffin
+ * @date 17/10/2026
+ * @file session_stats_daily.hpp
+ * @brief Daily Rollup of Session Stats, one row per local day (YYYY-MM-DD)
+ */
+class SessionStatsDaily
+{
+public:
+
+    long iId;
+    std::string sDay;
+    long iCalls;
+    long iLogons;
+    long iMsgRead;
+    long iMsgPost;
+    long iFilesUl;
+    long iFilesDl;
+    long iFilesUlMb;
+    long iFilesDlMb;
+
+    explicit SessionStatsDaily()
+        : iId(-1)
+        , sDay("")
+        , iCalls(0)
+        , iLogons(0)
+        , iMsgRead(0)
+        , iMsgPost(0)
+        , iFilesUl(0)
+        , iFilesDl(0)
+        , iFilesUlMb(0)
+        , iFilesDlMb(0)
+    { }
+
+    ~SessionStatsDaily()
+    { }
+
+};
+
+#endif // SESSION_STATS_DAILY_HPP
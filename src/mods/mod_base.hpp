@@ -165,6 +165,16 @@ public:
         m_ansi_process->parseAnsiScreen((char *)data.c_str());
         m_session_data->deliver(data);
     }
+
+    /**
+     * @brief Pass an ENTER through the State after an async callback on the IOService thread.
+     *        The module handles the result as input, then the menu system sees if it finished.
+     */
+    void baseResumeAfterCallback()
+    {
+        m_session_data->m_parsed_data += "\n";
+        m_session_data->updateState();
+    }
     
     /**
      * @brief Pull and Display Prompts
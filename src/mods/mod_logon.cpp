@@ -1,6 +1,7 @@
 #include "mod_logon.hpp"
 #include "../model-sys/config.hpp"
 #include "../encryption.hpp"
+#include "../communicator.hpp"
 
 #include "../model-sys/security.hpp"
 #include "../model-sys/users.hpp"
@@ -336,9 +337,11 @@ bool ModLogon::logon(const std::string &input)
 }
 
 /**
- * @brief Encodes and Validates User Password
+ * @brief Starts Validating the User Password, the security record is loaded
+ *        on the Database thread then hashed on the Hashing Workers.
+ *        The result comes back through handlePasswordVerified.
  * @param input
- * @return 
+ * @return false if there is nothing to validate.
  */
 bool ModLogon::validate_password(const std::string &input)
 {   
@@ -348,33 +351,95 @@ bool ModLogon::validate_password(const std::string &input)
         return false;
     }
     
-    // First load the secure record for the exsting user.
-    // Link to security dao for data access object
-    security_dao_ptr security_dao(new SecurityDao(m_session_data->m_user_database));
-    
+    m_is_verifying = true;
+    m_is_verify_complete = false;
+
     // Lookup the secutiry table for existing hash.
-    security_ptr security = security_dao->getRecordById(m_logon_user->iSecurityIndex);
-    if (!security || security->iId == -1)
+    long security_index = m_logon_user->iSecurityIndex;
+    m_security_request = TheCommunicator::instance()->getUserDatabaseExecutor()->execute<security_ptr>(
+                             m_session_data->m_io_service, "SecurityDao::getRecordById",
+                             [security_index](SQLW::Database &database)
     {
+        SecurityDao security_dao(database);
+        return security_dao.getRecordById(security_index);
+    },
+    std::bind(&ModLogon::handleSecurityLoaded, this, input, std::placeholders::_1));
+
+    if (!m_security_request)
+    {
+        m_is_verifying = false;
         return false;
     }
-    
-    // Generate Encrypted password from incoming string.
-    encrypt_ptr encryption(new Encrypt());
-    if (!encryption) 
+    return true;
+}
+
+/**
+ * @brief Callback on the IOService thread with the Users Security Record
+ * @param input
+ * @param security
+ */
+void ModLogon::handleSecurityLoaded(const std::string &input, security_ptr security)
+{
+    m_security_request.reset();
+    if (!security || security->iId == -1)
     {
-        std::cout << "Error, unable to allocate encryption" << std::endl;
-        return false;
+        handlePasswordVerified(false);
+        return;
     }
-    
-    // Compare case sensitive hash with generated hash string.   
-    std::string password = encryption->generate_password(input, security->sSaltHash);
-    if(security->sPasswordHash.compare(password) == 0)
+
+    // PBKDF2 is slow on purpose, hash on the workers so other sessions
+    // on this IOService keep running. Compared case sensitive in the hasher.
+    m_verify_request = TheCommunicator::instance()->getPasswordHasher()->verifyAsync(
+                           m_session_data->m_io_service, input, security->sSaltHash, security->sPasswordHash,
+                           std::bind(&ModLogon::handlePasswordVerified, this, std::placeholders::_1));
+}
+
+/**
+ * @brief Callback on the IOService thread once the Password is Verified
+ * @param is_valid
+ */
+void ModLogon::handlePasswordVerified(bool is_valid)
+{
+    m_is_password_valid = is_valid;
+    m_is_verify_complete = true;
+    baseResumeAfterCallback();
+}
+
+/**
+ * @brief Authorize the Session, or count the failure and prompt again.
+ * @param is_valid
+ * @return
+ */
+bool ModLogon::passwordResult(bool is_valid)
+{
+    if (is_valid)
     {
-        // Success!
-        return true;
+        // Authorize and assign user to the session.
+        m_session_data->m_is_session_authorized = true;
+        m_session_data->m_user_record = m_logon_user;
+
+        // Record the Logon on the Session Stats.
+        m_session_data->m_session_stats->iUserId = m_logon_user->iId;
+        m_session_data->m_session_stats->bLogonSuccess = true;
+        m_session_data->m_session_stats->iInvalidAttempts = m_failure_attempts;
+        m_session_data->updateSessionStats();
+        m_is_active = false;                        
     }
-    
+    else
+    {
+        displayPromptAndNewLine(PROMPT_INVALID_PASSWORD);                   
+        ++m_failure_attempts;
+        
+        // If max, then exit back to matrix.
+        if (m_failure_attempts >= m_config->invalid_password_attempts)
+        {
+            m_is_active = false;
+            return false;
+        }
+        
+        redisplayModulePrompt();
+    }
+
     return false;
 }
 
@@ -385,6 +450,20 @@ bool ModLogon::validate_password(const std::string &input)
  */
 bool ModLogon::password(const std::string &input)
 {
+    // Waiting on the Database and Hashing Workers, drop any input till the result is back.
+    if (m_is_verifying)
+    {
+        if (!m_is_verify_complete)
+        {
+            return false;
+        }
+
+        m_verify_request.reset();
+        m_is_verifying = false;
+        m_is_verify_complete = false;
+        return passwordResult(m_is_password_valid);
+    }
+
     std::cout << "password: " << input << std::endl;
     std::string key = "";
     bool useHiddenOutput = true;
@@ -406,26 +485,10 @@ bool ModLogon::password(const std::string &input)
         
         baseProcessDeliverNewLine();
         
-        if (validate_password(key))
+        // Nothing queued, there is nothing to wait on.
+        if (!validate_password(key))
         {
-            // Authorize and assign user to the session.
-            m_session_data->m_is_session_authorized = true;
-            m_session_data->m_user_record = m_logon_user;
-            m_is_active = false;                        
-        }
-        else
-        {
-            displayPromptAndNewLine(PROMPT_INVALID_PASSWORD);                   
-            ++m_failure_attempts;
-            
-            // If max, then exit back to matrix.
-            if (m_failure_attempts >= m_config->invalid_password_attempts)
-            {
-                m_is_active = false;
-                return false;
-            }
-            
-            redisplayModulePrompt();
+            return passwordResult(false);
         }
     }
     else
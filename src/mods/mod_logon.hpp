@@ -8,6 +8,8 @@
 
 #include "../session_data.hpp"
 #include "../session_io.hpp"
+#include "../password_hasher.hpp"
+#include "../database_executor.hpp"
 
 #include <memory>
 #include <vector>
@@ -19,6 +21,9 @@ typedef std::shared_ptr<Config> config_ptr;
 class AnsiProcessor;
 typedef std::shared_ptr<AnsiProcessor> ansi_process_ptr;
 
+class Security;
+typedef std::shared_ptr<Security> security_ptr;
+
 /**
  * @class ModLogin
  * @author Michael Griffin
@@ -38,6 +43,9 @@ public:
         , m_mod_function_index(MOD_LOGON)
         , m_failure_attempts(0)
         , m_is_text_prompt_exist(false)
+        , m_is_verifying(false)
+        , m_is_verify_complete(false)
+        , m_is_password_valid(false)
     {
         std::cout << "ModLogon" << std::endl;
 
@@ -68,6 +76,16 @@ public:
     virtual ~ModLogon() override
     {
         std::cout << "~ModLogon" << std::endl;
+
+        // Verification still running, the result is no longer wanted.
+        if (m_security_request)
+        {
+            m_security_request->cancel();
+        }
+        if (m_verify_request)
+        {
+            m_verify_request->cancel();
+        }
         std::vector<std::function< void()> >().swap(m_setup_functions);
         std::vector<std::function< void(const std::string &)> >().swap(m_mod_functions);
     }
@@ -205,12 +223,34 @@ private:
     bool logon(const std::string &input);
 
     /**
-     * @brief Encodes and Validates User Password
+     * @brief Starts Validating the User Password, the security record is loaded
+     *        on the Database thread then hashed on the Hashing Workers.
+     *        The result comes back through handlePasswordVerified.
      * @param input
-     * @return
+     * @return false if there is nothing to validate.
      */
     bool validate_password(const std::string &input);
 
+    /**
+     * @brief Callback on the IOService thread with the Users Security Record
+     * @param input
+     * @param security
+     */
+    void handleSecurityLoaded(const std::string &input, security_ptr security);
+
+    /**
+     * @brief Callback on the IOService thread once the Password is Verified
+     * @param is_valid
+     */
+    void handlePasswordVerified(bool is_valid);
+
+    /**
+     * @brief Authorize the Session, or count the failure and prompt again.
+     * @param is_valid
+     * @return
+     */
+    bool passwordResult(bool is_valid);
+
     /**
      * @brief Validates user logon password
      * @return
@@ -254,6 +294,13 @@ private:
     int                    m_failure_attempts;
     bool                   m_is_text_prompt_exist;
 
+    // Pending Password Verification, input is ignored till it completes.
+    DatabaseExecutor::request_ptr      m_security_request;
+    PasswordHasher::verify_request_ptr m_verify_request;
+    bool                   m_is_verifying;
+    bool                   m_is_verify_complete;
+    bool                   m_is_password_valid;
+
     // Hold instatnce of user trying to login to the system.
     user_ptr               m_logon_user;
 };
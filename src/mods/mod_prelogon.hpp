@@ -40,7 +40,7 @@ public:
         , m_session_io(session_data)
         , m_filename("mod_prelogon.yaml")
         , m_text_prompts_dao(new TextPromptsDao(GLOBAL_DATA_PATH, m_filename))
-        , m_deadline_timer(new DeadlineTimer())
+        , m_deadline_timer(new DeadlineTimer(session_data->m_io_service))
         , m_mod_function_index(MOD_DETECT_EMULATION)
         , m_is_text_prompt_exist(false)
         , m_is_esc_detected(false)
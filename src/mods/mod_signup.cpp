@@ -3,6 +3,7 @@
 #include "../model-sys/config.hpp"
 #include "../model-sys/users.hpp"
 #include "../encryption.hpp"
+#include "../communicator.hpp"
 
 // DataBase
 #include "../data-sys/security_dao.hpp"
@@ -1224,7 +1225,8 @@ bool ModSignup::verifyPassword(const std::string &input)
             }
 
             std::string salt = encryption->generate_salt(m_user_record->sHandle, m_config->bbs_uuid);
-            std::string password = encryption->generate_password(m_security_record->sPasswordHash, salt);
+            std::string password = encryption->generate_password(m_security_record->sPasswordHash, salt,
+                                       m_config->password_hash_iterations);
 
             if(salt.size() == 0 || password.size() == 0)
             {
@@ -1403,7 +1405,8 @@ bool ModSignup::verifyChallengeAnswer(const std::string &input)
             // Generate Password Hash
             std::string password = encryption->generate_password(
                                        m_security_record->sChallengeAnswerHash,
-                                       m_security_record->sSaltHash
+                                       m_security_record->sSaltHash,
+                                       m_config->password_hash_iterations
                                    );
 
             if(password.size() == 0)
@@ -1750,27 +1753,10 @@ bool ModSignup::backSpace(const std::string &input)
 
 
 /**
- * @brief Save New User Record
+ * @brief Save New User Record, queued on the Database thread.
  */
 void ModSignup::saveNewUserRecord()
 {
-    // StartUp Data Access Objects for SQL
-    users_dao_ptr user_dao(new UsersDao(m_session_data->m_user_database));
-    security_dao_ptr security_dao(new SecurityDao(m_session_data->m_user_database));
-
-    // Save New Security Record, index is then inserted into user record
-    long securityIndex = security_dao->insertRecord(m_security_record);
-    if (securityIndex < 0)
-    {
-        std::cout << "Error, unable to insert new user record." << std::endl;
-        displayPrompt(PROMPT_NOT_SAVED);
-        m_is_active = false;
-        return;
-    }
-
-    // Save New User Record
-    m_user_record->iSecurityIndex = securityIndex;
-
     //time_t const t = (time_t)time(0);
     std::time_t tt = 0;
     std::time_t const result = std::time(&tt);
@@ -1797,20 +1783,71 @@ void ModSignup::saveNewUserRecord()
         // Also Add Default File points,, missing from user rec.
     }
 
-    long userIndex = user_dao->insertRecord(m_user_record);
-    if (userIndex < 0)
+    // Copies are saved, the records here stay on this thread.
+    user_ptr user_record(new Users(*m_user_record));
+    security_ptr security_record(new Security(*m_security_record));
+
+    m_is_saving = true;
+    m_save_request = TheCommunicator::instance()->getUserDatabaseExecutor()->execute<long>(
+                         m_session_data->m_io_service, "ModSignup::saveNewUserRecord",
+                         [user_record, security_record](SQLW::Database &database) -> long
     {
-        std::cout << "Error, unable to insert new user record." << std::endl;
+        // StartUp Data Access Objects for SQL
+        UsersDao user_dao(database);
+        SecurityDao security_dao(database);
 
-        // Remove Secutiry Record if unable to create user record.
-        if (!security_dao->deleteRecord(securityIndex))
+        // Save New Security Record, index is then inserted into user record
+        long securityIndex = security_dao.insertRecord(security_record);
+        if (securityIndex < 0)
         {
-            std::cout << "Error, unable to remove security record." << std::endl;
+            std::cout << "Error, unable to insert new security record." << std::endl;
+            return -1;
         }
 
+        // Save New User Record
+        user_record->iSecurityIndex = securityIndex;
+        long userIndex = user_dao.insertRecord(user_record);
+        if (userIndex < 0)
+        {
+            std::cout << "Error, unable to insert new user record." << std::endl;
+
+            // Remove Secutiry Record if unable to create user record.
+            if (!security_dao.deleteRecord(securityIndex))
+            {
+                std::cout << "Error, unable to remove security record." << std::endl;
+            }
+            return -1;
+        }
+        return userIndex;
+    },
+    [this](long user_index)
+    {
+        handleNewUserSaved(user_index);
+
+        // Let the menu system see we're finished.
+        baseResumeAfterCallback();
+    });
+
+    if (!m_save_request)
+    {
+        handleNewUserSaved(-1);
+    }
+}
+
+/**
+ * @brief Callback on the IOService thread once the New User is Saved
+ * @param user_index -1 if nothing was saved.
+ */
+void ModSignup::handleNewUserSaved(long user_index)
+{
+    m_save_request.reset();
+    m_is_saving = false;
+    m_is_active = false;
+
+    if (user_index < 0)
+    {
         baseProcessDeliverNewLine();
         displayPromptAndNewLine(PROMPT_NOT_SAVED);
-        m_is_active = false;
         return;
     }
 
@@ -1830,9 +1867,6 @@ void ModSignup::saveNewUserRecord()
         // Then depending (once it's coded) state user is waiting on voting results.
         displayPromptAndNewLine(PROMPT_NOT_VALIDATED);
     }
-
-    m_is_active = false;
-    return;
 }
 
 
@@ -1842,6 +1876,12 @@ void ModSignup::saveNewUserRecord()
  */
 bool ModSignup::verifyAndSave(const std::string &input)
 {
+    // Waiting on the Database thread, drop any input.
+    if (m_is_saving)
+    {
+        return false;
+    }
+
     std::cout << "verifyAndSave: " << input << std::endl;
     std::string key = "";
     std::string result = m_session_io.getInputField(input, key, Config::sSingle_key_length);
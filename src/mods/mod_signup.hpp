@@ -12,6 +12,7 @@
 #include "../data-sys/users_dao.hpp"
 
 #include "../session_data.hpp"
+#include "../database_executor.hpp"
 
 #include <memory>
 #include <vector>
@@ -46,6 +47,7 @@ public:
         , m_mod_function_index(MOD_NUP)
         , m_is_text_prompt_exist(false)
         , m_newuser_password_attempts(0)
+        , m_is_saving(false)
     {
         std::cout << "ModSignup" << std::endl;
 
@@ -115,6 +117,12 @@ public:
     virtual ~ModSignup() override
     {
         std::cout << "~ModSignup" << std::endl;
+
+        // Save still queued, it completes without us.
+        if (m_save_request)
+        {
+            m_save_request->cancel();
+        }
         std::vector<std::function< void()> >().swap(m_setup_functions);
         std::vector<std::function< void(const std::string &)> >().swap(m_mod_functions);
     }
@@ -495,10 +503,16 @@ private:
     bool verifyAndSave(const std::string &input);
 
     /**
-     * @brief Save New User Record
+     * @brief Save New User Record, queued on the Database thread.
      */
     void saveNewUserRecord();
 
+    /**
+     * @brief Callback on the IOService thread once the New User is Saved
+     * @param user_index -1 if nothing was saved.
+     */
+    void handleNewUserSaved(long user_index);
+
 
     // Function Input Vector.
     std::vector<std::function< void()> >                    m_setup_functions;
@@ -515,6 +529,10 @@ private:
     bool                   m_is_text_prompt_exist;
     int                    m_newuser_password_attempts;
 
+    // Pending Save, input is ignored till it completes.
+    DatabaseExecutor::request_ptr m_save_request;
+    bool                   m_is_saving;
+
 };
 
 #endif // MOD_SIGNUP_HPP
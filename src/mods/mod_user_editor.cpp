@@ -6,11 +6,13 @@
 #include "../data-sys/users_dao.hpp"
 #include "../encryption.hpp"
 #include "../access_condition.hpp"
+#include "../communicator.hpp"
 
 #include <string>
 #include <vector>
 #include <cassert>
 #include <regex>
+#include <algorithm>
 
 /**
  * NOTE, changes to password and challenge q/a are saved right away to security record
@@ -92,6 +94,7 @@ void ModUserEditor::createTextPrompts()
     value[PROMPT_USER_FILTER]             = std::make_pair("Wildcard (Example 'me*' lists names starting with 'me')", "|CR|03%   |15|PD|CR|11!   |15Enter wildcard to |11FILTER|15 by, Leave empty for |11ALL|15 : ");
 
     value[PROMPT_INVALID_USER_NOT_EXISTS] = std::make_pair("Invalid User Doesn't Exist", "|CR|04Invalid, User doesn't exist.|CR");
+    value[PROMPT_USER_UPDATE_FAILED]      = std::make_pair("User Record Update Failed", "|CR|04Error, unable to save changes to the user record.|CR");
     value[PROMPT_USER_EDIT_HEADER]        = std::make_pair("User Fields Editor Header |OT User ID", "|CS|CR|03--- |15[|03Oblivion/2 XRM |07// |11User Editor|15] |03--- |11User ID : |15|OT |CR");
     value[PROMPT_USER_FIELD_INPUT_TEXT]   = std::make_pair("User Editor Command", "|CR|15User Editor C|07om|08mand |15: |07");
 
@@ -304,17 +307,9 @@ void ModUserEditor::setupUserList()
     baseTransformToUpper(string_filter);
     displayPromptMCI(PROMPT_HEADER, string_filter);
 
-    // Build a list of screen lines for the menu display
-    // So we know when to pause in large listing, or use pagenation.
-    std::string user_display_output = displayUserList();
-
-    if (m_user_display_list.size() == 0)
-    {
-        // Clear Out list if anything already exists.
-        std::vector<std::string>().swap(m_user_display_list);
-    }
-
-    m_user_display_list = m_common_io.splitString(user_display_output, '\n');
+    // Only the count is read here, each page reads just the users it displays.
+    users_dao_ptr user_data(new UsersDao(m_session_data->m_user_database));
+    m_users_count = user_data->getUsersCount(m_wildcard_filter);
     m_page = 0;
     displayCurrentPage(PROMPT_INPUT_TEXT);
 }
@@ -333,7 +328,7 @@ void ModUserEditor::setupUserEditFields()
 
     std::string user_count_display = std::to_string(m_current_user_id);
     user_count_display.append(baseGetDefaultStatColor() + " Record " + std::to_string(m_user_array_position+1) +
-                              " of " + std::to_string(m_users_listing.size()));
+                              " of " + std::to_string(m_users_count));
     displayPromptMCI(PROMPT_USER_EDIT_HEADER, user_count_display);
 
     if (m_user_display_list.size() == 0)
@@ -361,7 +356,7 @@ void ModUserEditor::setupUserEditExtendedFields()
 
     std::string user_count_display = std::to_string(m_current_user_id);
     user_count_display.append(baseGetDefaultStatColor() + " Record " + std::to_string(m_user_array_position+1) +
-                              " of " + std::to_string(m_users_listing.size()));
+                              " of " + std::to_string(m_users_count));
     displayPromptMCI(PROMPT_USER_EDIT_EXTENDED_HEADER, user_count_display);
 
     if (m_user_display_list.size() == 0)
@@ -600,7 +595,8 @@ void ModUserEditor::copyExistingUser(long user_id)
     // Setup for default password and challenge questions.
     encrypt_ptr encryption(new Encrypt());
     std::string salt = encryption->generate_salt(lookup_user->sHandle, m_config->bbs_uuid);
-    std::string password = encryption->generate_password(m_config->password_default_user, salt);
+    std::string password = encryption->generate_password(m_config->password_default_user, salt,
+                                                         m_config->password_hash_iterations);
 
     if(salt.size() == 0 || password.size() == 0)
     {
@@ -660,22 +656,6 @@ void ModUserEditor::deleteExistingUser(long user_id)
     user_data->deleteRecord(user_id);
 }
 
-/**
- * @brief Check if the user exists in the current listing by String Id
- * @param user_id
- */
-bool ModUserEditor::checkUserExistsById(long user_id)
-{
-    users_dao_ptr user_data(new UsersDao(m_session_data->m_user_database));
-    user_ptr lookup_user = user_data->getRecordById(user_id);
-
-    // Default Id when not found is -1
-    if (lookup_user->iId == -1)
-        return false;
-
-    return true;
-}
-
 /**
  * @brief Check if the user exists in the current listing by String Id
  * @param user_id
@@ -689,17 +669,21 @@ bool ModUserEditor::loadUserById(long user_id)
         return true;
     }
 
-    for (unsigned int i = 0; i < m_users_listing.size(); i++)
-    {
-        if (m_users_listing[i]->iId == user_id)
-        {
-            m_user_array_position = i;
-            m_loaded_user.push_back(m_users_listing[i]);
-            return true;
-        }
-    }
+    users_dao_ptr user_data(new UsersDao(m_session_data->m_user_database));
+    user_ptr lookup_user = user_data->getRecordById(user_id);
+
+    // Default Id when not found is -1
+    if (lookup_user->iId == -1)
+        return false;
+
+    // Only users in the current (filtered) listing can be loaded.
+    long position = user_data->getUserPosition(m_wildcard_filter, lookup_user);
+    if (position < 0)
+        return false;
 
-    return false;
+    m_user_array_position = position;
+    m_loaded_user.push_back(lookup_user);
+    return true;
 }
 
 /**
@@ -707,18 +691,20 @@ bool ModUserEditor::loadUserById(long user_id)
  */
 bool ModUserEditor::nextUserById()
 {
-    if (m_user_array_position+1 < m_users_listing.size())
-    {
-        if (m_loaded_user.size() > 0)
-            std::vector<user_ptr>().swap(m_loaded_user);
+    if (m_loaded_user.size() == 0)
+        return false;
+
+    users_dao_ptr user_data(new UsersDao(m_session_data->m_user_database));
+    user_ptr next_user = user_data->getAdjacentUser(m_wildcard_filter, m_loaded_user.back(), true);
+    if (next_user->iId == -1)
+        return false;
 
-        ++m_user_array_position;
-        m_loaded_user.push_back(m_users_listing[m_user_array_position]);
-        m_current_user_id = m_users_listing[m_user_array_position]->iId;
+    std::vector<user_ptr>().swap(m_loaded_user);
 
-        return true;
-    }
-    return false;
+    ++m_user_array_position;
+    m_loaded_user.push_back(next_user);
+    m_current_user_id = next_user->iId;
+    return true;
 }
 
 /**
@@ -726,17 +712,20 @@ bool ModUserEditor::nextUserById()
  */
 bool ModUserEditor::previousUserById()
 {
-    if (m_user_array_position > 0)
-    {
-        if (m_loaded_user.size() > 0)
-            std::vector<user_ptr>().swap(m_loaded_user);
+    if (m_loaded_user.size() == 0 || m_user_array_position == 0)
+        return false;
 
-        --m_user_array_position;
-        m_loaded_user.push_back(m_users_listing[m_user_array_position]);
-        m_current_user_id = m_users_listing[m_user_array_position]->iId;
-        return true;
-    }
-    return false;
+    users_dao_ptr user_data(new UsersDao(m_session_data->m_user_database));
+    user_ptr previous_user = user_data->getAdjacentUser(m_wildcard_filter, m_loaded_user.back(), false);
+    if (previous_user->iId == -1)
+        return false;
+
+    std::vector<user_ptr>().swap(m_loaded_user);
+
+    --m_user_array_position;
+    m_loaded_user.push_back(previous_user);
+    m_current_user_id = previous_user->iId;
+    return true;
 }
 
 /**
@@ -782,24 +771,26 @@ void ModUserEditor::displayCurrentPage(const std::string &input_state)
     if (m_page > 0)
         rows_used -= (m_ansi_process->m_number_lines - 2);
 
-    m_rows_per_page = max_rows - (rows_used + 2);
+    // Keep at least one row of users between the box borders.
+    int rows_per_page = static_cast<int>(max_rows) - static_cast<int>(rows_used + 2);
+    m_rows_per_page = (rows_per_page > 2) ? rows_per_page : 3;
 
-    bool displayed_all_rows = true;
-    for (unsigned int i = (m_page*(m_rows_per_page-2)); i < m_user_display_list.size(); i++)
+    // Three users per row, only the users on this page are read.
+    long users_per_page = (m_rows_per_page - 2) * 3;
+    std::string user_display_output = displayUserList(users_per_page, m_page * users_per_page);
+
+    std::vector<std::string>().swap(m_user_display_list);
+    m_user_display_list = m_common_io.splitString(user_display_output, '\n');
+
+    for (unsigned int i = 0; i < m_user_display_list.size(); i++)
     {
         std::string display_line = m_session_io.pipe2ansi(m_user_display_list[i]);
         display_line.append("\r\n");
         baseProcessAndDeliver(display_line);
-
-        if (i >= (m_page*m_rows_per_page) + m_rows_per_page)
-        {
-            // We've displayed the max amount of rows per the currnet
-            // screen break out and wait for prompt or next page.
-            displayed_all_rows = false;
-            break;
-        }
     }
 
+    bool displayed_all_rows = ((m_page + 1) * users_per_page >= m_users_count);
+
     // Default Page Input Method
     unsigned int current_module_input;
     switch(m_mod_setup_index)
@@ -830,43 +821,33 @@ void ModUserEditor::displayCurrentPage(const std::string &input_state)
 }
 
 /**
- * @brief User Editor, Read and Modify User Preferences
+ * @brief User Editor, Builds the User Listing for one Page
+ * @param limit
+ * @param offset
  * @return
  */
-std::string ModUserEditor::displayUserList()
+std::string ModUserEditor::displayUserList(long limit, long offset)
 {
     users_dao_ptr user_data(new UsersDao(m_session_data->m_user_database));
 
-    // Clear All Users
-    if (m_users_listing.size() > 0)
-        std::vector<user_ptr>().swap(m_users_listing);
-
-    if (m_wildcard_filter.size() > 0)
-    {
-        m_users_listing = user_data->getUsersByWildcard(m_wildcard_filter);
-    }
-    else
-    {
-        m_users_listing = user_data->getAllRecords();
-    }
-
-    // If no records, add message to user.
+    // Build a string list of individual menu options, rows are streamed straight into it.
     std::vector<std::string> result_set;
-    if (m_users_listing.size() == 0)
+    user_data->streamUsersPage(m_wildcard_filter, limit, offset, [&](user_ptr usr)
     {
-        result_set.push_back(baseGetDefaultStatColor() + m_common_io.rightPadding("No Records Found!", 24));
-    }
-
-    // Build a string list of individual menu options, then loop to fit as many per screen!
-    for(unsigned int i = 0; i < m_users_listing.size(); i++)
-    {
-        std::string option_string = m_common_io.rightPadding(std::to_string(m_users_listing[i]->iId), 5);
-        if (m_users_listing[i]->sHandle.size() == 0)
-            option_string.append(baseGetDefaultStatColor() + m_common_io.rightPadding(m_users_listing[i]->sRealName, 19));
+        std::string option_string = m_common_io.rightPadding(std::to_string(usr->iId), 5);
+        if (usr->sHandle.size() == 0)
+            option_string.append(baseGetDefaultStatColor() + m_common_io.rightPadding(usr->sRealName, 19));
         else
-            option_string.append(baseGetDefaultStatColor() + m_common_io.rightPadding(m_users_listing[i]->sHandle, 19));
+            option_string.append(baseGetDefaultStatColor() + m_common_io.rightPadding(usr->sHandle, 19));
 
         result_set.push_back(option_string);
+        return true;
+    });
+
+    // If no records, add message to user.
+    if (result_set.size() == 0)
+    {
+        result_set.push_back(baseGetDefaultStatColor() + m_common_io.rightPadding("No Records Found!", 24));
     }
 
     // iterate through and print out
@@ -975,9 +956,8 @@ void ModUserEditor::userEditorFieldInput(const std::string &input)
     // Provide Hotkeys only for switching to next/previous options
     switch(input[0])
     {
-            // TODO, update current users m_loaded_user -> m_users_list array with update also.
-            // So when we change users we keep the changes made!
-            // search m_users_listing for previous / next record.
+            // Previous / next record are read from the database in listing order,
+            // so saved changes are picked up when moving between users.
         case '[': // previous user
             previousUserById();
             redisplayModulePrompt();
@@ -1507,94 +1487,169 @@ void ModUserEditor::userEditorFieldHandler(const std::string &input)
 }
 
 /**
- * @brief Update the selected user record
+ * @brief Update the selected user record, written on the Database thread.
  */
 void ModUserEditor::updateExistingUser()
 {
     if (m_loaded_user.back()->iId == -1)
         return;
 
-    users_dao_ptr user_data(new UsersDao(m_session_data->m_user_database));
-    user_data->updateRecord(m_loaded_user.back());
+    // A copy is written, editing continues on the loaded record.
+    user_ptr user_record(new Users(*m_loaded_user.back()));
+    trackUpdateRequest(TheCommunicator::instance()->getUserDatabaseExecutor()->execute<bool>(
+        m_session_data->m_io_service, "UsersDao::updateRecord",
+        [user_record](SQLW::Database &database)
+    {
+        UsersDao user_data(database);
+        if (!user_data.updateRecord(user_record))
+        {
+            std::cout << "Error, unable to update user record." << std::endl;
+            return false;
+        }
+        return true;
+    },
+    std::bind(&ModUserEditor::handleUpdateResult, this, std::placeholders::_1)));
 }
 
 /**
- * @brief Updates an existing password index.
+ * @brief Updates an existing password index, hashed and written on the Database thread.
  * @param key_value
  */
 void ModUserEditor::updateExistingPassword(std::string key_value)
 {
-    security_dao_ptr security_dao(new SecurityDao(m_session_data->m_user_database));
-    security_ptr security_record(new Security());
+    long security_index = m_loaded_user.back()->iSecurityIndex;
+    int iterations = m_config->password_hash_iterations;
+    trackUpdateRequest(TheCommunicator::instance()->getUserDatabaseExecutor()->execute<bool>(
+        m_session_data->m_io_service, "ModUserEditor::updateExistingPassword",
+        [security_index, iterations, key_value](SQLW::Database &database)
+    {
+        SecurityDao security_dao(database);
 
-    // Pull Existing Security Record and re-use existing salt.
-    security_record = security_dao->getRecordById(m_loaded_user.back()->iSecurityIndex);
+        // Pull Existing Security Record and re-use existing salt.
+        security_ptr security_record = security_dao.getRecordById(security_index);
 
-    // Setup for default password and challenge questions.
-    encrypt_ptr encryption(new Encrypt());
-    std::string password = encryption->generate_password(key_value, security_record->sSaltHash);
+        // Setup for default password and challenge questions.
+        encrypt_ptr encryption(new Encrypt());
+        std::string password = encryption->generate_password(key_value, security_record->sSaltHash, iterations);
 
-    if(password.size() == 0)
-    {
-        std::cout << "Error, Password Hash empty" << std::endl;
-        assert(false);
-    }
+        if(password.size() == 0)
+        {
+            std::cout << "Error, Password Hash empty" << std::endl;
+            assert(false);
+        }
 
-    security_record->sPasswordHash = password;
-    if (!security_dao->updateRecord(security_record))
-    {
-        std::cout << "Error, unable to update password hash." << std::endl;
-        return;
-    }
+        security_record->sPasswordHash = password;
+        if (!security_dao.updateRecord(security_record))
+        {
+            std::cout << "Error, unable to update password hash." << std::endl;
+            return false;
+        }
+        return true;
+    },
+    std::bind(&ModUserEditor::handleUpdateResult, this, std::placeholders::_1)));
 }
 
 /**
- * @brief Updates an existing Challenge Answer.
+ * @brief Updates an existing Challenge Answer, hashed and written on the Database thread.
  * @param key_value
  */
 void ModUserEditor::updateExistingChallengeAnswer(std::string key_value)
 {
-    security_dao_ptr security_dao(new SecurityDao(m_session_data->m_user_database));
-    security_ptr security_record(new Security());
+    long security_index = m_loaded_user.back()->iSecurityIndex;
+    int iterations = m_config->password_hash_iterations;
+    trackUpdateRequest(TheCommunicator::instance()->getUserDatabaseExecutor()->execute<bool>(
+        m_session_data->m_io_service, "ModUserEditor::updateExistingChallengeAnswer",
+        [security_index, iterations, key_value](SQLW::Database &database)
+    {
+        SecurityDao security_dao(database);
 
-    // Pull Existing Security Record and re-use existing salt.
-    security_record = security_dao->getRecordById(m_loaded_user.back()->iSecurityIndex);
+        // Pull Existing Security Record and re-use existing salt.
+        security_ptr security_record = security_dao.getRecordById(security_index);
 
-    // Setup for default password and challenge questions.
-    encrypt_ptr encryption(new Encrypt());
-    std::string password = encryption->generate_password(key_value, security_record->sSaltHash);
+        // Setup for default password and challenge questions.
+        encrypt_ptr encryption(new Encrypt());
+        std::string password = encryption->generate_password(key_value, security_record->sSaltHash, iterations);
 
-    if(password.size() == 0)
-    {
-        std::cout << "Error, Challenge Answer Hash empty" << std::endl;
-        assert(false);
-    }
+        if(password.size() == 0)
+        {
+            std::cout << "Error, Challenge Answer Hash empty" << std::endl;
+            assert(false);
+        }
 
-    security_record->sChallengeAnswerHash = password;
-    if (!security_dao->updateRecord(security_record))
-    {
-        std::cout << "Error, unable to update Challenge Answer." << std::endl;
-        return;
-    }
+        security_record->sChallengeAnswerHash = password;
+        if (!security_dao.updateRecord(security_record))
+        {
+            std::cout << "Error, unable to update Challenge Answer." << std::endl;
+            return false;
+        }
+        return true;
+    },
+    std::bind(&ModUserEditor::handleUpdateResult, this, std::placeholders::_1)));
 }
 
 /**
- * @brief Updates an existing Challenge Question
+ * @brief Updates an existing Challenge Question, written on the Database thread.
  * @param key_value
  */
 void ModUserEditor::updateExistingChallengeQuestion(std::string key_value)
 {
-    security_dao_ptr security_dao(new SecurityDao(m_session_data->m_user_database));
-    security_ptr security_record(new Security());
+    long security_index = m_loaded_user.back()->iSecurityIndex;
+    trackUpdateRequest(TheCommunicator::instance()->getUserDatabaseExecutor()->execute<bool>(
+        m_session_data->m_io_service, "ModUserEditor::updateExistingChallengeQuestion",
+        [security_index, key_value](SQLW::Database &database)
+    {
+        SecurityDao security_dao(database);
+
+        // Pull Existing Security Record and re-use existing salt.
+        security_ptr security_record = security_dao.getRecordById(security_index);
+
+        security_record->sChallengeQuestion = key_value;
+        if (!security_dao.updateRecord(security_record))
+        {
+            std::cout << "Error, unable to update challenge question." << std::endl;
+            return false;
+        }
+        return true;
+    },
+    std::bind(&ModUserEditor::handleUpdateResult, this, std::placeholders::_1)));
+}
 
-    // Pull Existing Security Record and re-use existing salt.
-    security_record = security_dao->getRecordById(m_loaded_user.back()->iSecurityIndex);
+/**
+ * @brief Keep the Handle of a Queued Update so it's result is reported
+ * @param request
+ */
+void ModUserEditor::trackUpdateRequest(DatabaseExecutor::request_ptr request)
+{
+    // Drop handles of updates already reported.
+    m_update_requests.erase(
+        std::remove_if(m_update_requests.begin(), m_update_requests.end(),
+                       [](const DatabaseExecutor::request_ptr &pending)
+    {
+        return !pending->m_completion;
+    }),
+    m_update_requests.end());
 
-    security_record->sChallengeQuestion = key_value;
-    if (!security_dao->updateRecord(security_record))
+    if (request)
     {
-        std::cout << "Error, unable to update challenge question." << std::endl;
-        return;
+        m_update_requests.push_back(request);
+    }
+    else
+    {
+        // Executor is shutting down, the update was not queued.
+        handleUpdateResult(false);
+    }
+}
+
+/**
+ * @brief Callback on the IOService thread once an Update is Written
+ *        The Sysop is told when an edit was not saved.
+ * @param is_updated
+ */
+void ModUserEditor::handleUpdateResult(bool is_updated)
+{
+    if (!is_updated)
+    {
+        displayPrompt(PROMPT_USER_UPDATE_FAILED);
     }
 }
 
@@ -2,6 +2,7 @@
 #define MOD_USER_EDITOR_HPP
 
 #include "mod_base.hpp"
+#include "../database_executor.hpp"
 
 #include <string>
 #include <memory>
@@ -40,6 +41,7 @@ public:
         , m_current_field(0)
         , m_wildcard_filter("")
         , m_user_array_position(0)
+        , m_users_count(0)
     {
         std::cout << "ModUserEditor" << std::endl;
 
@@ -74,9 +76,14 @@ public:
     virtual ~ModUserEditor() override
     {
         std::cout << "~ModUserEditor" << std::endl;
+
+        // Writes still finish, the results are no longer wanted.
+        for (DatabaseExecutor::request_ptr &request : m_update_requests)
+        {
+            request->cancel();
+        }
         std::vector<std::function< void()> >().swap(m_setup_functions);
         std::vector<std::function< void(const std::string &)> >().swap(m_mod_functions);
-        std::vector<user_ptr>().swap(m_users_listing);
         std::vector<user_ptr>().swap(m_loaded_user);        
     }
 
@@ -139,6 +146,7 @@ public:
     const std::string PROMPT_USER_FILTER = "user_filter";
 
     const std::string PROMPT_INVALID_USER_NOT_EXISTS = "invalid_user_doesnt_exist";
+    const std::string PROMPT_USER_UPDATE_FAILED = "user_update_failed";
     const std::string PROMPT_USER_EDIT_HEADER = "user_editor_field_header";
     const std::string PROMPT_USER_FIELD_INPUT_TEXT = "user_editor_field_input";
     
@@ -399,10 +407,12 @@ public:
     void displayCurrentPage(const std::string &input_state);
     
     /**
-     * @brief User Editor, Read and Modify User Preferences
+     * @brief User Editor, Builds the User Listing for one Page
+     * @param limit
+     * @param offset
      * @return
      */
-    std::string displayUserList();
+    std::string displayUserList(long limit, long offset);
     
     /**
      * @brief Handles User Field Editor Command Selection
@@ -439,6 +449,18 @@ public:
      */
     void updateExistingChallengeQuestion(std::string key_value);
 
+    /**
+     * @brief Keep the Handle of a Queued Update so it's result is reported
+     * @param request
+     */
+    void trackUpdateRequest(DatabaseExecutor::request_ptr request);
+
+    /**
+     * @brief Callback on the IOService thread once an Update is Written
+     * @param is_updated
+     */
+    void handleUpdateResult(bool is_updated);
+
     /**
      * @brief Handles Extended Field Updates for User Data
      * @param input
@@ -474,9 +496,9 @@ private:
     // Function Input Vector.
     std::vector<std::function< void()> >                    m_setup_functions;
     std::vector<std::function< void(const std::string &)> > m_mod_functions;
-    std::vector<user_ptr>                                   m_users_listing;
     std::vector<std::string>                                m_user_display_list;    
     std::vector<user_ptr>                                   m_loaded_user;
+    std::vector<DatabaseExecutor::request_ptr>              m_update_requests;
 
     SessionIO              m_session_io;
     std::string            m_filename;
@@ -494,6 +516,7 @@ private:
     unsigned int           m_current_field;
     std::string            m_wildcard_filter;
     unsigned long          m_user_array_position;
+    long                   m_users_count;
     
     CommonIO               m_common_io;
     directory_ptr          m_directory;
@@ -0,0 +1,132 @@
+#ifndef NODE_ALLOCATOR_HPP
+#define NODE_ALLOCATOR_HPP
+
+#include <vector>
+#include <cstdint>
+
+/**
+ * @class NodeAllocator
+ * @author Michael Griffin
+ * @date 17/10/2026
+ * @file node_allocator.hpp
+ * @brief Node Numbers handed out lowest free first, starting at 1.
+ *        Nodes in use are bits in 64 bit words, a summary bitmap marks the words
+ *        with a free bit. Acquire is two count trailing zeros for the first 4096 nodes,
+ *        release is clearing the two bits. Not thread safe, the owner locks.
+ */
+class NodeAllocator
+{
+public:
+
+    explicit NodeAllocator()
+        : m_in_use(0)
+    { }
+
+    ~NodeAllocator()
+    { }
+
+    /**
+     * @brief Take the Lowest Free Node Number
+     * @return
+     */
+    int acquire()
+    {
+        for (size_t summary = 0; summary < m_free_words.size(); summary++)
+        {
+            if (m_free_words[summary] == 0)
+            {
+                continue;
+            }
+
+            size_t word = summary * BITS + __builtin_ctzll(m_free_words[summary]);
+            int bit = __builtin_ctzll(~m_words[word]);
+            return markInUse(word, bit);
+        }
+
+        // Every word is full, grow by one.
+        size_t word = m_words.size();
+        m_words.push_back(0);
+        if (word / BITS >= m_free_words.size())
+        {
+            m_free_words.push_back(0);
+        }
+        return markInUse(word, 0);
+    }
+
+    /**
+     * @brief Return a Node Number for reuse
+     * @param node_number
+     * @return false if it was not in use.
+     */
+    bool release(int node_number)
+    {
+        if (!isInUse(node_number))
+        {
+            return false;
+        }
+
+        size_t index = node_number - 1;
+        size_t word = index / BITS;
+        m_words[word] &= ~(1ULL << (index % BITS));
+        m_free_words[word / BITS] |= (1ULL << (word % BITS));
+        --m_in_use;
+        return true;
+    }
+
+    /**
+     * @brief Check if a Node Number is Taken
+     * @param node_number
+     * @return
+     */
+    bool isInUse(int node_number) const
+    {
+        if (node_number < 1)
+        {
+            return false;
+        }
+
+        size_t index = node_number - 1;
+        size_t word = index / BITS;
+        return word < m_words.size() && (m_words[word] & (1ULL << (index % BITS))) != 0;
+    }
+
+    /**
+     * @brief Number of Nodes Taken
+     * @return
+     */
+    int getInUseCount() const
+    {
+        return m_in_use;
+    }
+
+private:
+
+    static const size_t BITS = 64;
+
+    /**
+     * @brief Set the Node bit, the word leaves the summary once it's full.
+     * @param word
+     * @param bit
+     * @return Node Number
+     */
+    int markInUse(size_t word, int bit)
+    {
+        m_words[word] |= (1ULL << bit);
+        if (m_words[word] == ~0ULL)
+        {
+            m_free_words[word / BITS] &= ~(1ULL << (word % BITS));
+        }
+        else
+        {
+            m_free_words[word / BITS] |= (1ULL << (word % BITS));
+        }
+        ++m_in_use;
+        return static_cast<int>(word * BITS + bit + 1);
+    }
+
+    std::vector<uint64_t> m_words;       // Bit set, Node in use.
+    std::vector<uint64_t> m_free_words;  // Bit set, Word has a free Node.
+    int                   m_in_use;
+};
+
+#endif // NODE_ALLOCATOR_HPP
@@ -0,0 +1,212 @@
+#ifndef PASSWORD_HASHER_HPP
+#define PASSWORD_HASHER_HPP
+
+#include "encryption.hpp"
+#include "async_completion.hpp"
+#include "io_service.hpp"
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <functional>
+#include <memory>
+
+class PasswordHasher;
+typedef std::shared_ptr<PasswordHasher> password_hasher_ptr;
+
+/**
+ * @class PasswordHasher
+ * @author Michael Griffin
+ * @date 17/10/2026
+ * @file password_hasher.hpp
+ * @brief Runs Password Verification on a small pool of worker threads.
+ *        PBKDF2 is slow by design, running it on the IOService thread stalls every
+ *        session sharing that thread. Results come back through AsyncCompletion.
+ */
+class PasswordHasher
+{
+public:
+
+    typedef std::function<void(bool)> verify_callback;
+
+    /**
+     * @class VerifyRequest
+     * @author Michael Griffin
+     * @date 17/10/2026
+     * @file password_hasher.hpp
+     * @brief Handle to a Pending Verification.
+     */
+    class VerifyRequest : public AsyncCompletion
+    {
+    public:
+        VerifyRequest(IOService &io_service, const std::string &password, const std::string &salt,
+                      const std::string &password_hash, verify_callback callback)
+            : AsyncCompletion(io_service)
+            , m_password(password)
+            , m_salt(salt)
+            , m_password_hash(password_hash)
+            , m_is_valid(new bool(false))
+        {
+            if (callback)
+            {
+                // Filled on the worker, read back on the IOService thread.
+                std::shared_ptr<bool> is_valid = m_is_valid;
+                m_completion = [callback, is_valid]()
+                {
+                    callback(*is_valid);
+                };
+            }
+        }
+
+        std::string           m_password;
+        std::string           m_salt;
+        std::string           m_password_hash;
+        std::shared_ptr<bool> m_is_valid;
+    };
+    typedef std::shared_ptr<VerifyRequest> verify_request_ptr;
+
+    explicit PasswordHasher(int worker_count)
+        : m_worker_count(worker_count > 0 ? worker_count : 1)
+        , m_is_running(false)
+    { }
+
+    ~PasswordHasher()
+    {
+        std::cout << "~PasswordHasher" << std::endl;
+        shutdown();
+    }
+
+    /**
+     * @brief Start the Worker Threads.
+     */
+    void start()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_is_running)
+        {
+            return;
+        }
+        m_is_running = true;
+        for (int i = 0; i < m_worker_count; i++)
+        {
+            m_workers.push_back(std::thread(&PasswordHasher::run, this));
+        }
+    }
+
+    /**
+     * @brief Stop and Join the Workers, requests still queued are dropped.
+     */
+    void shutdown()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_is_running = false;
+            m_requests.clear();
+        }
+        m_condition.notify_all();
+
+        for (std::thread &worker : m_workers)
+        {
+            if (worker.joinable())
+            {
+                worker.join();
+            }
+        }
+        m_workers.clear();
+    }
+
+    /**
+     * @brief Verify a Password off the IOService thread.
+     *        The callback is executed on the IOService thread with the result,
+     *        unless the returned request has been cancelled or released first.
+     *        Without running workers, the hash is done inline.
+     * @param io_service
+     * @param password
+     * @param salt
+     * @param password_hash
+     * @param callback
+     * @return Keep this while waiting on the callback.
+     */
+    verify_request_ptr verifyAsync(IOService &io_service, const std::string &password, const std::string &salt,
+                                   const std::string &password_hash, verify_callback callback)
+    {
+        verify_request_ptr request(new VerifyRequest(io_service, password, salt, password_hash, callback));
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_is_running)
+            {
+                m_requests.push_back(request);
+                m_condition.notify_one();
+                return request;
+            }
+        }
+
+        processRequest(request);
+        return request;
+    }
+
+    /**
+     * @brief Number of Requests waiting for a Worker
+     * @return
+     */
+    size_t getPendingCount()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_requests.size();
+    }
+
+private:
+
+    /**
+     * @brief Worker Loop
+     */
+    void run()
+    {
+        while (true)
+        {
+            verify_request_ptr request;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_condition.wait(lock, [this]
+                {
+                    return !m_is_running || !m_requests.empty();
+                });
+
+                if (!m_is_running)
+                {
+                    return;
+                }
+
+                request = m_requests.front();
+                m_requests.pop_front();
+            }
+
+            processRequest(request);
+        }
+    }
+
+    /**
+     * @brief Hash and Post the Result back to the IOService.
+     * @param request
+     */
+    void processRequest(verify_request_ptr request)
+    {
+        Encrypt encryption;
+        *request->m_is_valid = encryption.verify_password(request->m_password, request->m_salt,
+                                                          request->m_password_hash);
+        AsyncCompletion::post(request);
+    }
+
+    int                                   m_worker_count;
+    bool                                  m_is_running;
+    std::mutex                            m_mutex;
+    std::condition_variable               m_condition;
+    std::deque<verify_request_ptr>        m_requests;
+    std::vector<std::thread>              m_workers;
+};
+
+#endif // PASSWORD_HASHER_HPP
@@ -118,6 +118,12 @@ extern "C" void *executeProcessLoop(void *args)
 
         if (FD_ISSET(threadArgs->m_pty_file_desc, &rdfdset))
         {
+            // Hold off reading while the client is backed up, the door
+            // then blocks on a full pty instead of growing our output queue.
+            while (threadArgs->m_session->m_is_process_running
+                    && !threadArgs->m_session->waitForOutputDrain(100))
+            { }
+
             memset(&character_buffer, 0, 1024);
             selret = read(threadArgs->m_pty_file_desc, character_buffer, 1023);
 
@@ -129,7 +135,8 @@ extern "C" void *executeProcessLoop(void *args)
 
             if (threadArgs->m_session)
             {
-                std::string buffer(reinterpret_cast<char*>(character_buffer));
+                // Length from the read, binary output may hold nulls.
+                std::string buffer(reinterpret_cast<char*>(character_buffer), selret);
                 threadArgs->m_session->deliver(buffer);
             }
         }
@@ -140,6 +140,13 @@ void ProcessWin::executeProcessLoop()
         }
 
 
+        // Hold off reading while the client is backed up, the door
+        // then blocks on a full pipe instead of growing our output queue.
+        if (m_session && !m_session->waitForOutputDrain(100))
+        {
+            continue;
+        }
+
         // Handle Naped Pipes for STDIO Output of protocols.
         PeekNamedPipe(m_read_stdout, buf, RCVBUFSIZE, &bread, &avail, NULL);
 
@@ -149,13 +156,14 @@ void ProcessWin::executeProcessLoop()
             memset(&tmpbuf, 0, sizeof(tmpbuf));
             ReadFile(m_read_stdout, tmpbuf, RCVBUFSIZE, &bread, NULL);  //read the stdout pipe
 
-            if (strlen((const char *)tmpbuf) > 0)
+            if (bread > 0)
             {
-                std::cout << "buffer [" << tmpbuf << "] " <<std::endl;
+                std::cout << "buffer [" << bread << "] " <<std::endl;
 
                 if (m_session)
                 {
-                    std::string buffer(reinterpret_cast<char*>(tmpbuf));
+                    // Length from the read, binary output may hold nulls.
+                    std::string buffer(reinterpret_cast<char*>(tmpbuf), bread);
                     m_session->deliver(buffer);
                 }
             }
@@ -195,6 +195,11 @@ int SDLCALL SDLNet_TCP_Recv(TCPsocket sock, void *data, int maxlen);
 /* Close a TCP network socket */
 void SDLCALL SDLNet_TCP_Close(TCPsocket sock);
 
+/* Get the underlying system socket descriptor for readiness polling.
+   Returns -1 if the socket is not open.
+*/
+int SDLCALL SDLNet_TCP_GetSocketDescriptor(TCPsocket sock);
+
 
 /***********************************************************************/
 /* UDP network API                                                     */
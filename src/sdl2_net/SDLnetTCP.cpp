@@ -300,3 +300,12 @@ void SDLNet_TCP_Close(TCPsocket sock)
         SDL_free(sock);
     }
 }
+
+/* Get the underlying system socket descriptor for readiness polling */
+int SDLNet_TCP_GetSocketDescriptor(TCPsocket sock)
+{
+    if ( sock == NULL || sock->channel == INVALID_SOCKET ) {
+        return(-1);
+    }
+    return((int)sock->channel);
+}
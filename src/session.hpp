@@ -16,6 +16,8 @@
 #include <list>
 #include <string>
 #include <cassert>
+#include <chrono>
+#include <functional>
 
 /*
  * NOTES TODO: Sessions should also have incoming notification buffer
@@ -62,10 +64,12 @@ public:
         if(connection->isActive())
         {
             new_session->m_session_data->startUpSessionStats("Telnet");
-            new_session->m_session_data->waitingForData();
         }
 
         // Send out Telnet Negoiation Options
+        // This runs on the listener thread, so every reply and the negotiation
+        // callback is queued before the first read is armed on the session's
+        // own IO_Service, after that only its thread touches the decoder.
         if(connection->isActive())
         {
             // On initial Session Connection,  setup and send TELNET Options to
@@ -106,16 +110,26 @@ public:
             new_session->m_session_data->m_telnet_state->sendIACSequences(DO, TELOPT_NAWS);
             new_session->m_session_data->m_telnet_state->addReply(TELOPT_NAWS);
 
+            // MCCP2, output is compressed once the client agrees.
+            if (connection->getSocketHandle()->getCompressionLevel() > 0)
+            {
+                new_session->m_session_data->m_telnet_state->sendIACSequences(WILL, TELOPT_MCCP_2);
+                new_session->m_session_data->m_telnet_state->addReply(TELOPT_MCCP_2);
+            }
+
             // No replies, this can really not be used, only informational.
             //new_session->m_session_data->m_telnet_state->sendIACSequences(DO, TELOPT_NEW_ENVIRON);
             //new_session->m_session_data->m_telnet_state->addReply(TELOPT_NEW_ENVIRON);
 
             std::cout << "send initial IAC sequences ended." << std::endl;
 
-            // Wait 1.5 Seconds for respones.
+            // Wait up to 1.5 Seconds for respones.
             new_session->startDetectionTimer();
 
             std::cout << "sleep ended." << std::endl;
+
+            // Replies are all queued, now start reading the client's answers.
+            new_session->m_session_data->waitingForData();
         }
 
         return new_session;
@@ -123,88 +137,83 @@ public:
 
     /**
      * @brief Telopt Sequences timer
+     *        Detection finishes once every reply is answered or refused,
+     *        the timer is only the upper bound for clients that never answer.
      */
     void startDetectionTimer()
     {       
+        m_negotiation_start = std::chrono::steady_clock::now();
+
+        // Installed before input is armed, so the last reply can't be missed.
+        std::weak_ptr<Session> weak_session = shared_from_this();
+        m_session_data->m_telnet_state->setNegotiationCallback([weak_session]()
+        {
+            session_ptr session = weak_session.lock();
+            if(session)
+            {
+                session->handleNegotiationComplete();
+            }
+        });
+
         // Add Deadline Timer for 1.5 seconds for complete Telopt Sequences reponses
-        m_deadline_timer->setWaitInMilliseconds(1500);
+        m_deadline_timer->setWaitInMilliseconds(DETECTION_TIMEOUT_MS);
         m_deadline_timer->asyncWait(
             std::bind(&Session::handleDetectionTimer, shared_from_this())
         );
     }
 
     /**
-     * @brief Deadline Detection Timer for Negoiation
-     * @param timer
+     * @brief Every Reply is in, move the Detection Timer up.
+     *        It fires after the read that finished negotiation is handled.
      */
-    void handleDetectionTimer()
+    void handleNegotiationComplete()
     {
-        std::cout << "handleDetectionTimer Completed!" << std::endl;
+        if(m_is_detection_complete)
+        {
+            return;
+        }
 
-        // Detection Completed, start ip the Pre-Logon Sequence State.
-        state_ptr new_state(new MenuSystem(m_session_data));
-        m_state_manager->changeState(new_state);
+        m_deadline_timer->setWaitInMilliseconds(0);
+        m_deadline_timer->asyncWait(
+            std::bind(&Session::handleDetectionTimer, shared_from_this())
+        );
     }
 
     /**
-     * @brief Callback from The Broadcaster to write data to the active sessions.
-     * @param msg
+     * @brief Deadline Detection Timer for Negoiation
+     * @param timer
      */
-    void deliver(const std::string &msg)
+    void handleDetectionTimer()
     {
-        if(msg.size() == 0 || msg[0] == '\0')
+        if(m_is_detection_complete)
         {
             return;
         }
+        m_is_detection_complete = true;
+        m_session_data->m_telnet_state->setNegotiationCallback(nullptr);
 
-        if(m_connection->isActive() && TheCommunicator::instance()->isActive())
-        {
-            m_connection->asyncWrite(msg,
-                                     std::bind(
-                                         &Session::handleWrite,
-                                         shared_from_this(),
-                                         std::placeholders::_1,
-                                         std::placeholders::_2));
-        }
+        // Record how long the client took, capped by the timeout.
+        long elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+                           std::chrono::steady_clock::now() - m_negotiation_start).count();
+        m_session_data->m_session_stats->iNegotiationMs = static_cast<int>(elapsed);
+        m_session_data->updateSessionStats();
+
+        std::cout << "handleDetectionTimer Completed! " << elapsed << "ms" << std::endl;
+
+        // Detection Completed, start ip the Pre-Logon Sequence State.
+        state_ptr new_state(new MenuSystem(m_session_data));
+        m_state_manager->changeState(new_state);
     }
 
     /**
-     * @brief Callback after Writing Data, If error/hangup notifies
-     *        Everyone this person has left.
-     * @param error
+     * @brief Callback from The Broadcaster to write data to the active sessions.
+     *        Goes through SessionData so relayed text is encoded and IAC escaped
+     *        the same as the session's own output.
+     * @param msg
      */
-    void handleWrite(const std::error_code& error, socket_handler_ptr)
+    void deliver(const std::string &msg)
     {
-        if(error)
-        {
-            std::cout << "async_write error: " << error.message() << std::endl;
-            std::cout << "Session Closed()" << std::endl;
-        }
-
-        session_manager_ptr session_manager = m_session_data->m_session_manager.lock();
-        if(session_manager && error && (!m_session_data->m_is_leaving))
-        {
-            m_session_data->m_is_leaving = true;
-
-            // Disconenct the session.
-            session_manager->leave(m_session_data->m_node_number);
-
-            if(m_connection->isActive())
-            {
-                try
-                {
-                    std::cout << "Leaving (NORMAL SESSION) Client IP: "
-                              //<< m_connection->m_normal_socket.remote_endpoint().address().to_string()
-                              << std::endl;
-
-                    m_connection->shutdown();
-                }
-                catch(std::exception &ex)
-                {
-                    std::cout << "Exception closing socket(): " << ex.what() << std::endl;
-                }
-            }
-        }
+        m_session_data->deliver(msg);
     }
 
     /**
@@ -219,6 +228,8 @@ public:
         , m_state_manager(new StateManager())
         , m_session_data(new SessionData(connection, session_manager, io_service, m_state_manager))
         , m_deadline_timer(deadline_timer)
+        , m_is_detection_complete(false)
+        , m_negotiation_start(std::chrono::steady_clock::now())
     {
         if(m_connection->isActive())
         {
@@ -246,6 +257,12 @@ public:
     socket_handler_ptr  m_socket_handler;
     deadline_timer_ptr  m_deadline_timer;
 
+    // Upper bound on Telnet Option Negotiation.
+    static const int DETECTION_TIMEOUT_MS = 1500;
+
+    bool                                  m_is_detection_complete;
+    std::chrono::steady_clock::time_point m_negotiation_start;
+
 };
 
 
@@ -43,20 +43,7 @@ void SessionData::handleRead(const std::error_code& error, socket_handler_ptr)
             if(m_parsed_data.size() > 0)
             {
                 // Windows Console Telnet sends [CR\LF] for ENTER!
-                // search and replace input buffer we only need one!
-                std::string::size_type id1 = 0;
-                do
-                {
-                    // Convert CR\LF to LF!
-                    id1 = m_parsed_data.find("\r\n", 0);
-                    if(id1 != std::string::npos)
-                    {
-                        m_parsed_data.erase(id1, 1);
-                        id1 = m_parsed_data.find("\r\n", 0);
-                    }
-                }
-                while(id1 != std::string::npos);
-
+                // The decoder already passed it on as a single CR.
 
                 // If were in a process, skip stat and ESC timer.
                 if (m_is_process_running)
@@ -241,25 +228,26 @@ void SessionData::handleEscTimer()
 void SessionData::startUpSessionStats(std::string sessionType) 
 {
     std::cout << "startUpSessionStats: " << sessionType << std::endl;
-     
-    // Check Table setup for Session Stats
-    session_stats_dao_ptr session_stat_dao(new SessionStatsDao(m_user_database));
-    // Verify if the user table exists.
-    if (session_stat_dao)
-    {        
-        std::time_t current_time = 0;
-        std::time_t const dateTime = std::time(&current_time);
-    
-        m_session_stats->sSessionType = sessionType;
-        m_session_stats->dtStartDate = dateTime;
-        
-        long id = session_stat_dao->insertRecord(m_session_stats);
-        if (id < 0) 
-        {
-            std::cout << "SessionStats, error on insert: " << m_session_stats->iId << std::endl;
-            return;
-        }
-        
-        m_session_stats->iId = id;
+
+    std::time_t current_time = 0;
+    std::time_t const dateTime = std::time(&current_time);
+
+    m_session_stats->sSessionType = sessionType;
+    m_session_stats->dtStartDate = dateTime;
+
+    // Queued, the insert is done in the background with other sessions.
+    m_stats_writer = TheCommunicator::instance()->getStatsWriter();
+    m_stats_key = m_stats_writer->createSessionKey();
+    m_stats_writer->pushSessionStats(StatsWriter::STATS_SESSION_START, m_stats_key, m_session_stats);
+}
+
+/**
+ * @brief Queue the Current Session Stats to be Written
+ */
+void SessionData::updateSessionStats()
+{
+    if (m_stats_writer)
+    {
+        m_stats_writer->pushSessionStats(StatsWriter::STATS_SESSION_UPDATE, m_stats_key, m_session_stats);
     }
 }
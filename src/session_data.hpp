@@ -13,6 +13,7 @@
 #include "session_manager.hpp"
 #include "common_io.hpp"
 #include "deadline_timer.hpp"
+#include "stats_writer.hpp"
 
 #include "model-sys/structures.hpp"
 #include "model-sys/struct_compat.hpp"
@@ -53,13 +54,14 @@ public:
         : m_connection(connection)
         , m_session_manager(room)
         , m_telnet_state(new TelnetDecoder(connection))
-        , m_esc_input_timer(new DeadlineTimer())
+        , m_esc_input_timer(new DeadlineTimer(io_service))
         , m_state_manager(state_manager)
         , m_io_service(io_service)
         , m_common_io()
-        , m_user_database(USERS_DATABASE, &m_database_log)
+        , m_user_database(TheCommunicator::instance()->getUserDatabase())
         , m_user_record(new Users())
         , m_session_stats(new SessionStats())
+        , m_stats_key(0)
         , m_node_number(0)
         , m_is_use_ansi(true)
         , m_output_encoding("cp437")
@@ -76,6 +78,14 @@ public:
     ~SessionData()
     {
         std::cout << "~SessionData" << std::endl;
+
+        // Final Stats are queued, the writer records them after we are gone.
+        if (m_stats_writer)
+        {
+            m_session_stats->dtEndDate = std::time(nullptr);
+            m_stats_writer->pushSessionStats(StatsWriter::STATS_SESSION_END, m_stats_key, m_session_stats);
+        }
+
         for (unsigned int i = 0; i < m_processes.size(); i++)
         {
             m_processes[i]->terminate();
@@ -89,8 +99,8 @@ public:
     void waitingForData()
     {
         // Important, clear out buffer before each read.
-        //memset(&m_raw_data, 0, max_length);
-        std::vector<unsigned char>().swap(m_in_data_vector);
+        // Capacity is kept so the buffer is reused for the next read.
+        m_in_data_vector.clear();
         if(m_connection->isActive() && TheCommunicator::instance()->isActive())
         {
             m_connection->asyncRead(m_in_data_vector,
@@ -104,37 +114,20 @@ public:
 
     /**
      * @brief Handle Telnet Options in incoming data
-     * raw data is read in from socket
+     * raw data is read in from socket, only the bytes received.
      * m_parsed_data is filled with parsed out options.
      */
     void handleTeloptCodes()
     {
-        unsigned char ch = 0;
-        for(auto c : m_in_data_vector)
+        try
         {
-            try
-            {
-                // Enter the Telnet_State and handle parsing options.
-                ch = m_telnet_state->telnetOptionParse(c);
-            }
-            catch(std::exception& e)
-            {
-                std::cout << "Exception telnet_process_char: " << e.what() << std::endl;
-            }
-
-            // Skip any incoming nulls, nulls are also return on Telnet options received
-            // So we know that there is no valid text data to send to the client.
-            if(ch == '\0')
-            {
-                continue;
-            }
-
-            // Incoming Buffer is filled and Telnet options are parsed out.
-            m_parsed_data += ch;
+            // Enter the Telnet_State and handle parsing options, nulls are skipped.
+            m_telnet_state->decode(m_in_data_vector.data(), m_in_data_vector.size(), m_parsed_data);
+        }
+        catch(std::exception& e)
+        {
+            std::cout << "Exception telnet_process_char: " << e.what() << std::endl;
         }
-
-        // Clear the Session's Socket Buffer for next set of data.
-        //memset(&m_raw_data, 0, max_length);
     }
 
     /**
@@ -156,25 +149,29 @@ public:
      */
     void deliver(const std::string &msg)
     {
-        if(msg.size() == 0 || msg[0] == '\0')
+        if(msg.size() == 0)
         {
             return;
         }
 
         // handle output encoding, if utf-8 translate data accordingly.
+        // In Binary Mode 0xFF is sent as IAC IAC, utf-8 never contains it.
         std::string outputBuffer = "";
+        bool is_encoded = false;
         if (m_output_encoding != "cp437")
         {
             outputBuffer = m_common_io.translateUnicode(msg);
+            is_encoded = true;
         }
-        else
+        else if (m_telnet_state->isBinary())
         {
-            outputBuffer = msg;
+            is_encoded = TelnetDecoder::escapeIAC(msg, outputBuffer);
         }
 
         if(m_connection->isActive() && TheCommunicator::instance()->isActive())
         {
-            m_connection->asyncWrite(outputBuffer,
+            // The encoded buffer is moved into the socket's output queue.
+            m_connection->asyncWrite((is_encoded ? std::move(outputBuffer) : msg),
                                       std::bind(
                                           &SessionData::handleWrite,
                                           shared_from_this(),
@@ -183,6 +180,16 @@ public:
         }
     }
 
+    /**
+     * @brief Pause Producers (Doors) while the clients output is backed up.
+     * @param milliseconds
+     * @return false if still backed up after the wait.
+     */
+    bool waitForOutputDrain(int milliseconds)
+    {
+        return m_connection->getSocketHandle()->waitForOutputDrain(milliseconds);
+    }
+
     /**
      * @brief Callback after Writing Data, If error/hangup notifies
      * everything this person has left.
@@ -273,6 +280,11 @@ public:
      */
     void startUpSessionStats(std::string sessionType);
 
+    /**
+     * @brief Queue the Current Session Stats to be Written
+     */
+    void updateSessionStats();
+
     /**
      * @brief Executes External Processes
      * @param cmdline
@@ -348,13 +360,16 @@ public:
 
     CommonIO              m_common_io;
 
-    // Temp while testing.
-    SQLW::Database        m_user_database;
-    SQLW::StderrLog       m_database_log;
+    // Shared Connection Pool, owned by the Communicator.
+    SQLW::Database       &m_user_database;
 
     user_ptr              m_user_record;
     session_stats_ptr     m_session_stats;
 
+    // Write Behind for Stats, the key links updates to the Session's record.
+    stats_writer_ptr      m_stats_writer;
+    unsigned long         m_stats_key;
+
     int                   m_node_number;
     bool                  m_is_use_ansi;
     std::string           m_output_encoding;
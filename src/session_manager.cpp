@@ -17,7 +17,24 @@ SessionManager::~SessionManager()
 void SessionManager::join(session_ptr session)
 {
     std::cout << "joined SessionManager" << std::endl;
-    m_sessions.insert(session);
+    int node_number = session->m_session_data->m_node_number;
+    if(node_number < 1)
+    {
+        std::cout << "Session without a Node Number, not joined." << std::endl;
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_session_mutex);
+    if(static_cast<size_t>(node_number) >= m_sessions.size())
+    {
+        m_sessions.resize(node_number + 1);
+    }
+
+    if(!m_sessions[node_number])
+    {
+        ++m_session_count;
+    }
+    m_sessions[node_number] = session;
 }
 
 /**
@@ -27,14 +44,15 @@ void SessionManager::join(session_ptr session)
 void SessionManager::leave(int node_number)
 {
     std::cout << "disconnecting Node Session: " << node_number << std::endl;
-    for(auto it = m_sessions.begin(); it != m_sessions.end(); it++)
+
+    // Hold the Session till after the lock is released, it may be the last reference.
+    session_ptr session;
+    std::lock_guard<std::mutex> lock(m_session_mutex);
+    if(node_number > 0 && static_cast<size_t>(node_number) < m_sessions.size() && m_sessions[node_number])
     {
-        if((*it)->m_session_data->m_node_number == node_number)
-        {
-            m_sessions.erase(it);
-            std::cout << "disconnecting Session completed." << std::endl;
-            break;
-        }
+        session.swap(m_sessions[node_number]);
+        --m_session_count;
+        std::cout << "disconnecting Session completed." << std::endl;
     }
 }
 
@@ -48,23 +66,76 @@ void SessionManager::deliver(std::string msg)
         return;
 
     std::cout << "deliver SessionManager notices: " << msg << std::endl;
-    std::for_each(m_sessions.begin(), m_sessions.end(),
-                  std::bind(&Session::deliver, std::placeholders::_1, std::ref(msg)));
+    std::lock_guard<std::mutex> lock(m_session_mutex);
+    for(auto &session : m_sessions)
+    {
+        if(session)
+        {
+            session->deliver(msg);
+        }
+    }
 }
 
 /**
- * @brief Retrieve Number of users connected
- * Also helpful for determinging next node number.
+ * @brief Session on a Node, for multi-node commands and sysop tools.
+ * @param node_number
+ * @return nullptr if the node is free.
+ */
+session_ptr SessionManager::getSession(int node_number)
+{
+    std::lock_guard<std::mutex> lock(m_session_mutex);
+    if(node_number < 1 || static_cast<size_t>(node_number) >= m_sessions.size())
+    {
+        return nullptr;
+    }
+    return m_sessions[node_number];
+}
+
+/**
+ * @brief Send a message to the Session on a single Node.
+ * @param node_number
+ * @param msg
+ * @return false if the node is free.
+ */
+bool SessionManager::deliverToNode(int node_number, std::string msg)
+{
+    session_ptr session = getSession(node_number);
+    if(!session || msg.size() == 0)
+    {
+        return false;
+    }
+
+    session->deliver(msg);
+    return true;
+}
+
+/**
+ * @brief Node Numbers with a Session, lowest first.
  * @return
  */
-int SessionManager::connections()
+std::vector<int> SessionManager::getActiveNodes()
 {
-    int count = 0;
-    for(auto it = begin(m_sessions); it != end(m_sessions); ++it)
+    std::vector<int> nodes;
+    std::lock_guard<std::mutex> lock(m_session_mutex);
+    nodes.reserve(m_session_count);
+    for(size_t node_number = 1; node_number < m_sessions.size(); node_number++)
     {
-        ++count;
+        if(m_sessions[node_number])
+        {
+            nodes.push_back(static_cast<int>(node_number));
+        }
     }
-    return count;
+    return nodes;
+}
+
+/**
+ * @brief Retrieve Number of users connected
+ * @return
+ */
+int SessionManager::connections()
+{
+    std::lock_guard<std::mutex> lock(m_session_mutex);
+    return m_session_count;
 }
 
 /**
@@ -73,9 +144,19 @@ int SessionManager::connections()
  */
 void SessionManager::shutdown()
 {
-    for(auto it = begin(m_sessions); it != end(m_sessions); ++it)
+    // Sessions are released after the lock, each may be the last reference.
+    std::vector<session_ptr> sessions;
+    {
+        std::lock_guard<std::mutex> lock(m_session_mutex);
+        sessions.swap(m_sessions);
+        m_session_count = 0;
+    }
+
+    for(auto &session : sessions)
     {
-        (*it)->m_connection->shutdown();
-        m_sessions.erase(it);
+        if(session)
+        {
+            session->m_connection->shutdown();
+        }
     }
 }
@@ -5,6 +5,8 @@
 #include <iostream>
 #include <string>
 #include <set>
+#include <vector>
+#include <mutex>
 
 class Session;
 typedef std::shared_ptr<Session> session_ptr;
@@ -19,11 +21,13 @@ typedef std::shared_ptr<SessionSSL> session_ssl_ptr;
  * @file session_manager.hpp
  * @brief Main Channel of Communications between Sessions
  * Also Very Import, keeps handle on Active Sessions and keeps smart pointers alive!
+ * Sessions are indexed by Node Number, so finding a node is a direct lookup.
  */
 class SessionManager
 {
 public:
     explicit SessionManager()
+        : m_session_count(0)
     {
         std::cout << "SessionManager" << std::endl;
     }
@@ -38,12 +42,38 @@ public:
     void leave(int node_number);
     void deliver(std::string msg);
 
+    /**
+     * @brief Session on a Node, for multi-node commands and sysop tools.
+     * @param node_number
+     * @return nullptr if the node is free.
+     */
+    session_ptr getSession(int node_number);
+
+    /**
+     * @brief Send a message to the Session on a single Node.
+     * @param node_number
+     * @param msg
+     * @return false if the node is free.
+     */
+    bool deliverToNode(int node_number, std::string msg);
+
+    /**
+     * @brief Node Numbers with a Session, lowest first.
+     * @return
+     */
+    std::vector<int> getActiveNodes();
+
     int connections();
     void shutdown();
 
 private:
 
-    std::set<session_ptr> m_sessions;
+    // Sessions are joined and removed from multiple IOService threads.
+    mutable std::mutex    m_session_mutex;
+
+    // Index is the Node Number, free nodes are nullptr.
+    std::vector<session_ptr>  m_sessions;
+    int                       m_session_count;
     std::set<session_ssl_ptr> m_sessions_ssl;
 };
 
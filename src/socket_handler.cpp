@@ -4,6 +4,8 @@
 
 #include <iostream>
 #include <exception>
+#include <algorithm>
+#include <chrono>
 
 /**
  * @brief Send Socket Data
@@ -197,12 +199,13 @@ bool SocketHandler::connectIrcSocket(std::string host, int port)
 */
 
 /**
- * @brief Connect Telnet Socket
+ * @brief Create Telnet Listener Socket
  * @param host
  * @param port
+ * @param is_native POSIX Sockets instead of SDL_net
  * @return
  */
-bool SocketHandler::createTelnetAcceptor(std::string host, int port)
+bool SocketHandler::createTelnetAcceptor(std::string host, int port, bool is_native)
 {
     std::cout << "SocketHandler::initTelnet Server" << std::endl;
     if(!m_is_active)
@@ -210,7 +213,22 @@ bool SocketHandler::createTelnetAcceptor(std::string host, int port)
         try
         {
             m_socket_type = SOCKET_TYPE_TELNET;
-            socket_state_ptr sdl_socket(new SDL_Socket(host, port));
+            socket_state_ptr sdl_socket;
+#ifndef _WIN32
+            if(is_native)
+            {
+                sdl_socket.reset(new POSIX_Socket(host, port));
+            }
+            else
+#else
+            if(is_native)
+            {
+                std::cout << "Native Sockets not available, using SDL_net." << std::endl;
+            }
+#endif
+            {
+                sdl_socket.reset(new SDL_Socket(host, port));
+            }
             m_socket.push_back(sdl_socket);
             if(m_socket.back()->onListen())
             {
@@ -257,6 +275,19 @@ std::string SocketHandler::getSocketType() const
     return m_socket_type;
 }
 
+/**
+ * @brief Remote Address of the Connection
+ * @return
+ */
+std::string SocketHandler::getRemoteAddress() const
+{
+    if(m_socket.size() == 0 || !m_socket.back())
+    {
+        return "";
+    }
+    return m_socket.back()->m_host;
+}
+
 /**
  * @brief Check if Socket is Active
  * @return
@@ -272,6 +303,398 @@ bool SocketHandler::isActive() const
 void SocketHandler::setInactive()
 {
     m_is_active = false;
+
+    // Release any Producers waiting on output to drain.
+    std::lock_guard<std::mutex> lock(m_output_mutex);
+    m_output_drained.notify_all();
+}
+
+/**
+ * @brief Socket Descriptor used for Reactor Registration
+ * @return
+ */
+int SocketHandler::getSocketDescriptor()
+{
+    if(m_socket.size() == 0 || !m_socket.back())
+    {
+        return -1;
+    }
+    return m_socket.back()->getSocketDescriptor();
+}
+
+/**
+ * @brief Check if the Reactor has Data Waiting on this Socket
+ * @return
+ */
+bool SocketHandler::isReadReady() const
+{
+    return m_is_read_ready;
+}
+
+/**
+ * @brief Set from Reactor Events, cleared when the Socket is Drained.
+ * @param is_ready
+ */
+void SocketHandler::setReadReady(bool is_ready)
+{
+    m_is_read_ready = is_ready;
+}
+
+/**
+ * @brief Check if Socket is Registered with the Reactor
+ * @return
+ */
+bool SocketHandler::isRegistered() const
+{
+    return m_is_registered;
+}
+
+/**
+ * @brief Mark Socket Registered with the Reactor
+ * @param is_registered
+ */
+void SocketHandler::setRegistered(bool is_registered)
+{
+    m_is_registered = is_registered;
+}
+
+/**
+ * @brief Check if Socket Buffer is full, waiting on the Reactor.
+ * @return
+ */
+bool SocketHandler::isWriteBlocked() const
+{
+    return m_is_write_blocked;
+}
+
+/**
+ * @brief Set when a Flush would Block, cleared once Writable.
+ * @param is_blocked
+ */
+void SocketHandler::setWriteBlocked(bool is_blocked)
+{
+    m_is_write_blocked = is_blocked;
+}
+
+/**
+ * @brief Queue Data for the next Flush, the buffer is moved into the queue.
+ * @param data
+ * @return true if a Flush needs to be scheduled.
+ */
+bool SocketHandler::queueOutput(std::string data)
+{
+    if (data.empty())
+    {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(m_output_mutex);
+    if (m_is_output_throttled)
+    {
+        // Client is backed up, drop till the queue drains.
+        return false;
+    }
+
+    if (m_compressor && m_compressor->isActive())
+    {
+        // zlib may hold small writes till the batch is flushed.
+        std::string compressed;
+        m_compressor->compress(data, compressed);
+        appendOutput(std::move(compressed));
+    }
+    else
+    {
+        appendOutput(std::move(data));
+    }
+
+    if (m_is_flush_pending)
+    {
+        return false;
+    }
+
+    m_is_flush_pending = true;
+    return true;
+}
+
+/**
+ * @brief Flush Queued Data in a Gathered Write
+ * @return 1 when all is sent, 0 if data remains queued, -1 on errors.
+ */
+int SocketHandler::flushOutput()
+{
+    std::lock_guard<std::mutex> lock(m_output_mutex);
+    flushCompression();
+    while (!m_output_queue.empty())
+    {
+        int result = m_socket.back()->sendSocketVector(m_output_queue, m_output_offset);
+        if (result <= 0)
+        {
+            return result;
+        }
+
+        consumeOutput(result);
+    }
+
+    m_is_flush_pending = false;
+    return 1;
+}
+
+/**
+ * @brief Queue Data as is, m_output_mutex must be held.
+ * @param data
+ */
+void SocketHandler::appendOutput(std::string data)
+{
+    if (data.empty())
+    {
+        return;
+    }
+
+    m_output_size += data.size();
+    m_output_queue.push_back(std::move(data));
+    if (m_output_size >= m_output_high_water)
+    {
+        std::cout << "Output throttled, queued bytes: " << m_output_size << std::endl;
+        m_is_output_throttled = true;
+    }
+}
+
+/**
+ * @brief End the Compressed Batch before it's sent, m_output_mutex must be held.
+ */
+void SocketHandler::flushCompression()
+{
+    if (m_compressor)
+    {
+        std::string compressed;
+        if (m_compressor->flush(compressed))
+        {
+            appendOutput(std::move(compressed));
+        }
+    }
+}
+
+/**
+ * @brief Drop Sent Bytes from the Queue, m_output_mutex must be held.
+ * @param sent
+ */
+void SocketHandler::consumeOutput(std::string::size_type sent)
+{
+    // Remove what was sent, keep the position in a partially sent buffer.
+    m_output_size -= std::min(sent, m_output_size);
+    if (m_is_output_throttled && m_output_size <= m_output_low_water)
+    {
+        std::cout << "Output resumed, queued bytes: " << m_output_size << std::endl;
+        m_is_output_throttled = false;
+        m_output_drained.notify_all();
+    }
+    while (sent > 0 && !m_output_queue.empty())
+    {
+        std::string::size_type remaining = m_output_queue.front().size() - m_output_offset;
+        if (sent < remaining)
+        {
+            m_output_offset += sent;
+            break;
+        }
+
+        sent -= remaining;
+        m_output_offset = 0;
+        m_output_queue.pop_front();
+    }
+}
+
+#ifndef _WIN32
+/**
+ * @brief Point iovecs at the Queued Output for a Completion Engine Send.
+ *        Queued strings are not moved by new writes (deque push_back).
+ * @param iov
+ * @param max_count
+ * @return buffers filled, 0 when the queue is empty and the flush is done.
+ */
+int SocketHandler::gatherOutput(struct iovec *iov, int max_count)
+{
+    std::lock_guard<std::mutex> lock(m_output_mutex);
+    flushCompression();
+    std::string::size_type offset = m_output_offset;
+    int count = 0;
+    for (auto it = m_output_queue.begin(); it != m_output_queue.end() && count < max_count; ++it)
+    {
+        if (offset < it->size())
+        {
+            iov[count].iov_base = (void *)(it->data() + offset);
+            iov[count].iov_len  = it->size() - offset;
+            ++count;
+        }
+        offset = 0;
+    }
+
+    if (count == 0)
+    {
+        m_is_flush_pending = false;
+    }
+    return count;
+}
+
+/**
+ * @brief Completion Engine Send finished
+ * @param sent
+ */
+void SocketHandler::completeOutput(int sent)
+{
+    std::lock_guard<std::mutex> lock(m_output_mutex);
+    if (sent > 0)
+    {
+        consumeOutput(sent);
+    }
+}
+#endif
+
+/**
+ * @brief Completion Engine State for this Socket
+ * @return
+ */
+uint64_t SocketHandler::getCompletionToken() const
+{
+    return m_completion_token;
+}
+
+/**
+ * @brief Set by the Completion Engine when it starts tracking the Socket
+ * @param token
+ */
+void SocketHandler::setCompletionToken(uint64_t token)
+{
+    m_completion_token = token;
+}
+
+/**
+ * @brief zlib Level MCCP2 is offered with, 0 to not offer it.
+ * @param level
+ */
+void SocketHandler::setCompressionLevel(int level)
+{
+    m_compression_level = level;
+}
+
+/**
+ * @brief zlib Level MCCP2 is offered with
+ * @return
+ */
+int SocketHandler::getCompressionLevel() const
+{
+    return m_compression_level;
+}
+
+/**
+ * @brief Start MCCP2, the start sequence is queued uncompressed and the
+ *        compressor switched on together, even while throttled, so the
+ *        client never sees a deflate stream without its marker.
+ * @param compressor
+ * @param start_sequence
+ * @return true when a flush job is needed to send it.
+ */
+bool SocketHandler::startCompression(mccp_compressor_ptr compressor, std::string start_sequence)
+{
+    std::lock_guard<std::mutex> lock(m_output_mutex);
+    appendOutput(std::move(start_sequence));
+    m_compressor = compressor;
+
+    if (m_is_flush_pending)
+    {
+        return false;
+    }
+
+    m_is_flush_pending = true;
+    return true;
+}
+
+/**
+ * @brief End the Compressed Stream, the client asked to stop.
+ *        The end of stream is sent along with the next output.
+ */
+void SocketHandler::stopCompression()
+{
+    std::lock_guard<std::mutex> lock(m_output_mutex);
+    if (m_compressor && m_compressor->isActive())
+    {
+        std::string compressed;
+        m_compressor->finish(compressed);
+        appendOutput(std::move(compressed));
+    }
+}
+
+/**
+ * @brief Check if Output is being Compressed
+ * @return
+ */
+bool SocketHandler::isCompressing()
+{
+    std::lock_guard<std::mutex> lock(m_output_mutex);
+    return m_compressor && m_compressor->isActive();
+}
+
+/**
+ * @brief Bytes Queued for Compression
+ * @return
+ */
+uint64_t SocketHandler::getBytesBeforeCompression()
+{
+    std::lock_guard<std::mutex> lock(m_output_mutex);
+    return m_compressor ? m_compressor->getBytesIn() : 0;
+}
+
+/**
+ * @brief Compressed Bytes Queued for the Client
+ * @return
+ */
+uint64_t SocketHandler::getBytesAfterCompression()
+{
+    std::lock_guard<std::mutex> lock(m_output_mutex);
+    return m_compressor ? m_compressor->getBytesOut() : 0;
+}
+
+/**
+ * @brief Set the Backpressure Limits for Queued Output
+ * @param high_water
+ * @param low_water
+ */
+void SocketHandler::setOutputWatermarks(std::string::size_type high_water, std::string::size_type low_water)
+{
+    std::lock_guard<std::mutex> lock(m_output_mutex);
+    m_output_high_water = high_water;
+    m_output_low_water = std::min(low_water, high_water);
+}
+
+/**
+ * @brief Check if Output is being dropped for a backed up client
+ * @return
+ */
+bool SocketHandler::isOutputThrottled() const
+{
+    return m_is_output_throttled;
+}
+
+/**
+ * @brief Pause a Producer (Doors) till the Output Queue Drains
+ * @param milliseconds
+ * @return false if still throttled after the wait
+ */
+bool SocketHandler::waitForOutputDrain(int milliseconds)
+{
+    std::unique_lock<std::mutex> lock(m_output_mutex);
+    return m_output_drained.wait_for(lock, std::chrono::milliseconds(milliseconds), [this]
+    {
+        return !m_is_output_throttled || !m_is_active;
+    });
+}
+
+/**
+ * @brief Hold the Admission Control Slot for this Connection
+ * @param ticket
+ */
+void SocketHandler::setAdmissionTicket(admission_ticket_ptr ticket)
+{
+    m_admission_ticket = ticket;
 }
 
 /**
@@ -279,6 +702,15 @@ void SocketHandler::setInactive()
  */
 void SocketHandler::close()
 {
+    // Free the slot right away, the handler may linger with pending jobs.
+    m_admission_ticket.reset();
+
+    if (m_compressor)
+    {
+        std::cout << "MCCP2 bytes before: " << getBytesBeforeCompression()
+                  << " after: " << getBytesAfterCompression() << std::endl;
+    }
+
     try
     {
         // Deactivate Socket, then Clean it.
@@ -3,10 +3,22 @@
 
 #include "socket_state.hpp"
 #include "io_service.hpp"
+#include "admission_control.hpp"
+#include "mccp_compressor.hpp"
 
 #include <iostream>
 #include <vector>
 #include <memory>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <string>
+#include <cstdint>
+
+#ifndef _WIN32
+#include <sys/uio.h>
+#endif
 
 /**
  * @class SocketHandler
@@ -23,6 +35,20 @@ public:
         : m_socket()
         , m_socket_type("")
         , m_is_active(false)
+        , m_is_read_ready(false)
+        , m_is_registered(false)
+        , m_is_write_blocked(false)
+        , m_output_queue()
+        , m_output_offset(0)
+        , m_output_size(0)
+        , m_output_high_water(DEFAULT_OUTPUT_HIGH_WATER)
+        , m_output_low_water(DEFAULT_OUTPUT_LOW_WATER)
+        , m_is_flush_pending(false)
+        , m_is_output_throttled(false)
+        , m_compressor()
+        , m_compression_level(0)
+        , m_admission_ticket()
+        , m_completion_token(0)
     {
     }
 
@@ -36,6 +62,9 @@ public:
     std::string const SOCKET_TYPE_SSH = "SSH";
     std::string const SOCKET_TYPE_FTP = "FTP";
 
+    static const std::string::size_type DEFAULT_OUTPUT_HIGH_WATER = 262144;
+    static const std::string::size_type DEFAULT_OUTPUT_LOW_WATER  = 65536;
+
     // Socket Events, True if Data Available.
     int sendSocket(unsigned char *buf, Uint32 len);
     int recvSocket(char *message);
@@ -43,7 +72,7 @@ public:
     
     // Telnet
     bool connectTelnetSocket(std::string host, int port);
-    bool createTelnetAcceptor(std::string host, int port);
+    bool createTelnetAcceptor(std::string host, int port, bool is_native = false);
     socket_handler_ptr acceptTelnetConnection();
     
     // SSH
@@ -53,9 +82,50 @@ public:
     bool connectIrcSocket(std::string host, int port);
     
     std::string getSocketType() const;
+    std::string getRemoteAddress() const;
     bool isActive() const;
     void setInactive();
 
+    // Reactor Readiness, set from epoll events and cleared once drained.
+    int getSocketDescriptor();
+    bool isReadReady() const;
+    void setReadReady(bool is_ready);
+    bool isRegistered() const;
+    void setRegistered(bool is_registered);
+    bool isWriteBlocked() const;
+    void setWriteBlocked(bool is_blocked);
+
+    // Outbound Queue, writes are collected then flushed together.
+    bool queueOutput(std::string data);
+    int flushOutput();
+
+#ifndef _WIN32
+    // Completion Engine Sends, queued buffers stay in place till completed.
+    int gatherOutput(struct iovec *iov, int max_count);
+    void completeOutput(int sent);
+#endif
+
+    // Completion Engine State for this Socket, 0 when not tracked.
+    uint64_t getCompletionToken() const;
+    void setCompletionToken(uint64_t token);
+
+    // Backpressure, output is dropped at the high mark till drained to the low mark.
+    void setOutputWatermarks(std::string::size_type high_water, std::string::size_type low_water);
+    bool isOutputThrottled() const;
+    bool waitForOutputDrain(int milliseconds);
+
+    // MCCP2, output queued after the start is deflated, flushed per batch.
+    void setCompressionLevel(int level);
+    int getCompressionLevel() const;
+    bool startCompression(mccp_compressor_ptr compressor, std::string start_sequence);
+    void stopCompression();
+    bool isCompressing();
+    uint64_t getBytesBeforeCompression();
+    uint64_t getBytesAfterCompression();
+
+    // Admission Control Slot, released on close.
+    void setAdmissionTicket(admission_ticket_ptr ticket);
+
     void close();
     
     void setSocketType(std::string type);
@@ -66,6 +136,42 @@ private:
     std::vector<socket_state_ptr>   m_socket;
     std::string                     m_socket_type;
     bool                            m_is_active;
+    std::atomic<bool>               m_is_read_ready;
+    std::atomic<bool>               m_is_registered;
+    std::atomic<bool>               m_is_write_blocked;
+
+    std::mutex                      m_output_mutex;
+    std::deque<std::string>         m_output_queue;
+    std::string::size_type          m_output_offset;
+    std::string::size_type          m_output_size;
+    std::string::size_type          m_output_high_water;
+    std::string::size_type          m_output_low_water;
+    bool                            m_is_flush_pending;
+    std::atomic<bool>               m_is_output_throttled;
+    std::condition_variable         m_output_drained;
+
+    mccp_compressor_ptr             m_compressor;
+    int                             m_compression_level;
+
+    admission_ticket_ptr            m_admission_ticket;
+    uint64_t                        m_completion_token;
+
+    /**
+     * @brief Drop Sent Bytes from the Queue, m_output_mutex must be held.
+     * @param sent
+     */
+    void consumeOutput(std::string::size_type sent);
+
+    /**
+     * @brief Queue Data as is, m_output_mutex must be held.
+     * @param data
+     */
+    void appendOutput(std::string data);
+
+    /**
+     * @brief End the Compressed Batch before it's sent, m_output_mutex must be held.
+     */
+    void flushCompression();
 
 };
 
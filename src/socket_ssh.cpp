@@ -8,6 +8,7 @@
 #include <cstring>
 #include <cerrno>
 #include <iostream>
+#include <algorithm>
 
 /*
  * Start of SSH_Socket Derived Class (SSH)
@@ -31,6 +32,56 @@ int SSH_Socket::sendSocket(unsigned char *buffer, Uint32 len)
     return(result);
 }
 
+/**
+ * @brief Gathered Send of Queued Buffers, limited to the Channel Window.
+ *        A full window is the same as a blocked socket, the rest stays
+ *        queued and the flush is retried on a later pass.
+ * @param buffers
+ * @param offset
+ * @return bytes sent, 0 if the channel would block, -1 on errors.
+ */
+int SSH_Socket::sendSocketVector(const std::deque<std::string> &buffers, std::string::size_type offset)
+{
+    if (!m_is_socket_active)
+    {
+        return -1;
+    }
+
+    int total = 0;
+    for(auto &buffer : buffers)
+    {
+        if(offset >= buffer.size())
+        {
+            offset = 0;
+            continue;
+        }
+
+        uint32_t window = ssh_channel_window_size(m_ssh_channel);
+        if(window == 0)
+        {
+            return total;
+        }
+
+        uint32_t length = std::min<uint32_t>(window, buffer.size() - offset);
+        int result = ssh_channel_write(m_ssh_channel, buffer.data() + offset, length);
+        if(result < 0)
+        {
+            std::cout << "Error: ssh_channel_write" << std::endl;
+            m_is_socket_active = false;
+            return -1;
+        }
+
+        total += result;
+        if((uint32_t)result < buffer.size() - offset)
+        {
+            // Partial send, don't spin on a slow client.
+            return total;
+        }
+        offset = 0;
+    }
+    return total;
+}
+
 /* handle Telnet better */
 int SSH_Socket::recvSocket(char *message)
 {
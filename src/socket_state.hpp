@@ -12,6 +12,7 @@
 #include <iostream>
 #include <memory>
 #include <string>
+#include <deque>
 
 class SocketHandler;
 typedef std::shared_ptr<SocketHandler> socket_handler_ptr;
@@ -47,9 +48,70 @@ public:
     virtual bool onListen() = 0;
     virtual bool onExit() = 0;
 
+    /**
+     * @brief System descriptor for reactor readiness events,
+     *        -1 when the state can only be polled.
+     * @return
+     */
+    virtual int getSocketDescriptor()
+    {
+        return -1;
+    }
+
+    /**
+     * @brief Gathered Send of Queued Buffers, starting at offset in the first.
+     *        Default sends each buffer in turn and blocks till complete.
+     * @param buffers
+     * @param offset
+     * @return bytes sent, 0 if the socket would block, -1 on errors.
+     */
+    virtual int sendSocketVector(const std::deque<std::string> &buffers, std::string::size_type offset)
+    {
+        int total = 0;
+        for(auto &buffer : buffers)
+        {
+            if(offset >= buffer.size())
+            {
+                offset = 0;
+                continue;
+            }
+
+            std::string::size_type length = buffer.size() - offset;
+            int result = sendSocket((unsigned char *)buffer.data() + offset, length);
+            if(result <= 0)
+            {
+                return -1;
+            }
+            total += result;
+            if((std::string::size_type)result < length)
+            {
+                // Partial send, the rest goes on the next flush.
+                return total;
+            }
+            offset = 0;
+        }
+        return total;
+    }
+
     std::string m_host;
     int         m_port;
     bool        m_is_socket_active;
+
+protected:
+
+#ifndef _WIN32
+    /**
+     * @brief Gathered Send on a Descriptor without blocking.
+     * @param socket_descriptor
+     * @param buffers
+     * @param offset
+     * @return bytes sent, 0 if the socket would block, -1 on errors.
+     */
+    static int sendDescriptorVector(int socket_descriptor, const std::deque<std::string> &buffers,
+                                    std::string::size_type offset);
+#endif
+
+    static const int MAX_IOVEC_BUFFERS = 64;
 };
 
 typedef std::shared_ptr<SocketState> socket_state_ptr;
@@ -85,6 +147,10 @@ public:
     virtual bool onConnect();
     virtual bool onListen();
     virtual bool onExit();
+    virtual int getSocketDescriptor();
+#ifndef _WIN32
+    virtual int sendSocketVector(const std::deque<std::string> &buffers, std::string::size_type offset);
+#endif
 
 private:
 
@@ -94,6 +160,61 @@ private:
 };
 
 
+#ifndef _WIN32
+/**
+ * @class POSIX_Socket
+ * @author Michael Griffin
+ * @date 17/10/2026
+ * @file socket_state.hpp
+ * @brief Native Non-Blocking TCP Telnet Socket
+ *        Listens on IPv6 and IPv4 with SO_REUSEPORT, no SDL Socket Sets.
+ */
+class POSIX_Socket : public SocketState
+{
+public:
+
+    static const int MAX_RECV_BUFFER   = 8192;
+    static const int SEND_WAIT_TIMEOUT = 5000;
+
+    POSIX_Socket(const std::string &host, const int &port)
+        : SocketState(host, port)
+        , m_socket_descriptor(-1)
+    { }
+
+    virtual ~POSIX_Socket()
+    {
+        std::cout << "Shutting Down POSIX_SocketState" << std::endl;
+        onExit();
+    }
+
+    virtual int sendSocket(unsigned char *message, Uint32 len);
+    virtual int recvSocket(char *message);
+    virtual socket_handler_ptr pollSocketAccepts();
+    virtual void spawnSocket(TCPsocket socket);
+    virtual int pollSocket();
+    virtual bool onConnect();
+    virtual bool onListen();
+    virtual bool onExit();
+    virtual int getSocketDescriptor();
+    virtual int sendSocketVector(const std::deque<std::string> &buffers, std::string::size_type offset);
+
+    /**
+     * @brief (Server) Attach a Descriptor from accept.
+     * @param socket_descriptor
+     */
+    void spawnDescriptor(int socket_descriptor);
+
+private:
+
+    int  createListener(int family);
+    bool setNonBlocking(int socket_descriptor);
+
+    int m_socket_descriptor;
+
+};
+#endif
+
+
 /**
  * @class IRC_Socket
  * @author Blue
@@ -210,6 +331,7 @@ public:
     virtual bool onConnect();
     virtual bool onListen();
     virtual bool onExit();
+    virtual int sendSocketVector(const std::deque<std::string> &buffers, std::string::size_type offset);
 
     // Specific Functions for SSH
     int verify_knownhost();
@@ -9,6 +9,22 @@
 #include <cerrno>
 #include <time.h>
 
+#ifndef _WIN32
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <netdb.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#endif
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+
 
 /**
  * @brief Send Data Over the Socket
@@ -36,6 +52,81 @@ int SDL_Socket::sendSocket(unsigned char *buffer, Uint32 length)
 }
 
 
+#ifndef _WIN32
+/**
+ * @brief Gathered Send of Queued Buffers without blocking.
+ * @param buffers
+ * @param offset
+ * @return bytes sent, 0 if the socket would block, -1 on errors.
+ */
+int SDL_Socket::sendSocketVector(const std::deque<std::string> &buffers, std::string::size_type offset)
+{
+    if (!m_is_socket_active)
+    {
+        return -1;
+    }
+    return sendDescriptorVector(getSocketDescriptor(), buffers, offset);
+}
+
+/**
+ * @brief Gathered Send on a Descriptor without blocking.
+ * @param socket_descriptor
+ * @param buffers
+ * @param offset
+ * @return bytes sent, 0 if the socket would block, -1 on errors.
+ */
+int SocketState::sendDescriptorVector(int socket_descriptor, const std::deque<std::string> &buffers,
+                                      std::string::size_type offset)
+{
+    if (socket_descriptor == -1)
+    {
+        return -1;
+    }
+
+    struct iovec iov[MAX_IOVEC_BUFFERS];
+    int count = 0;
+    for(auto it = buffers.begin(); it != buffers.end() && count < MAX_IOVEC_BUFFERS; ++it)
+    {
+        if(offset < it->size())
+        {
+            iov[count].iov_base = (void *)(it->data() + offset);
+            iov[count].iov_len  = it->size() - offset;
+            ++count;
+        }
+        offset = 0;
+    }
+
+    if(count == 0)
+    {
+        return 0;
+    }
+
+    struct msghdr msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = iov;
+    msg.msg_iovlen = count;
+
+    ssize_t result;
+    do
+    {
+        result = sendmsg(socket_descriptor, &msg, MSG_DONTWAIT | MSG_NOSIGNAL);
+    }
+    while(result == -1 && errno == EINTR);
+
+    if(result == -1)
+    {
+        if(errno == EAGAIN || errno == EWOULDBLOCK)
+        {
+            return 0;
+        }
+        std::cout << "sendSocketVector: " << strerror(errno) << std::endl;
+        return -1;
+    }
+
+    return (int)result;
+}
+#endif
+
 /**
  * @brief Receive Data from Socket
  * @param message
@@ -110,9 +201,23 @@ socket_handler_ptr SDL_Socket::pollSocketAccepts()
         {
             std::cout << "SDLNet_SocketReady : Accept Socket Ready" << std::endl;
             socket = SDLNet_TCP_Accept(m_tcp_socket);
+            if(!socket)
+            {
+                return nullptr;
+            }
+
+            // Remote Address for Admission Control, host is in network byte order.
+            std::string host = "0.0.0.0";
+            IPaddress *address = SDLNet_TCP_GetPeerAddress(socket);
+            if(address)
+            {
+                unsigned char *octets = (unsigned char *)&address->host;
+                host = std::to_string(octets[0]) + "." + std::to_string(octets[1]) + "."
+                       + std::to_string(octets[2]) + "." + std::to_string(octets[3]);
+            }
 
             // Setup the State, SDL_Socket
-            socket_state_ptr state(new SDL_Socket("127.0.0.1", 6023));
+            socket_state_ptr state(new SDL_Socket(host, m_port));
             state->spawnSocket(socket);
 
             // Setup a Handle, which will link back to Async_Connection
@@ -255,6 +360,19 @@ bool SDL_Socket::onListen()
 }
 
 
+/**
+ * @brief Socket Descriptor for Reactor Registration.
+ * @return
+ */
+int SDL_Socket::getSocketDescriptor()
+{
+    if (!m_tcp_socket)
+    {
+        return -1;
+    }
+    return SDLNet_TCP_GetSocketDescriptor(m_tcp_socket);
+}
+
 /**
  * @brief Shutdown Socket.
  * @return
@@ -281,3 +399,410 @@ bool SDL_Socket::onExit()
     m_socket_set = nullptr;
     return true;
 }
+
+
+#ifndef _WIN32
+/**
+ * @brief Send Data Over the Socket, waits on a full buffer till all is sent.
+ * @param buffer
+ * @param length
+ * @return
+ */
+int POSIX_Socket::sendSocket(unsigned char *buffer, Uint32 length)
+{
+    if (!m_is_socket_active || m_socket_descriptor == -1)
+    {
+        return 0;
+    }
+
+    Uint32 total = 0;
+    while (total < length)
+    {
+        ssize_t result = send(m_socket_descriptor, buffer + total, length - total, MSG_NOSIGNAL);
+        if (result > 0)
+        {
+            total += result;
+            continue;
+        }
+
+        if (result == -1 && errno == EINTR)
+        {
+            continue;
+        }
+
+        if (result == -1 && (errno == EAGAIN || errno == EWOULDBLOCK))
+        {
+            struct pollfd poll_fd;
+            poll_fd.fd = m_socket_descriptor;
+            poll_fd.events = POLLOUT;
+            poll_fd.revents = 0;
+            if (poll(&poll_fd, 1, SEND_WAIT_TIMEOUT) > 0)
+            {
+                continue;
+            }
+        }
+
+        std::cout << "POSIX_Socket send: " << strerror(errno) << std::endl;
+        return 0;
+    }
+
+    return (int)total;
+}
+
+/**
+ * @brief Gathered Send of Queued Buffers without blocking.
+ * @param buffers
+ * @param offset
+ * @return bytes sent, 0 if the socket would block, -1 on errors.
+ */
+int POSIX_Socket::sendSocketVector(const std::deque<std::string> &buffers, std::string::size_type offset)
+{
+    if (!m_is_socket_active)
+    {
+        return -1;
+    }
+    return sendDescriptorVector(m_socket_descriptor, buffers, offset);
+}
+
+/**
+ * @brief Receive Data from Socket
+ * @param message
+ * @return
+ */
+int POSIX_Socket::recvSocket(char *message)
+{
+    if (!m_is_socket_active || m_socket_descriptor == -1)
+    {
+        return -1;
+    }
+
+    ssize_t result;
+    do
+    {
+        result = recv(m_socket_descriptor, message, MAX_RECV_BUFFER, 0);
+    }
+    while (result == -1 && errno == EINTR);
+
+    if (result == -1 && (errno == EAGAIN || errno == EWOULDBLOCK))
+    {
+        // Nothing left, wait for the next readiness event.
+        message[0] = 0;
+        return 0;
+    }
+
+    if (result <= 0)
+    {
+        // -1 is Error 0 is Server Closed Connection
+        return -1;
+    }
+
+    message[result] = 0;
+    return (int)result;
+}
+
+/**
+ * @brief Polls For Data To Read from the socket.
+ * @return
+ */
+int POSIX_Socket::pollSocket()
+{
+    if (!m_is_socket_active || m_socket_descriptor == -1)
+    {
+        return -1;
+    }
+
+    struct pollfd poll_fd;
+    poll_fd.fd = m_socket_descriptor;
+    poll_fd.events = POLLIN;
+    poll_fd.revents = 0;
+
+    int num_ready = poll(&poll_fd, 1, 0);
+    if (num_ready == -1)
+    {
+        if (errno == EINTR)
+        {
+            return 0;
+        }
+        m_is_socket_active = false;
+        return -1;
+    }
+
+    // Hangups and Errors are picked up by the following recv.
+    return (num_ready > 0 && (poll_fd.revents & (POLLIN | POLLHUP | POLLERR))) ? 1 : 0;
+}
+
+/**
+ * @brief Accept a waiting connection, call till nullptr to drain the backlog.
+ * @return
+ */
+socket_handler_ptr POSIX_Socket::pollSocketAccepts()
+{
+    if (!m_is_socket_active || m_socket_descriptor == -1)
+    {
+        return nullptr;
+    }
+
+    struct sockaddr_storage address;
+    socklen_t address_length = sizeof(address);
+
+    int socket_descriptor;
+    do
+    {
+#ifdef __linux__
+        socket_descriptor = accept4(m_socket_descriptor, (struct sockaddr *)&address, &address_length,
+                                    SOCK_NONBLOCK | SOCK_CLOEXEC);
+#else
+        socket_descriptor = accept(m_socket_descriptor, (struct sockaddr *)&address, &address_length);
+#endif
+    }
+    while (socket_descriptor == -1 && errno == EINTR);
+
+    if (socket_descriptor == -1)
+    {
+        if (errno != EAGAIN && errno != EWOULDBLOCK)
+        {
+            std::cout << "POSIX_Socket accept: " << strerror(errno) << std::endl;
+        }
+        return nullptr;
+    }
+
+    char host[INET6_ADDRSTRLEN] = {0};
+    struct in6_addr *address6 = &((struct sockaddr_in6 *)&address)->sin6_addr;
+    if (address.ss_family == AF_INET6 && IN6_IS_ADDR_V4MAPPED(address6))
+    {
+        // IPv4 on the Dual Stack listener, keep addresses the same as SDL_Socket.
+        inet_ntop(AF_INET, &address6->s6_addr[12], host, sizeof(host));
+    }
+    else if (address.ss_family == AF_INET6)
+    {
+        inet_ntop(AF_INET6, address6, host, sizeof(host));
+    }
+    else
+    {
+        inet_ntop(AF_INET, &((struct sockaddr_in *)&address)->sin_addr, host, sizeof(host));
+    }
+
+    std::cout << "POSIX_Socket : Accepted Connection from " << host << std::endl;
+
+    // Setup the State, POSIX_Socket
+    std::shared_ptr<POSIX_Socket> state(new POSIX_Socket(host, m_port));
+    state->spawnDescriptor(socket_descriptor);
+    if (!state->m_is_socket_active)
+    {
+        return nullptr;
+    }
+
+    // Setup a Handle, which will link back to Async_Connection
+    // For individual sessions and polling read/write from clients.
+    socket_handler_ptr handler(new SocketHandler());
+    handler->setSocketType("TELNET");
+    handler->setSocketState(state);
+    return handler;
+}
+
+/**
+ * @brief SDL Sockets are not used by the Native Socket.
+ * @param socket
+ */
+void POSIX_Socket::spawnSocket(TCPsocket)
+{
+    std::cout << "POSIX_Socket::spawnSocket not supported, use spawnDescriptor" << std::endl;
+}
+
+/**
+ * @brief (Server) On Socket Accepts, new Session Socket Setup.
+ * @param socket_descriptor
+ */
+void POSIX_Socket::spawnDescriptor(int socket_descriptor)
+{
+    m_socket_descriptor = socket_descriptor;
+    if (!setNonBlocking(m_socket_descriptor))
+    {
+        onExit();
+        return;
+    }
+
+    // Successful Startup
+    m_is_socket_active = true;
+}
+
+/**
+ * @brief (Client) Connects out to Servers
+ * @return
+ */
+bool POSIX_Socket::onConnect()
+{
+    struct addrinfo hints;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+
+    struct addrinfo *results = nullptr;
+    std::string port = std::to_string(m_port);
+
+    std::cout << "Connecting to " << m_host << " on port " << m_port << std::endl;
+    int error = getaddrinfo(m_host.c_str(), port.c_str(), &hints, &results);
+    if (error != 0)
+    {
+        std::cout << "POSIX_Socket getaddrinfo: " << gai_strerror(error) << std::endl;
+        return false;
+    }
+
+    for (struct addrinfo *result = results; result != nullptr; result = result->ai_next)
+    {
+        m_socket_descriptor = socket(result->ai_family, result->ai_socktype, result->ai_protocol);
+        if (m_socket_descriptor == -1)
+        {
+            continue;
+        }
+
+        // Connect blocking like SDL, then switch over for the Reactor.
+        if (connect(m_socket_descriptor, result->ai_addr, result->ai_addrlen) == 0
+                && setNonBlocking(m_socket_descriptor))
+        {
+            break;
+        }
+
+        close(m_socket_descriptor);
+        m_socket_descriptor = -1;
+    }
+    freeaddrinfo(results);
+
+    if (m_socket_descriptor == -1)
+    {
+        std::cout << "POSIX_Socket connect: unable to connect to " << m_host << std::endl;
+        return false;
+    }
+
+    // Successful Startup
+    m_is_socket_active = true;
+    std::cout << "Connection Successful" << std::endl;
+    return true;
+}
+
+/**
+ * @brief (Server) Sets up the Listening Socket, IPv6 (Dual Stack) then IPv4.
+ * @return
+ */
+bool POSIX_Socket::onListen()
+{
+    std::cout << "Listening for Telnet (Native) on port " << m_port << std::endl;
+
+    m_socket_descriptor = createListener(AF_INET6);
+    if (m_socket_descriptor == -1)
+    {
+        m_socket_descriptor = createListener(AF_INET);
+    }
+
+    if (m_socket_descriptor == -1)
+    {
+        std::cout << "POSIX_Socket listen: unable to bind port " << m_port << std::endl;
+        return false;
+    }
+
+    // Successful Startup
+    m_is_socket_active = true;
+    std::cout << "Handshake Setup Successful" << std::endl;
+    return true;
+}
+
+/**
+ * @brief Create a Non-Blocking Listener on all addresses of the family.
+ * @param family
+ * @return descriptor, -1 on errors.
+ */
+int POSIX_Socket::createListener(int family)
+{
+    int socket_descriptor = socket(family, SOCK_STREAM, 0);
+    if (socket_descriptor == -1)
+    {
+        std::cout << "POSIX_Socket socket: " << strerror(errno) << std::endl;
+        return -1;
+    }
+
+    int enable = 1;
+    setsockopt(socket_descriptor, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable));
+#ifdef SO_REUSEPORT
+    // Allows multiple listeners on the port, the kernel spreads connections between them.
+    setsockopt(socket_descriptor, SOL_SOCKET, SO_REUSEPORT, &enable, sizeof(enable));
+#endif
+
+    int result;
+    if (family == AF_INET6)
+    {
+        // Accept IPv4 Mapped Addresses as well.
+        int disable = 0;
+        setsockopt(socket_descriptor, IPPROTO_IPV6, IPV6_V6ONLY, &disable, sizeof(disable));
+
+        struct sockaddr_in6 address;
+        memset(&address, 0, sizeof(address));
+        address.sin6_family = AF_INET6;
+        address.sin6_addr = in6addr_any;
+        address.sin6_port = htons(m_port);
+        result = bind(socket_descriptor, (struct sockaddr *)&address, sizeof(address));
+    }
+    else
+    {
+        struct sockaddr_in address;
+        memset(&address, 0, sizeof(address));
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_ANY);
+        address.sin_port = htons(m_port);
+        result = bind(socket_descriptor, (struct sockaddr *)&address, sizeof(address));
+    }
+
+    if (result == -1 || listen(socket_descriptor, SOMAXCONN) == -1
+            || !setNonBlocking(socket_descriptor))
+    {
+        std::cout << "POSIX_Socket bind/listen: " << strerror(errno) << std::endl;
+        close(socket_descriptor);
+        return -1;
+    }
+
+    return socket_descriptor;
+}
+
+/**
+ * @brief Set Descriptor Non-Blocking and Close on Exec.
+ * @param socket_descriptor
+ * @return
+ */
+bool POSIX_Socket::setNonBlocking(int socket_descriptor)
+{
+    int flags = fcntl(socket_descriptor, F_GETFL, 0);
+    if (flags == -1 || fcntl(socket_descriptor, F_SETFL, flags | O_NONBLOCK) == -1)
+    {
+        std::cout << "POSIX_Socket fcntl: " << strerror(errno) << std::endl;
+        return false;
+    }
+
+    fcntl(socket_descriptor, F_SETFD, FD_CLOEXEC);
+    return true;
+}
+
+/**
+ * @brief Socket Descriptor for Reactor Registration.
+ * @return
+ */
+int POSIX_Socket::getSocketDescriptor()
+{
+    return m_socket_descriptor;
+}
+
+/**
+ * @brief Shutdown Socket.
+ * @return
+ */
+bool POSIX_Socket::onExit()
+{
+    if (m_socket_descriptor != -1)
+    {
+        std::cout << "POSIX_Socket::onExit()" << std::endl;
+        close(m_socket_descriptor);
+        m_socket_descriptor = -1;
+    }
+
+    m_is_socket_active = false;
+    return true;
+}
+#endif
@@ -0,0 +1,396 @@
+#ifndef STATS_WRITER_HPP
+#define STATS_WRITER_HPP
+
+#include "job_queue.hpp"
+
+#include "model-sys/session_stats.hpp"
+#include "model-sys/menu_stats.hpp"
+#include "data-sys/session_stats_dao.hpp"
+#include "data-sys/menu_stats_dao.hpp"
+
+#include "libSqliteWrapped.h"
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <map>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <memory>
+
+class StatsWriter;
+typedef std::shared_ptr<StatsWriter> stats_writer_ptr;
+
+/**
+ * @class StatsWriter
+ * @author Michael Griffin
+ * @date 17/10/2026
+ * @file stats_writer.hpp
+ * @brief Write Behind for Session and Menu Stats.
+ *        Sessions queue a copy of their stats without touching the database, a background
+ *        thread writes them in batched transactions every flush interval or batch size events.
+ *        The queue is bounded, when full new events are dropped and counted.
+ */
+class StatsWriter
+{
+public:
+
+    static const int STATS_SESSION_START  = 0;
+    static const int STATS_SESSION_UPDATE = 1;
+    static const int STATS_SESSION_END    = 2;
+    static const int STATS_MENU           = 3;
+
+    /**
+     * @brief Writer Metrics, lag is from queued till written.
+     */
+    struct WriterStats
+    {
+        unsigned long queued;
+        unsigned long written;
+        unsigned long dropped;
+        unsigned long failed;
+        unsigned long batches;
+        long          pending;
+        long          last_lag_ms;
+        long          max_lag_ms;
+    };
+
+    StatsWriter(const std::string &database_file, int flush_interval_ms, int batch_size, int max_queue)
+        : m_database(database_file)
+        , m_session_stats_dao(m_database)
+        , m_menu_stats_dao(m_database)
+        , m_flush_interval(flush_interval_ms)
+        , m_batch_size(batch_size)
+        , m_max_queue(max_queue)
+        , m_is_running(false)
+        , m_is_accepting(true)
+        , m_next_session_key(0)
+        , m_pending(0)
+        , m_queued(0)
+        , m_written(0)
+        , m_dropped(0)
+        , m_failed(0)
+        , m_batches(0)
+        , m_last_lag_ms(0)
+        , m_max_lag_ms(0)
+    {
+        // Only the writer thread uses this, a single connection keeps each batch on one transaction.
+        // Shares the users file with the pool, so it waits on their writes the same way.
+        m_database.setMaxConnections(1);
+        m_database.setConnectionPragmas(SQLW::Database::POOL_PRAGMAS);
+    }
+
+    ~StatsWriter()
+    {
+        std::cout << "~StatsWriter" << std::endl;
+        shutdown();
+    }
+
+    /**
+     * @brief Start the Background Writer Thread.
+     */
+    void start()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_is_running || !m_is_accepting)
+        {
+            return;
+        }
+        m_is_running = true;
+        m_thread = std::thread(&StatsWriter::run, this);
+    }
+
+    /**
+     * @brief Stop accepting events, flush whatever is queued then join the thread.
+     */
+    void shutdown()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_is_accepting = false;
+            m_is_running = false;
+        }
+        m_condition.notify_one();
+
+        if (m_thread.joinable())
+        {
+            m_thread.join();
+        }
+
+        // Anything queued without a running thread.
+        flush();
+    }
+
+    /**
+     * @brief Unique key for a Session, links its later updates to the inserted record.
+     * @return
+     */
+    unsigned long createSessionKey()
+    {
+        return ++m_next_session_key;
+    }
+
+    /**
+     * @brief Queue a copy of the Session Stats
+     * @param type STATS_SESSION_ value
+     * @param session_key
+     * @param stats
+     * @return false when dropped.
+     */
+    bool pushSessionStats(int type, unsigned long session_key, session_stats_ptr stats)
+    {
+        StatsEvent event;
+        event.m_type = type;
+        event.m_session_key = session_key;
+        event.m_session_stats.reset(new SessionStats(*stats));
+        return push(std::move(event));
+    }
+
+    /**
+     * @brief Queue a copy of the Menu Stats
+     * @param stats
+     * @return false when dropped.
+     */
+    bool pushMenuStats(menu_stats_ptr stats)
+    {
+        StatsEvent event;
+        event.m_type = STATS_MENU;
+        event.m_menu_stats.reset(new MenuStats(*stats));
+        return push(std::move(event));
+    }
+
+    /**
+     * @brief Writer Metrics
+     * @return
+     */
+    WriterStats getStats() const
+    {
+        WriterStats stats;
+        stats.queued = m_queued;
+        stats.written = m_written;
+        stats.dropped = m_dropped;
+        stats.failed = m_failed;
+        stats.batches = m_batches;
+        stats.pending = m_pending;
+        stats.last_lag_ms = m_last_lag_ms;
+        stats.max_lag_ms = m_max_lag_ms;
+        return stats;
+    }
+
+private:
+
+    /**
+     * @brief Queued Stats, a copy so the session can keep changing its own.
+     */
+    struct StatsEvent
+    {
+        StatsEvent()
+            : m_type(STATS_MENU)
+            , m_session_key(0)
+        { }
+
+        int                                   m_type;
+        unsigned long                         m_session_key;
+        session_stats_ptr                     m_session_stats;
+        menu_stats_ptr                        m_menu_stats;
+        std::chrono::steady_clock::time_point m_queued;
+    };
+
+    /**
+     * @brief Add an Event to the Queue, Safe from any thread.
+     * @param event
+     * @return false when dropped.
+     */
+    bool push(StatsEvent &&event)
+    {
+        if (!m_is_accepting)
+        {
+            ++m_dropped;
+            return false;
+        }
+
+        long pending = m_pending.fetch_add(1);
+        if (pending >= m_max_queue)
+        {
+            // Never block a session on the database, drop and count it.
+            m_pending.fetch_sub(1);
+            ++m_dropped;
+            return false;
+        }
+
+        event.m_queued = std::chrono::steady_clock::now();
+        m_queue.push(std::move(event));
+        ++m_queued;
+
+        if (pending + 1 == m_batch_size)
+        {
+            m_condition.notify_one();
+        }
+        return true;
+    }
+
+    /**
+     * @brief Writer Thread, wakes each interval or when a batch is ready.
+     */
+    void run()
+    {
+        while (true)
+        {
+            bool is_running = true;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_condition.wait_for(lock, std::chrono::milliseconds(m_flush_interval), [this]
+                {
+                    return !m_is_running || m_pending >= m_batch_size;
+                });
+                is_running = m_is_running;
+            }
+
+            flush();
+            if (!is_running)
+            {
+                break;
+            }
+        }
+    }
+
+    /**
+     * @brief Drain the Queue in batches, Writer thread only.
+     */
+    void flush()
+    {
+        std::lock_guard<std::mutex> lock(m_flush_mutex);
+        std::vector<StatsEvent> batch;
+        StatsEvent event;
+        while (true)
+        {
+            while (static_cast<int>(batch.size()) < m_batch_size && m_queue.pop(event))
+            {
+                m_pending.fetch_sub(1);
+                batch.push_back(std::move(event));
+            }
+
+            if (batch.empty())
+            {
+                break;
+            }
+
+            writeBatch(batch);
+            batch.clear();
+        }
+    }
+
+    /**
+     * @brief Write a Batch of Events in a single Transaction.
+     * @param batch
+     */
+    void writeBatch(std::vector<StatsEvent> &batch)
+    {
+        // The pool has one connection, the Query is released before the DAOs borrow it.
+        {
+            SQLW::Query qry(m_database);
+            if (!qry.isConnected() || !qry.execute("BEGIN TRANSACTION;"))
+            {
+                std::cout << "StatsWriter, unable to begin transaction." << std::endl;
+                m_failed += batch.size();
+                return;
+            }
+        }
+
+        for (StatsEvent &event : batch)
+        {
+            if (!writeEvent(event))
+            {
+                ++m_failed;
+                continue;
+            }
+
+            long lag = std::chrono::duration_cast<std::chrono::milliseconds>(
+                           std::chrono::steady_clock::now() - event.m_queued).count();
+            m_last_lag_ms = lag;
+            if (lag > m_max_lag_ms)
+            {
+                m_max_lag_ms = lag;
+            }
+            ++m_written;
+        }
+
+        SQLW::Query qry(m_database);
+        if (!qry.execute("COMMIT;"))
+        {
+            std::cout << "StatsWriter, unable to commit batch." << std::endl;
+            qry.execute("ROLLBACK;");
+        }
+        ++m_batches;
+    }
+
+    /**
+     * @brief Write a Single Event, Session updates find their record by Session Key.
+     * @param event
+     * @return
+     */
+    bool writeEvent(StatsEvent &event)
+    {
+        if (event.m_type == STATS_MENU)
+        {
+            return m_menu_stats_dao.insertRecord(event.m_menu_stats) >= 0;
+        }
+
+        bool result = false;
+        std::map<unsigned long, long>::iterator it = m_session_ids.find(event.m_session_key);
+        if (it != m_session_ids.end())
+        {
+            event.m_session_stats->iId = it->second;
+            result = m_session_stats_dao.updateRecord(event.m_session_stats);
+        }
+        else
+        {
+            // Start, or an Update whose Start was dropped.
+            long id = m_session_stats_dao.insertRecord(event.m_session_stats);
+            if (id >= 0)
+            {
+                m_session_ids[event.m_session_key] = id;
+                result = true;
+            }
+        }
+
+        if (event.m_type == STATS_SESSION_END)
+        {
+            m_session_ids.erase(event.m_session_key);
+        }
+        return result;
+    }
+
+    SQLW::Database   m_database;
+    SessionStatsDao  m_session_stats_dao;
+    MenuStatsDao     m_menu_stats_dao;
+
+    int              m_flush_interval;
+    int              m_batch_size;
+    long             m_max_queue;
+
+    std::mutex              m_mutex;
+    std::mutex              m_flush_mutex;
+    std::condition_variable m_condition;
+    std::thread             m_thread;
+    bool                    m_is_running;
+    std::atomic<bool>       m_is_accepting;
+
+    JobQueue<StatsEvent>          m_queue;
+    std::map<unsigned long, long> m_session_ids;
+
+    std::atomic<unsigned long> m_next_session_key;
+    std::atomic<long>          m_pending;
+    std::atomic<unsigned long> m_queued;
+    std::atomic<unsigned long> m_written;
+    std::atomic<unsigned long> m_dropped;
+    std::atomic<unsigned long> m_failed;
+    std::atomic<unsigned long> m_batches;
+    std::atomic<long>          m_last_lag_ms;
+    std::atomic<long>          m_max_lag_ms;
+};
+
+#endif // STATS_WRITER_HPP
@@ -5,6 +5,49 @@
 #include <string>
 #include <fstream>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+
+/**
+ * @brief Find the next byte the plain text run stops at, IAC, NUL or CR.
+ *        SSE2 compares 16 bytes at a time, the tail is checked per byte.
+ * @param data
+ * @param length
+ * @return Offset of the byte, or length when the run is all text.
+ */
+static size_t findTelnetSpecial(const unsigned char *data, size_t length)
+{
+    size_t i = 0;
+
+#if defined(__SSE2__)
+    const __m128i iac = _mm_set1_epi8(static_cast<char>(IAC));
+    const __m128i nul = _mm_setzero_si128();
+    const __m128i cr  = _mm_set1_epi8('\r');
+
+    for(; i + 16 <= length; i += 16)
+    {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i));
+        __m128i found = _mm_or_si128(_mm_cmpeq_epi8(block, iac), _mm_cmpeq_epi8(block, nul));
+        int mask = _mm_movemask_epi8(_mm_or_si128(found, _mm_cmpeq_epi8(block, cr)));
+        if(mask != 0)
+        {
+            return i + __builtin_ctz(mask);
+        }
+    }
+#endif
+
+    for(; i < length; i++)
+    {
+        if(data[i] == IAC || data[i] == '\0' || data[i] == '\r')
+        {
+            return i;
+        }
+    }
+    return length;
+}
+
 
 /**
  * @brief Telnet Option Acknowledgment Reply
@@ -55,13 +98,6 @@ void TelnetDecoder::decodeBuffer()
 {
     std::cout << "decodeByffer 240 - SE received" << std::endl;
 
-    // Check if this was a sequence we were waiting for.
-    if(checkReply(m_subnegoOption))
-    {
-        // Remove it
-        //del_reply(m_subnegoOption);
-    }
-
     // Now process the buffer per the options
     switch(m_subnegoOption)
     {
@@ -92,10 +128,201 @@ void TelnetDecoder::decodeBuffer()
             std::cout << "Invalid option: " << (int) m_subnegoOption << m_subnegoOption << std::endl;
             break;
     }
+
+    // Check if this was a sequence we were waiting for, TTYPE and NAWS
+    // are answered here, the WILL only says the data will follow.
+    if(checkReply(m_subnegoOption))
+    {
+        deleteReply(m_subnegoOption);
+    }
+
     m_teloptStage = 0;
     m_subnegoOption = 0;
 }
 
+/**
+ * @brief Find the next IAC in Outgoing Data.
+ * @param data
+ * @param length
+ * @return Offset of the IAC, or length when there is none.
+ */
+static size_t findIAC(const unsigned char *data, size_t length)
+{
+    size_t i = 0;
+
+#if defined(__SSE2__)
+    const __m128i iac = _mm_set1_epi8(static_cast<char>(IAC));
+
+    for(; i + 16 <= length; i += 16)
+    {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i));
+        int mask = _mm_movemask_epi8(_mm_cmpeq_epi8(block, iac));
+        if(mask != 0)
+        {
+            return i + __builtin_ctz(mask);
+        }
+    }
+#endif
+
+    for(; i < length; i++)
+    {
+        if(data[i] == IAC)
+        {
+            return i;
+        }
+    }
+    return length;
+}
+
+/**
+ * @brief Double each IAC in Outgoing Data.
+ * @param data
+ * @param output
+ * @return
+ */
+bool TelnetDecoder::escapeIAC(const std::string &data, std::string &output)
+{
+    const unsigned char *bytes = reinterpret_cast<const unsigned char *>(data.data());
+    size_t length = data.size();
+
+    size_t position = findIAC(bytes, length);
+    if(position == length)
+    {
+        return false;
+    }
+
+    // Count them first so the escaped copy is sized once.
+    size_t count = 0;
+    for(size_t next = position; next < length; )
+    {
+        ++count;
+        ++next;
+        next += findIAC(bytes + next, length - next);
+    }
+
+    output.clear();
+    output.reserve(length + count);
+
+    size_t start = 0;
+    while(position < length)
+    {
+        output.append(data, start, position - start + 1);
+        output += static_cast<char>(IAC);
+        start = position + 1;
+        position = start + findIAC(bytes + start, length - start);
+    }
+    output.append(data, start, length - start);
+    return true;
+}
+
+/**
+ * @brief Decode a block of Incoming Data, Telnet Options are parsed out.
+ *        NVT line endings, CR LF and CR NUL are passed on as a single CR.
+ * @param data
+ * @param length
+ * @param output
+ */
+void TelnetDecoder::decode(const unsigned char *data, size_t length, std::string &output)
+{
+    size_t i = 0;
+    while(i < length)
+    {
+        if(m_teloptStage == 0)
+        {
+            // The CR may have ended the last read, it's LF or NUL starts this one.
+            if(m_is_cr_pending)
+            {
+                m_is_cr_pending = false;
+                if(data[i] == '\n' || data[i] == '\0')
+                {
+                    ++i;
+                    continue;
+                }
+            }
+
+            size_t run = findTelnetSpecial(data + i, length - i);
+            output.append(reinterpret_cast<const char *>(data + i), run);
+            i += run;
+
+            if(i == length)
+            {
+                break;
+            }
+
+            // Nulls are dropped, same as the per byte parser.
+            if(data[i] == '\0')
+            {
+                ++i;
+                continue;
+            }
+
+            // ENTER, the input side handles CR, drop the LF or NUL following.
+            if(data[i] == '\r')
+            {
+                output += '\r';
+                m_is_cr_pending = true;
+                ++i;
+                continue;
+            }
+        }
+
+        // Inside an IAC sequence, the state machine takes each byte.
+        unsigned char ch = telnetOptionParse(data[i++]);
+        if(ch != '\0')
+        {
+            output += static_cast<char>(ch);
+        }
+    }
+}
+
+/**
+ * @brief Client agreed to MCCP2, everything after IAC SB COMPRESS2 IAC SE is deflated.
+ */
+void TelnetDecoder::startCompression()
+{
+    if(!m_connection)
+    {
+        return;
+    }
+
+    socket_handler_ptr socket_handler = m_connection->getSocketHandle();
+    mccp_compressor_ptr compressor(new MccpCompressor());
+    if(!compressor->init(socket_handler->getCompressionLevel()))
+    {
+        // Take back the offer, output stays uncompressed.
+        sendIACSequences(WONT, TELOPT_MCCP_2);
+        return;
+    }
+
+    std::string start_sequence;
+    start_sequence += static_cast<char>(IAC);
+    start_sequence += static_cast<char>(SB);
+    start_sequence += static_cast<char>(TELOPT_MCCP_2);
+    start_sequence += static_cast<char>(IAC);
+    start_sequence += static_cast<char>(SE);
+
+    if(socket_handler->startCompression(compressor, start_sequence))
+    {
+        m_connection->asyncFlush(
+            std::bind(
+                &TelnetDecoder::handleWrite,
+                shared_from_this(),
+                std::placeholders::_1,
+                std::placeholders::_2));
+    }
+}
+
+/**
+ * @brief Client asked to stop MCCP2, the stream is ended and output is sent as is.
+ */
+void TelnetDecoder::stopCompression()
+{
+    if(m_connection)
+    {
+        m_connection->getSocketHandle()->stopCompression();
+    }
+}
+
 /**
  * @brief Parse Telnet Commands/Options from Incoming Data.
  *        Also handles responses to clients
@@ -216,6 +443,9 @@ unsigned char TelnetDecoder::telnetOptionParse(unsigned char c)
                         case TELOPT_LINEMODE:
                             m_is_linemode = false;
                             break;
+                        case TELOPT_MCCP_2:
+                            stopCompression();
+                            break;
 
                         default:
                             break;
@@ -300,6 +530,21 @@ unsigned char TelnetDecoder::telnetOptionParse(unsigned char c)
                             }
                             break;
 
+                        case TELOPT_MCCP_2:
+                            if(!checkReply(c))
+                            {
+                                // Only started when we offered it.
+                                std::cout << "[IAC] DO MCCP2 -> WONT [" << (int)m_teloptCommand << "] [" << (int)c << "]" << std::endl;
+                                sendIACSequences(telnetOptionDeny(m_teloptCommand),c);
+                            }
+                            else
+                            {
+                                std::cout << "[IAC] DO MCCP2 -> REPLY TO RESPONSE! [" << (int)m_teloptCommand << "] [" << (int)c << "]" << std::endl;
+                                deleteReply(c);
+                                startCompression();
+                            }
+                            break;
+
                         default:
                             std::cout << "[IAC] DO -> WONT [" << (int)m_teloptCommand << "] [" << (int)c << "]" << std::endl;
                             sendIACSequences(telnetOptionDeny(m_teloptCommand),c);
@@ -6,6 +6,8 @@
 #include "telnet.hpp"
 
 #include <memory>
+#include <atomic>
+#include <functional>
 #include <iostream>
 #include <string>
 #include <vector>
@@ -35,10 +37,12 @@ public:
         , m_is_echo(false)
         , m_is_sga(false)
         , m_is_linemode(false)
+        , m_is_cr_pending(false)
         , m_teloptStage(0)
         , m_teloptCommand(0)
         , m_currentOption(0)
         , m_subnegoOption(0)
+        , m_negotiation_callback(nullptr)
     {
         std::cout << "TelnetState Loaded!" << std::endl;
     }
@@ -79,12 +83,44 @@ public:
     void deleteReply(unsigned char option)
     {
         deleteSequence(reply_sequence, option);
+
+        // Last one answered or refused, negotiation is done.
+        if(reply_sequence.empty() && m_negotiation_callback)
+        {
+            std::function<void()> callback = std::move(m_negotiation_callback);
+            m_negotiation_callback = nullptr;
+            callback();
+        }
     }
     void addReply(unsigned char option)
     {
         addSequence(reply_sequence, option);
     }
 
+    /**
+     * @brief Check if every Reply we asked for has been Answered or Refused.
+     * @return
+     */
+    bool isNegotiationComplete() const
+    {
+        return reply_sequence.empty();
+    }
+
+    /**
+     * @brief Called once when the last pending reply is answered or refused,
+     *        straight away if there are none left.
+     * @param callback
+     */
+    void setNegotiationCallback(std::function<void()> callback)
+    {
+        if(callback && isNegotiationComplete())
+        {
+            callback();
+            return;
+        }
+        m_negotiation_callback = callback;
+    }
+
     /**
      * @brief handles active sequences negotiated.
      * @param option
@@ -106,6 +142,17 @@ public:
     void decodeBuffer();
     unsigned char telnetOptionParse(unsigned char c);
 
+    /**
+     * @brief Decode a block of Incoming Data, Telnet Options are parsed out.
+     *        Runs of plain text are copied in one append, only bytes from
+     *        an IAC onward are passed through telnetOptionParse.
+     *        CR LF and CR NUL become CR, even when split between reads.
+     * @param data
+     * @param length
+     * @param output Decoded text is appended.
+     */
+    void decode(const unsigned char *data, size_t length, std::string &output);
+
     int getTermRows() const
     {
         return (m_naws_row > 0 ? m_naws_row : 24);
@@ -120,18 +167,48 @@ public:
         return m_term_type;
     }
 
+    /**
+     * @brief Binary Transmission Negotiated, 0xFF in output is then sent as IAC IAC.
+     * @return
+     */
+    bool isBinary() const
+    {
+        return m_is_binary;
+    }
+
+    /**
+     * @brief Double each IAC in Outgoing Data.
+     *        When there is no 0xFF the output is left untouched,
+     *        so the caller sends the data as is without a copy.
+     * @param data
+     * @param output Escaped copy, only filled when an IAC was found.
+     * @return true if the data contained an IAC.
+     */
+    static bool escapeIAC(const std::string &data, std::string &output);
+
 private:
 
+    /**
+     * @brief Client agreed to MCCP2, start the deflate stream.
+     */
+    void startCompression();
+
+    /**
+     * @brief Client asked to stop MCCP2, end the deflate stream.
+     */
+    void stopCompression();
+
     connection_ptr m_connection;
 
     int         m_naws_row;
     int         m_naws_col;
     std::string m_term_type;
 
-    bool        m_is_binary;
+    std::atomic<bool> m_is_binary;  // Read from door threads on output.
     bool        m_is_echo;
     bool        m_is_sga;
     bool        m_is_linemode;
+    bool        m_is_cr_pending;  // Last text byte was CR, skip a following LF or NUL.
 
     // Global Option State for Telnet Options Parsing.
     int m_teloptStage;
@@ -146,6 +223,9 @@ private:
     // Holds Incoming SB Data Sequences to parse.
     std::string data_sequence;
 
+    // Session waiting on the pending replies.
+    std::function<void()> m_negotiation_callback;
+
     // Telnet Protocol Functions.
     unsigned char telnetOptionAcknowledge(unsigned char m_teloptCommand);
     unsigned char telnetOptionDeny(unsigned char m_teloptCommand);
@@ -174,6 +254,11 @@ private:
             return;
         }
         
+        if(!m_connection)
+        {
+            return;
+        }
+
         if(m_connection->getSocketHandle()->isActive() && TheCommunicator::instance()->isActive())
         {
             m_connection->asyncWrite(string_msg,
@@ -296,26 +381,14 @@ private:
         typename T::iterator it =
             find_if(t.begin(), t.end(), FindFirst(option));
 
-        typename T::iterator it_back = t.end();
-
-        if(t.size() == 0)
+        if(it == t.end())
         {
             return;
         }
-        else if(t.size() > 1)
-        {
-            // If Sequence Found, Swap to Back and Remove Back.
-            if(it != t.end())
-            {
-                iter_swap(it, it_back);
-                t.pop_back();
-            }
-            else
-            {
-                // Clear all.
-                std::vector<unsigned char>().swap(t);
-            }
-        }
+
+        // Swap to Back and Remove Back, only the one found.
+        iter_swap(it, t.end() - 1);
+        t.pop_back();
     }
 };
 
@@ -0,0 +1,391 @@
+#ifndef TIMER_WHEEL_HPP
+#define TIMER_WHEEL_HPP
+
+#include <functional>
+#include <chrono>
+#include <mutex>
+#include <vector>
+#include <memory>
+#include <algorithm>
+#include <cstdint>
+
+/**
+ * @class TimerWheel
+ * @author Michael Griffin
+ * @date 17/10/2026
+ * @file timer_wheel.hpp
+ * @brief Hierarchical Timer Wheel, Schedule and Cancel are O(1).
+ *        Owned by each IOService and processed on it's thread.
+ */
+class TimerWheel
+{
+public:
+
+    typedef std::function<void()> callback_function;
+
+    static const int TICK_MILLISECONDS = 10;
+    static const int ROOT_BITS         = 8;
+    static const int LEVEL_BITS        = 6;
+    static const int LEVELS            = 3;
+    static const int ROOT_SIZE         = 1 << ROOT_BITS;
+    static const int LEVEL_SIZE        = 1 << LEVEL_BITS;
+    static const int ROOT_MASK         = ROOT_SIZE - 1;
+    static const int LEVEL_MASK        = LEVEL_SIZE - 1;
+
+    /**
+     * @class Entry
+     * @brief Intrusive list node, held by the timer handle (DeadlineTimer)
+     *        so scheduling never allocates and cancel just unlinks.
+     */
+    class Entry
+    {
+    public:
+        Entry()
+            : m_prev(nullptr)
+            , m_next(nullptr)
+            , m_expires(0)
+            , m_callback(nullptr)
+        { }
+
+        bool isLinked() const
+        {
+            return m_next != nullptr;
+        }
+
+        Entry            *m_prev;
+        Entry            *m_next;
+        uint64_t          m_expires;
+        callback_function m_callback;
+    };
+
+    explicit TimerWheel()
+        : m_start(std::chrono::steady_clock::now())
+        , m_current_tick(0)
+        , m_count(0)
+        , m_notify(nullptr)
+    {
+        for(int i = 0; i < ROOT_SIZE; i++)
+        {
+            initList(&m_root[i]);
+        }
+        for(int level = 0; level < LEVELS; level++)
+        {
+            for(int i = 0; i < LEVEL_SIZE; i++)
+            {
+                initList(&m_levels[level][i]);
+            }
+        }
+    }
+
+    ~TimerWheel()
+    {
+        // Entries belong to their handles, just detach them.
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for(int i = 0; i < ROOT_SIZE; i++)
+        {
+            detachList(&m_root[i]);
+        }
+        for(int level = 0; level < LEVELS; level++)
+        {
+            for(int i = 0; i < LEVEL_SIZE; i++)
+            {
+                detachList(&m_levels[level][i]);
+            }
+        }
+    }
+
+    /**
+     * @brief Notification on new timers, used to wake a blocked reactor.
+     * @param notify
+     */
+    void setNotify(callback_function notify)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_notify = notify;
+    }
+
+    /**
+     * @brief Schedule (or Reschedule) an Entry to fire after milliseconds.
+     * @param entry
+     * @param milliseconds
+     * @param callback
+     */
+    void schedule(Entry *entry, int milliseconds, callback_function callback)
+    {
+        callback_function notify;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if(entry->isLinked())
+            {
+                unlink(entry);
+            }
+
+            uint64_t ticks = (milliseconds + TICK_MILLISECONDS - 1) / TICK_MILLISECONDS;
+            uint64_t now = std::max(getNowTick(), m_current_tick);
+
+            entry->m_expires = now + std::max<uint64_t>(ticks, 1);
+            entry->m_callback = callback;
+            addEntry(entry);
+            ++m_count;
+            notify = m_notify;
+        }
+
+        if(notify)
+        {
+            notify();
+        }
+    }
+
+    /**
+     * @brief Cancel a Pending Entry
+     * @param entry
+     * @return true if the entry was pending.
+     */
+    bool cancel(Entry *entry)
+    {
+        callback_function callback;
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if(!entry->isLinked())
+        {
+            return false;
+        }
+
+        unlink(entry);
+        callback.swap(entry->m_callback);
+        return true;
+    }
+
+    /**
+     * @brief Advance the Wheel to now and run expired callbacks.
+     *        Callbacks run outside the lock so they can reschedule.
+     * @return number of callbacks executed.
+     */
+    int process()
+    {
+        std::vector<callback_function> expired;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if(m_count == 0)
+            {
+                // Nothing pending, just keep the wheel position current.
+                m_current_tick = std::max(getNowTick() + 1, m_current_tick);
+                return 0;
+            }
+
+            uint64_t now = getNowTick();
+            while(m_current_tick <= now)
+            {
+                int index = m_current_tick & ROOT_MASK;
+
+                // Root wrapped, pull the next slot down from the upper levels.
+                if(index == 0)
+                {
+                    for(int level = 0; level < LEVELS; level++)
+                    {
+                        if(cascade(level, getLevelIndex(level)) != 0)
+                        {
+                            break;
+                        }
+                    }
+                }
+
+                Entry *head = &m_root[index];
+                while(head->m_next != head)
+                {
+                    Entry *entry = head->m_next;
+                    unlink(entry);
+                    expired.push_back(callback_function());
+                    expired.back().swap(entry->m_callback);
+                }
+                ++m_current_tick;
+            }
+        }
+
+        for(auto &callback : expired)
+        {
+            if(callback)
+            {
+                callback();
+            }
+        }
+        return static_cast<int>(expired.size());
+    }
+
+    /**
+     * @brief Milliseconds till the next timer may fire
+     * @param max_milliseconds
+     * @return max_milliseconds when nothing is due sooner.
+     */
+    int getTimeout(int max_milliseconds)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if(m_count == 0)
+        {
+            return max_milliseconds;
+        }
+
+        // Scan forward on the root till the next cascade boundary.
+        uint64_t next_tick = m_current_tick;
+        for(int i = 0; i < ROOT_SIZE; i++, next_tick++)
+        {
+            Entry *head = &m_root[next_tick & ROOT_MASK];
+            if(head->m_next != head || ((next_tick & ROOT_MASK) == 0 && i > 0))
+            {
+                break;
+            }
+        }
+
+        uint64_t now = getNowTick();
+        if(next_tick <= now)
+        {
+            return 0;
+        }
+
+        uint64_t wait = (next_tick - now) * TICK_MILLISECONDS;
+        if(max_milliseconds >= 0 && wait > static_cast<uint64_t>(max_milliseconds))
+        {
+            return max_milliseconds;
+        }
+        return static_cast<int>(wait);
+    }
+
+    /**
+     * @brief Number of Pending Timers
+     * @return
+     */
+    int size()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_count;
+    }
+
+private:
+
+    std::chrono::steady_clock::time_point m_start;
+    uint64_t          m_current_tick;
+    int               m_count;
+    callback_function m_notify;
+    std::mutex        m_mutex;
+
+    Entry             m_root[ROOT_SIZE];
+    Entry             m_levels[LEVELS][LEVEL_SIZE];
+
+    /**
+     * @brief Current Tick from the Wheel's start.
+     * @return
+     */
+    uint64_t getNowTick() const
+    {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(
+                   std::chrono::steady_clock::now() - m_start).count() / TICK_MILLISECONDS;
+    }
+
+    /**
+     * @brief Slot of the current tick on an upper level.
+     * @param level
+     * @return
+     */
+    int getLevelIndex(int level) const
+    {
+        return (m_current_tick >> (ROOT_BITS + level * LEVEL_BITS)) & LEVEL_MASK;
+    }
+
+    void initList(Entry *head)
+    {
+        head->m_prev = head;
+        head->m_next = head;
+    }
+
+    void detachList(Entry *head)
+    {
+        while(head->m_next != head)
+        {
+            unlink(head->m_next);
+        }
+    }
+
+    /**
+     * @brief Link an Entry into the slot matching how far out it expires.
+     * @param entry
+     */
+    void addEntry(Entry *entry)
+    {
+        uint64_t expires = entry->m_expires;
+        uint64_t ticks = expires - m_current_tick;
+
+        Entry *head = nullptr;
+        if(ticks < static_cast<uint64_t>(ROOT_SIZE))
+        {
+            head = &m_root[expires & ROOT_MASK];
+        }
+        else
+        {
+            int level = 0;
+            for(; level < LEVELS - 1; level++)
+            {
+                if(ticks < (1ULL << (ROOT_BITS + (level + 1) * LEVEL_BITS)))
+                {
+                    break;
+                }
+            }
+
+            // Beyond the wheel's range, park on the last slot, it cascades back in.
+            uint64_t max_ticks = (1ULL << (ROOT_BITS + LEVELS * LEVEL_BITS)) - 1;
+            if(ticks > max_ticks)
+            {
+                expires = m_current_tick + max_ticks;
+            }
+            head = &m_levels[level][(expires >> (ROOT_BITS + level * LEVEL_BITS)) & LEVEL_MASK];
+        }
+
+        entry->m_prev = head->m_prev;
+        entry->m_next = head;
+        head->m_prev->m_next = entry;
+        head->m_prev = entry;
+    }
+
+    void unlink(Entry *entry)
+    {
+        entry->m_prev->m_next = entry->m_next;
+        entry->m_next->m_prev = entry->m_prev;
+        entry->m_prev = nullptr;
+        entry->m_next = nullptr;
+        --m_count;
+    }
+
+    /**
+     * @brief Move an upper level slot down into the lower levels.
+     * @param level
+     * @param index
+     * @return index, 0 means the next level needs to cascade as well.
+     */
+    int cascade(int level, int index)
+    {
+        Entry list;
+        initList(&list);
+
+        Entry *head = &m_levels[level][index];
+        if(head->m_next != head)
+        {
+            list.m_next = head->m_next;
+            list.m_prev = head->m_prev;
+            list.m_next->m_prev = &list;
+            list.m_prev->m_next = &list;
+            initList(head);
+        }
+
+        while(list.m_next != &list)
+        {
+            Entry *entry = list.m_next;
+            list.m_next = entry->m_next;
+            entry->m_next->m_prev = &list;
+            addEntry(entry);
+        }
+        return index;
+    }
+};
+
+typedef std::shared_ptr<TimerWheel> timer_wheel_ptr;
+typedef std::weak_ptr<TimerWheel>   timer_wheel_wptr;
+
+#endif // TIMER_WHEEL_HPP
@@ -0,0 +1,254 @@
+#ifndef USER_DIRECTORY_HPP
+#define USER_DIRECTORY_HPP
+
+#include "model-sys/users.hpp"
+
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <map>
+#include <set>
+#include <mutex>
+#include <memory>
+
+class UserDirectory;
+typedef std::shared_ptr<UserDirectory> user_directory_ptr;
+
+/**
+ * @class UserDirectory
+ * @author Michael Griffin
+ * @date 17/10/2026
+ * @file user_directory.hpp
+ * @brief In Memory Directory of Users, one per users database file.
+ *        Handle, Real Name and Email are hashed case folded like the COLLATE NOCASE columns.
+ *        Loaded at startup, UsersDao keeps it current on insert, update and delete.
+ */
+class UserDirectory
+{
+public:
+
+    UserDirectory()
+    { }
+
+    ~UserDirectory()
+    {
+        std::cout << "~UserDirectory" << std::endl;
+    }
+
+    /**
+     * @brief Register a Loaded Directory for a Database File.
+     *        Replaces any Directory already registered.
+     * @param database_name
+     * @param directory
+     */
+    static void attach(const std::string &database_name, user_directory_ptr directory)
+    {
+        std::lock_guard<std::mutex> lock(getRegistryMutex());
+        getRegistry()[database_name] = directory;
+    }
+
+    /**
+     * @brief Directory Registered for a Database File
+     * @param database_name
+     * @return nullptr when none is loaded.
+     */
+    static user_directory_ptr find(const std::string &database_name)
+    {
+        std::lock_guard<std::mutex> lock(getRegistryMutex());
+        std::map<std::string, user_directory_ptr>::iterator it = getRegistry().find(database_name);
+        if (it == getRegistry().end())
+        {
+            return nullptr;
+        }
+        return it->second;
+    }
+
+    /**
+     * @brief Remove the Directory for a Database File, lookups go back to the database.
+     * @param database_name
+     */
+    static void release(const std::string &database_name)
+    {
+        std::lock_guard<std::mutex> lock(getRegistryMutex());
+        getRegistry().erase(database_name);
+    }
+
+    /**
+     * @brief Fold Case the same as SQLite NOCASE (ASCII only)
+     * @param value
+     * @return
+     */
+    static std::string foldCase(const std::string &value)
+    {
+        std::string result = value;
+        for (char &c : result)
+        {
+            if (c >= 'A' && c <= 'Z')
+            {
+                c = c - 'A' + 'a';
+            }
+        }
+        return result;
+    }
+
+    /**
+     * @brief Add or Replace a User, keyed on iId.
+     * @param user
+     */
+    void upsertUser(user_ptr user)
+    {
+        if (!user || user->iId < 0)
+        {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        eraseUser(user->iId);
+
+        user_ptr copy(new Users(*user));
+        m_users[copy->iId] = copy;
+        addKey(m_handles, copy->sHandle, copy->iId);
+        addKey(m_real_names, copy->sRealName, copy->iId);
+        addKey(m_emails, copy->sEmail, copy->iId);
+    }
+
+    /**
+     * @brief Remove a User by Id
+     * @param id
+     */
+    void removeUser(long id)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        eraseUser(id);
+    }
+
+    /**
+     * @brief Lookup by Id
+     * @param id
+     * @return Copy of the User, nullptr if not found.
+     */
+    user_ptr getUserById(long id)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return copyUser(id);
+    }
+
+    /**
+     * @brief Lookup by Handle, Case Insensitive.
+     * @param name
+     * @return Copy of the User, nullptr if not found.
+     */
+    user_ptr getUserByHandle(const std::string &name)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return copyUser(findKey(m_handles, name));
+    }
+
+    /**
+     * @brief Lookup by Real Name, Case Insensitive.
+     * @param name
+     * @return Copy of the User, nullptr if not found.
+     */
+    user_ptr getUserByRealName(const std::string &name)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return copyUser(findKey(m_real_names, name));
+    }
+
+    /**
+     * @brief Lookup by Email, Case Insensitive.
+     * @param email
+     * @return Copy of the User, nullptr if not found.
+     */
+    user_ptr getUserByEmail(const std::string &email)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return copyUser(findKey(m_emails, email));
+    }
+
+    /**
+     * @brief Number of Users in the Directory
+     * @return
+     */
+    size_t getUserCount()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_users.size();
+    }
+
+private:
+
+    // Ids per folded key, duplicates resolve to the lowest Id like the first row in SQL.
+    typedef std::unordered_map<std::string, std::set<long>> key_index;
+
+    static std::map<std::string, user_directory_ptr> &getRegistry()
+    {
+        static std::map<std::string, user_directory_ptr> registry;
+        return registry;
+    }
+
+    static std::mutex &getRegistryMutex()
+    {
+        static std::mutex registry_mutex;
+        return registry_mutex;
+    }
+
+    void addKey(key_index &index, const std::string &value, long id)
+    {
+        index[foldCase(value)].insert(id);
+    }
+
+    void removeKey(key_index &index, const std::string &value, long id)
+    {
+        key_index::iterator it = index.find(foldCase(value));
+        if (it == index.end())
+        {
+            return;
+        }
+
+        it->second.erase(id);
+        if (it->second.empty())
+        {
+            index.erase(it);
+        }
+    }
+
+    long findKey(key_index &index, const std::string &value)
+    {
+        key_index::iterator it = index.find(foldCase(value));
+        return (it == index.end()) ? -1 : *it->second.begin();
+    }
+
+    void eraseUser(long id)
+    {
+        std::unordered_map<long, user_ptr>::iterator it = m_users.find(id);
+        if (it == m_users.end())
+        {
+            return;
+        }
+
+        user_ptr user = it->second;
+        m_users.erase(it);
+        removeKey(m_handles, user->sHandle, id);
+        removeKey(m_real_names, user->sRealName, id);
+        removeKey(m_emails, user->sEmail, id);
+    }
+
+    user_ptr copyUser(long id)
+    {
+        std::unordered_map<long, user_ptr>::iterator it = m_users.find(id);
+        if (it == m_users.end())
+        {
+            return nullptr;
+        }
+        return user_ptr(new Users(*it->second));
+    }
+
+    std::mutex                          m_mutex;
+    std::unordered_map<long, user_ptr>  m_users;
+    key_index                           m_handles;
+    key_index                           m_real_names;
+    key_index                           m_emails;
+};
+
+#endif // USER_DIRECTORY_HPP
@@ -0,0 +1,105 @@
+/**
+ * @brief Oblivion/2 XRM Unit Tests for AdmissionControl.
+ * @return
+ */
+
+#include "admission_control.hpp"
+
+#include <UnitTest++.h>
+
+// C++ Standard
+#include <iostream>
+#include <string>
+#include <vector>
+#include <memory>
+
+SUITE(XRMAdmissionControl)
+{
+    TEST(UnlimitedAdmitsAll)
+    {
+        admission_control_ptr admission(new AdmissionControl(0, 0, 0));
+        std::vector<admission_ticket_ptr> tickets;
+        int reason = -1;
+
+        for (int i = 0; i < 50; i++)
+        {
+            tickets.push_back(admission->admit("10.0.0.1", reason));
+            CHECK(tickets.back() != nullptr);
+            CHECK_EQUAL(AdmissionControl::ADMIT_ACCEPTED, reason);
+        }
+        CHECK_EQUAL(50, admission->getActiveNodes());
+    }
+
+    TEST(MaxNodesRejects)
+    {
+        admission_control_ptr admission(new AdmissionControl(2, 0, 0));
+        int reason = -1;
+
+        admission_ticket_ptr first = admission->admit("10.0.0.1", reason);
+        admission_ticket_ptr second = admission->admit("10.0.0.2", reason);
+        admission_ticket_ptr third = admission->admit("10.0.0.3", reason);
+
+        CHECK(first != nullptr);
+        CHECK(second != nullptr);
+        CHECK(third == nullptr);
+        CHECK_EQUAL(AdmissionControl::ADMIT_MAX_NODES, reason);
+        CHECK(!AdmissionControl::getRejectMessage(reason).empty());
+
+        // Releasing a ticket frees the node.
+        first.reset();
+        CHECK_EQUAL(1, admission->getActiveNodes());
+        third = admission->admit("10.0.0.3", reason);
+        CHECK(third != nullptr);
+    }
+
+    TEST(MaxPerAddressRejects)
+    {
+        admission_control_ptr admission(new AdmissionControl(0, 2, 0));
+        int reason = -1;
+
+        admission_ticket_ptr first = admission->admit("10.0.0.1", reason);
+        admission_ticket_ptr second = admission->admit("10.0.0.1", reason);
+        admission_ticket_ptr third = admission->admit("10.0.0.1", reason);
+        CHECK(third == nullptr);
+        CHECK_EQUAL(AdmissionControl::ADMIT_MAX_ADDRESS, reason);
+        CHECK_EQUAL(2, admission->getActiveConnections("10.0.0.1"));
+
+        // Other addresses are not affected.
+        admission_ticket_ptr other = admission->admit("10.0.0.2", reason);
+        CHECK(other != nullptr);
+        CHECK_EQUAL(AdmissionControl::ADMIT_ACCEPTED, reason);
+    }
+
+    TEST(MaxPerMinuteRejects)
+    {
+        admission_control_ptr admission(new AdmissionControl(0, 0, 3));
+        int reason = -1;
+
+        // Reconnect storm, each connection closed straight away.
+        for (int i = 0; i < 3; i++)
+        {
+            admission_ticket_ptr ticket = admission->admit("10.0.0.1", reason);
+            CHECK(ticket != nullptr);
+        }
+
+        admission_ticket_ptr ticket = admission->admit("10.0.0.1", reason);
+        CHECK(ticket == nullptr);
+        CHECK_EQUAL(AdmissionControl::ADMIT_RATE_LIMITED, reason);
+        CHECK_EQUAL(0, admission->getActiveNodes());
+    }
+
+    TEST(TicketOutlivesAdmissionControl)
+    {
+        admission_ticket_ptr ticket;
+        {
+            admission_control_ptr admission(new AdmissionControl(1, 1, 1));
+            int reason = -1;
+            ticket = admission->admit("10.0.0.1", reason);
+            CHECK(ticket != nullptr);
+        }
+
+        // Released after shutdown without touching the old control.
+        ticket.reset();
+        CHECK(ticket == nullptr);
+    }
+}
@@ -0,0 +1,27 @@
+#ifndef ASYNC_COMPLETION_UT_HPP
+#define ASYNC_COMPLETION_UT_HPP
+
+#include "io_service.hpp"
+
+#include <thread>
+#include <chrono>
+
+/**
+ * @brief Run the IOService Timers until the callback flips the flag, or we give up.
+ *        Shared by the tests of work posted back through AsyncCompletion.
+ * @param io_service
+ * @param is_done
+ * @param attempts
+ * @return
+ */
+inline bool waitForCallback(IOService &io_service, const bool &is_done, int attempts = 500)
+{
+    for (int i = 0; i < attempts && !is_done; i++)
+    {
+        io_service.checkPriorityTimers();
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    return is_done;
+}
+
+#endif // ASYNC_COMPLETION_UT_HPP
@@ -0,0 +1,149 @@
+#include <UnitTest++.h>
+#include "database_executor.hpp"
+#include "io_service.hpp"
+#include "async_completion_ut.hpp"
+
+#include "model-sys/session_stats.hpp"
+#include "data-sys/session_stats_dao.hpp"
+
+#include "libSqliteWrapped.h"
+
+#include <iostream>
+#include <string>
+#include <thread>
+#include <chrono>
+#include <cstdio>
+
+/**
+ * Handle Setup and Tear Down of the Database Executor Tests
+ */
+class MyFixtureDatabaseExecutor
+{
+
+public:
+
+    MyFixtureDatabaseExecutor()
+        : m_database("xrm_utDatabaseExecutorTest.sqlite3")
+    {
+        std::cout << "xrm_utDatabaseExecutorTest.sqlite3" << std::endl;
+        remove("xrm_utDatabaseExecutorTest.sqlite3");
+
+        SessionStatsDao session_stats_dao(m_database);
+        session_stats_dao.createTable();
+    }
+
+    ~MyFixtureDatabaseExecutor()
+    { }
+
+    /**
+     * @brief Insert a Session on the executor's own connection.
+     */
+    static long insertSession(SQLW::Database &database)
+    {
+        SessionStatsDao session_stats_dao(database);
+        session_stats_ptr stats(new SessionStats());
+        stats->sSessionType = "TELNET";
+        return session_stats_dao.insertRecord(stats);
+    }
+
+    SQLW::Database m_database;
+    IOService      m_io_service;
+};
+
+
+/**
+ * @brief Unit Testing for the Database Executor.
+ * @return
+ */
+SUITE(XRMDatabaseExecutor)
+{
+
+    // Work runs on the database thread, the callback on the IOService.
+    TEST_FIXTURE(MyFixtureDatabaseExecutor, CallbackRunsOnIOService)
+    {
+        DatabaseExecutor executor("xrm_utDatabaseExecutorTest.sqlite3", 2);
+        executor.start();
+
+        std::thread::id caller = std::this_thread::get_id();
+        std::thread::id work_thread;
+        std::thread::id callback_thread;
+        bool is_done = false;
+        long record_id = -1;
+
+        DatabaseExecutor::request_ptr request = executor.execute<long>(m_io_service, "SessionStatsDao::insertRecord",
+            [&](SQLW::Database &database)
+        {
+            work_thread = std::this_thread::get_id();
+            return insertSession(database);
+        },
+        [&](long id)
+        {
+            callback_thread = std::this_thread::get_id();
+            record_id = id;
+            is_done = true;
+        });
+
+        CHECK(request);
+        CHECK(waitForCallback(m_io_service, is_done));
+        CHECK(record_id > 0);
+        CHECK(work_thread != caller);
+        CHECK(callback_thread == caller);
+
+        // Visible on the shared connection.
+        SessionStatsDao session_stats_dao(m_database);
+        CHECK_EQUAL(1, session_stats_dao.getRecordsCount());
+
+        executor.shutdown();
+        std::map<std::string, DatabaseExecutor::MethodStats> stats = executor.getMethodStats();
+        CHECK_EQUAL(1u, stats.size());
+        CHECK_EQUAL(1u, stats["SessionStatsDao::insertRecord"].calls);
+        CHECK(stats["SessionStatsDao::insertRecord"].run_max_ms >= 0);
+    }
+
+    // Cancelled requests skip the callback, the write still happens.
+    TEST_FIXTURE(MyFixtureDatabaseExecutor, CancelledRequestStillWrites)
+    {
+        DatabaseExecutor executor("xrm_utDatabaseExecutorTest.sqlite3", 1);
+        executor.start();
+
+        bool is_called = false;
+        DatabaseExecutor::request_ptr request = executor.execute<long>(m_io_service, "SessionStatsDao::insertRecord",
+            &MyFixtureDatabaseExecutor::insertSession, [&](long)
+        {
+            is_called = true;
+        });
+        request->cancel();
+
+        // Shutdown finishes the queue before joining.
+        executor.shutdown();
+        CHECK(!waitForCallback(m_io_service, is_called, 50));
+
+        SessionStatsDao session_stats_dao(m_database);
+        CHECK_EQUAL(1, session_stats_dao.getRecordsCount());
+    }
+
+    // Work is queued till a thread is free, then drained in order.
+    TEST_FIXTURE(MyFixtureDatabaseExecutor, QueuedWorkDrainsOnShutdown)
+    {
+        DatabaseExecutor executor("xrm_utDatabaseExecutorTest.sqlite3", 1);
+
+        for (int i = 0; i < 5; i++)
+        {
+            executor.execute<long>(m_io_service, "SessionStatsDao::insertRecord",
+                                   &MyFixtureDatabaseExecutor::insertSession, nullptr);
+        }
+        CHECK_EQUAL(5u, executor.getQueueDepth());
+
+        executor.start();
+        executor.shutdown();
+        CHECK_EQUAL(0u, executor.getQueueDepth());
+        CHECK_EQUAL(5u, executor.getMethodStats()["SessionStatsDao::insertRecord"].calls);
+
+        // Nothing is accepted once shutdown.
+        CHECK(!executor.execute<long>(m_io_service, "SessionStatsDao::insertRecord",
+                                      &MyFixtureDatabaseExecutor::insertSession, nullptr));
+
+        SessionStatsDao session_stats_dao(m_database);
+        CHECK_EQUAL(5, session_stats_dao.getRecordsCount());
+    }
+}
@@ -0,0 +1,194 @@
+#include <UnitTest++.h>
+#include "libSqliteWrapped.h"
+
+#include <iostream>
+#include <string>
+#include <thread>
+#include <cstdio>
+
+/**
+ * Handle Setup and Tear Down of the Connection Pool Tests
+ */
+class MyFixtureDatabasePool
+{
+
+public:
+
+    MyFixtureDatabasePool()
+        : m_database("xrm_utDatabasePoolTest.sqlite3")
+    {
+        // Database is opened on the first Query, clear out the last run.
+        std::cout << "xrm_utDatabasePoolTest.sqlite3" << std::endl;
+        remove("xrm_utDatabasePoolTest.sqlite3");
+    }
+
+    ~MyFixtureDatabasePool()
+    { }
+
+    SQLW::Database m_database;
+};
+
+
+/**
+ * @brief Unit Testing for the SQLW::Database Connection Pool.
+ * @return
+ */
+SUITE(XRMDatabasePool)
+{
+
+    // Sequential Queries on one thread reuse the same connection.
+    TEST_FIXTURE(MyFixtureDatabasePool, ThreadReusesConnection)
+    {
+        {
+            SQLW::Query qry(m_database);
+            CHECK(qry.isConnected());
+            CHECK(qry.execute("CREATE TABLE IF NOT EXISTS test (id INTEGER PRIMARY KEY, value TEXT);"));
+        }
+        {
+            SQLW::Query qry(m_database);
+            CHECK(qry.isConnected());
+        }
+
+        SQLW::Database::PoolStats stats = m_database.getPoolStats();
+        CHECK_EQUAL(1, stats.open);
+        CHECK_EQUAL(0, stats.busy);
+        CHECK_EQUAL(2u, stats.acquires);
+        CHECK_EQUAL(1u, stats.affinity_hits);
+    }
+
+    // No Pragmas are run unless the Database opts in.
+    TEST_FIXTURE(MyFixtureDatabasePool, NoPragmasByDefault)
+    {
+        SQLW::Query qry(m_database);
+        CHECK(qry.isConnected());
+        CHECK_EQUAL(std::string("delete"), std::string(qry.exeGetCharString("PRAGMA journal_mode;")));
+        CHECK_EQUAL(2, qry.exeGetResultLong("PRAGMA synchronous;"));
+    }
+
+    // Pool Pragmas are applied once when the connection is opened.
+    TEST_FIXTURE(MyFixtureDatabasePool, PragmasAppliedOnOpen)
+    {
+        m_database.setConnectionPragmas(SQLW::Database::POOL_PRAGMAS);
+        SQLW::Query qry(m_database);
+        CHECK(qry.isConnected());
+        CHECK_EQUAL(std::string("wal"), std::string(qry.exeGetCharString("PRAGMA journal_mode;")));
+        CHECK_EQUAL(1, qry.exeGetResultLong("PRAGMA synchronous;"));
+    }
+
+    // Nested Queries open more connections, the peak is tracked.
+    TEST_FIXTURE(MyFixtureDatabasePool, OccupancyStats)
+    {
+        m_database.setMaxConnections(2);
+        {
+            SQLW::Query first(m_database);
+            SQLW::Query second(m_database);
+            CHECK(first.isConnected());
+            CHECK(second.isConnected());
+
+            SQLW::Database::PoolStats stats = m_database.getPoolStats();
+            CHECK_EQUAL(2, stats.open);
+            CHECK_EQUAL(2, stats.busy);
+            CHECK_EQUAL(2, stats.max_connections);
+        }
+
+        SQLW::Database::PoolStats stats = m_database.getPoolStats();
+        CHECK_EQUAL(0, stats.busy);
+        CHECK_EQUAL(2, stats.peak_busy);
+        CHECK_EQUAL(0u, stats.waits);
+    }
+
+    // A bounded pool makes other threads wait for a free connection.
+    TEST_FIXTURE(MyFixtureDatabasePool, BoundedPoolWaits)
+    {
+        m_database.setMaxConnections(1);
+
+        bool is_connected = false;
+        std::thread thread;
+        {
+            SQLW::Query qry(m_database);
+            CHECK(qry.isConnected());
+
+            thread = std::thread([this, &is_connected]
+            {
+                SQLW::Query other(m_database);
+                is_connected = other.isConnected();
+            });
+
+            // Give the other thread time to block on the pool.
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        }
+        thread.join();
+
+        CHECK(is_connected);
+        SQLW::Database::PoolStats stats = m_database.getPoolStats();
+        CHECK_EQUAL(1, stats.open);
+        CHECK_EQUAL(1u, stats.waits);
+        CHECK_EQUAL(0u, stats.overflows);
+    }
+
+    // Prepared statements are parsed once then reused with new bindings.
+    TEST_FIXTURE(MyFixtureDatabasePool, PreparedStatementCache)
+    {
+        SQLW::Query qry(m_database);
+        CHECK(qry.execute("CREATE TABLE IF NOT EXISTS test (id INTEGER PRIMARY KEY, value TEXT, amount REAL);"));
+
+        for (int i = 1; i <= 3; i++)
+        {
+            CHECK(qry.prepare("INSERT INTO test (id, value, amount) VALUES (?, ?, ?);"));
+            CHECK(qry.bind(1, i));
+            CHECK(qry.bind(2, std::string("it's value ") + std::to_string(i)));
+            CHECK(qry.bind(3, i * 1.5));
+            CHECK(qry.execute());
+        }
+
+        for (int i = 1; i <= 3; i++)
+        {
+            CHECK(qry.prepare("SELECT * FROM test WHERE id = ?;"));
+            CHECK(qry.bind(1, static_cast<long>(i)));
+            CHECK(qry.getResult());
+            CHECK(qry.fetchRow());
+            CHECK_EQUAL(std::string("it's value ") + std::to_string(i), std::string(qry.getString("value")));
+            CHECK_EQUAL(i * 1.5, qry.getNumber("amount"));
+
+            std::string value;
+            qry.getFieldByName("value", value);
+            CHECK_EQUAL(std::string("it's value ") + std::to_string(i), value);
+            qry.freeResult();
+        }
+
+        SQLW::Database::PoolStats stats = m_database.getPoolStats();
+        CHECK_EQUAL(2u, stats.statement_misses);
+        CHECK_EQUAL(4u, stats.statement_hits);
+    }
+
+    // Least recently used statements are finalized once the cache is full.
+    TEST_FIXTURE(MyFixtureDatabasePool, PreparedStatementEviction)
+    {
+        SQLW::Query qry(m_database);
+        for (size_t i = 0; i <= SQLW::Database::STATEMENT_CACHE_SIZE; i++)
+        {
+            CHECK(qry.prepare("SELECT " + std::to_string(i) + ";"));
+            CHECK(qry.getResult());
+            CHECK(qry.fetchRow());
+            CHECK_EQUAL(static_cast<long>(i), qry.getValue(0));
+            qry.freeResult();
+        }
+
+        // First statement was evicted, the last one is still cached.
+        CHECK(qry.prepare("SELECT " + std::to_string(SQLW::Database::STATEMENT_CACHE_SIZE) + ";"));
+        qry.freeResult();
+        CHECK(qry.prepare("SELECT 0;"));
+        qry.freeResult();
+
+        SQLW::Database::PoolStats stats = m_database.getPoolStats();
+        CHECK_EQUAL(SQLW::Database::STATEMENT_CACHE_SIZE + 2, stats.statement_misses);
+        CHECK_EQUAL(1u, stats.statement_hits);
+    }
+
+    // Formatted queries quote strings and free sqlite's buffer.
+    TEST(FormatQueryQuotes)
+    {
+        std::string result = SQLW::Database::formatQuery("SELECT * FROM %Q WHERE id = %ld;", "it's", 5L);
+        CHECK_EQUAL(std::string("SELECT * FROM 'it''s' WHERE id = 5;"), result);
+    }
+}
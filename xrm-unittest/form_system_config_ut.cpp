@@ -24,7 +24,7 @@
 // Definitions for XRMFormSystemConfig Unit Tests.
 // NOTE These are position in the config index of the methods,
 // If we add new otpions, then these must be incremented!
-#define MAX_OPTIONS 107
+#define MAX_OPTIONS 117
 #define BBS_NAME_SYSOP 0
 #define USE_SSL_SERVICE 10
 #define PORT_TELNET 7
@@ -0,0 +1,278 @@
+/**
+ * @brief Oblivion/2 XRM Unit Tests for IOService Socket Engines.
+ * @return
+ */
+
+#include "io_service.hpp"
+#include "async_connection.hpp"
+#include "socket_handler.hpp"
+#include "socket_state.hpp"
+
+#include <UnitTest++.h>
+
+// C++ Standard
+#include <iostream>
+#include <string>
+#include <vector>
+#include <memory>
+#include <thread>
+#include <chrono>
+#include <functional>
+#include <atomic>
+#include <deque>
+
+#ifndef _WIN32
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace
+{
+    const int ECHO_MESSAGE_SIZE = 64;
+    const int ECHO_ROUNDS       = 50;
+
+    /**
+     * @brief Server side of an Echo Session, writes back whatever it reads.
+     */
+    class EchoSession
+        : public std::enable_shared_from_this<EchoSession>
+    {
+    public:
+        EchoSession(IOService &io_service, socket_handler_ptr handler)
+            : m_connection(new AsyncConnection(io_service, handler))
+        { }
+
+        void waitForData()
+        {
+            std::shared_ptr<EchoSession> self = shared_from_this();
+            m_connection->asyncRead(m_in_data_vector,
+                                    [self](const std::error_code &error, socket_handler_ptr)
+            {
+                if (error)
+                {
+                    return;
+                }
+                std::string data(self->m_in_data_vector.begin(), self->m_in_data_vector.end());
+                self->m_in_data_vector.clear();
+                self->m_connection->asyncWrite(data, [](const std::error_code &, socket_handler_ptr) { });
+                self->waitForData();
+            });
+        }
+
+        connection_ptr             m_connection;
+        std::vector<unsigned char> m_in_data_vector;
+    };
+
+    /**
+     * @brief Blocking read of exactly size bytes on the client side.
+     */
+    bool readAll(int socket_descriptor, char *buffer, int size)
+    {
+        int total = 0;
+        while (total < size)
+        {
+            int result = ::read(socket_descriptor, buffer + total, size - total);
+            if (result <= 0)
+            {
+                return false;
+            }
+            total += result;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Echo messages through a running IOService on socketpairs.
+     * @param sessions
+     * @param use_io_uring
+     * @return number of sessions with matching echoes, -1 if uring is unavailable.
+     */
+    int runEchoBenchmark(int sessions, bool use_io_uring)
+    {
+        IOService io_service;
+        if (use_io_uring && !io_service.enableIoUring())
+        {
+            return -1;
+        }
+
+        std::vector<int> clients;
+        std::vector<socket_handler_ptr> handlers;
+        std::vector<std::shared_ptr<EchoSession>> echo_sessions;
+        for (int i = 0; i < sessions; i++)
+        {
+            int pair[2];
+            if (socketpair(AF_UNIX, SOCK_STREAM, 0, pair) != 0)
+            {
+                break;
+            }
+
+            std::shared_ptr<POSIX_Socket> state(new POSIX_Socket("localhost", 0));
+            state->spawnDescriptor(pair[1]);
+
+            socket_handler_ptr handler(new SocketHandler());
+            handler->setSocketType("TELNET");
+            handler->setSocketState(state);
+
+            std::shared_ptr<EchoSession> echo(new EchoSession(io_service, handler));
+            echo->waitForData();
+
+            clients.push_back(pair[0]);
+            handlers.push_back(handler);
+            echo_sessions.push_back(echo);
+        }
+
+        std::thread thread([&io_service] { io_service.run(); });
+
+        std::string message(ECHO_MESSAGE_SIZE, 'x');
+        char reply[ECHO_MESSAGE_SIZE];
+        int matched = 0;
+
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        for (int round = 0; round < ECHO_ROUNDS; round++)
+        {
+            matched = 0;
+            for (int client : clients)
+            {
+                message[0] = static_cast<char>('a' + (round % 26));
+                if (::write(client, message.data(), message.size()) != static_cast<int>(message.size()))
+                {
+                    break;
+                }
+            }
+            for (int client : clients)
+            {
+                if (readAll(client, reply, ECHO_MESSAGE_SIZE) && std::string(reply, ECHO_MESSAGE_SIZE) == message)
+                {
+                    ++matched;
+                }
+            }
+        }
+        long long elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+                                std::chrono::steady_clock::now() - start).count();
+
+        std::cout << "IOService " << (use_io_uring ? "io_uring" : "epoll")
+                  << " echo " << sessions << " sessions x " << ECHO_ROUNDS << " rounds: "
+                  << elapsed << "us, "
+                  << (elapsed > 0 ? (static_cast<long long>(sessions) * ECHO_ROUNDS * 1000000LL / elapsed) : 0)
+                  << " msgs/sec" << std::endl;
+
+        for (int client : clients)
+        {
+            ::close(client);
+        }
+        for (socket_handler_ptr &handler : handlers)
+        {
+            handler->close();
+        }
+
+        io_service.stop();
+        thread.join();
+        return matched;
+    }
+
+    /**
+     * @brief Socket without a descriptor whose send window stays closed, like
+     *        an SSH channel on a stalled client. Counts the send attempts.
+     */
+    class StalledSocket : public SocketState
+    {
+    public:
+        StalledSocket()
+            : SocketState("localhost", 0)
+            , m_send_attempts(0)
+        {
+            m_is_socket_active = true;
+        }
+
+        virtual int sendSocket(unsigned char *, Uint32)
+        {
+            return 0;
+        }
+        virtual int recvSocket(char *)
+        {
+            return 0;
+        }
+        virtual socket_handler_ptr pollSocketAccepts()
+        {
+            return nullptr;
+        }
+        virtual void spawnSocket(TCPsocket) { }
+        virtual int pollSocket()
+        {
+            return 0;
+        }
+        virtual bool onConnect()
+        {
+            return true;
+        }
+        virtual bool onListen()
+        {
+            return true;
+        }
+        virtual bool onExit()
+        {
+            return true;
+        }
+        virtual int sendSocketVector(const std::deque<std::string> &, std::string::size_type)
+        {
+            ++m_send_attempts;
+            return 0;
+        }
+
+        std::atomic<int> m_send_attempts;
+    };
+}
+
+SUITE(XRMIOService)
+{
+    TEST(EchoThroughReactor)
+    {
+        CHECK_EQUAL(64, runEchoBenchmark(64, false));
+        CHECK_EQUAL(256, runEchoBenchmark(256, false));
+    }
+
+    TEST(EchoThroughIoUring)
+    {
+        // Only when built with USE_IO_URING and the kernel supports it.
+        int matched = runEchoBenchmark(64, true);
+        if (matched != -1)
+        {
+            CHECK_EQUAL(64, matched);
+            CHECK_EQUAL(256, runEchoBenchmark(256, true));
+        }
+    }
+
+    // A blocked send without a descriptor is retried each poll interval, not spun on.
+    TEST(StalledWriteWaitsForPollInterval)
+    {
+        IOService io_service;
+        std::shared_ptr<StalledSocket> state(new StalledSocket());
+
+        socket_handler_ptr handler(new SocketHandler());
+        handler->setSocketType("SSH");
+        handler->setSocketState(state);
+
+        connection_ptr connection(new AsyncConnection(io_service, handler));
+        connection->asyncWrite(std::string("stalled"), [](const std::error_code &, socket_handler_ptr) { });
+
+        std::thread thread([&io_service] { io_service.run(); });
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        io_service.stop();
+        thread.join();
+
+        // About one attempt per REACTOR_POLL_TIMEOUT, allow for scheduling.
+        CHECK(state->m_send_attempts > 0);
+        CHECK(state->m_send_attempts < 50);
+        handler->close();
+    }
+
+    TEST(IoUringRequiresReactor)
+    {
+        IOService io_service;
+        CHECK(!io_service.isIoUringMode());
+#if !defined(USE_IO_URING)
+        CHECK(!io_service.enableIoUring());
+        CHECK(!io_service.isIoUringMode());
+#endif
+    }
+}
+#endif
@@ -0,0 +1,225 @@
+/**
+ * @brief Oblivion/2 XRM Unit Tests for JobQueue and JobList.
+ * @return
+ */
+
+#include "job_queue.hpp"
+#include "safe_vector.hpp"
+
+#include <UnitTest++.h>
+
+// C++ Standard
+#include <iostream>
+#include <string>
+#include <vector>
+#include <memory>
+#include <thread>
+#include <chrono>
+
+SUITE(XRMJobQueue)
+{
+    TEST(QueuePopsInOrder)
+    {
+        JobQueue<int> queue;
+        CHECK(queue.is_empty());
+
+        queue.push(1);
+        queue.push(2);
+        queue.push(3);
+        CHECK_EQUAL(3u, queue.size());
+
+        int value = 0;
+        CHECK(queue.pop(value));
+        CHECK_EQUAL(1, value);
+        CHECK(queue.pop(value));
+        CHECK_EQUAL(2, value);
+        CHECK(queue.pop(value));
+        CHECK_EQUAL(3, value);
+        CHECK(!queue.pop(value));
+        CHECK(queue.is_empty());
+    }
+
+    TEST(QueueMultipleProducers)
+    {
+        JobQueue<int> queue;
+        const int producers = 4;
+        const int jobs = 10000;
+
+        std::vector<std::thread> threads;
+        for (int p = 0; p < producers; p++)
+        {
+            threads.push_back(std::thread([&queue, jobs]()
+            {
+                for (int i = 0; i < jobs; i++)
+                {
+                    queue.push(i);
+                }
+            }));
+        }
+
+        // Consume while producers are still pushing.
+        int count = 0;
+        long long total = 0;
+        int value = 0;
+        while (count < producers * jobs)
+        {
+            if (queue.pop(value))
+            {
+                ++count;
+                total += value;
+            }
+        }
+
+        for (auto &thread : threads)
+        {
+            thread.join();
+        }
+
+        CHECK_EQUAL(producers * jobs, count);
+        CHECK_EQUAL(static_cast<long long>(producers) * jobs * (jobs - 1) / 2, total);
+        CHECK(queue.is_empty());
+    }
+
+    TEST(QueueReleasesSharedPointers)
+    {
+        std::shared_ptr<int> job(new int(1));
+        {
+            JobQueue<std::shared_ptr<int>> queue;
+            queue.push(job);
+            queue.push(job);
+            CHECK_EQUAL(3, job.use_count());
+
+            std::shared_ptr<int> popped;
+            CHECK(queue.pop(popped));
+            popped.reset();
+            CHECK_EQUAL(2, job.use_count());
+        }
+        CHECK_EQUAL(1, job.use_count());
+    }
+
+    // Popped nodes are moved into the list as is, the queue keeps none of them.
+    TEST(QueueNodesMoveIntoList)
+    {
+        std::shared_ptr<int> job(new int(1));
+        JobQueue<std::shared_ptr<int>> queue;
+        JobList<std::shared_ptr<int>> list;
+        queue.push(job);
+        queue.push(job);
+
+        JobQueue<std::shared_ptr<int>>::Node *node;
+        while ((node = queue.pop_node()) != nullptr)
+        {
+            list.push_back(node);
+        }
+        CHECK(queue.is_empty());
+        CHECK_EQUAL(0u, queue.size());
+        CHECK_EQUAL(2u, list.size());
+        CHECK_EQUAL(3, job.use_count());
+        CHECK(list.front()->m_value == job);
+
+        list.clear();
+        CHECK_EQUAL(1, job.use_count());
+
+        // The queue still works with it's new stub.
+        queue.push(job);
+        std::shared_ptr<int> popped;
+        CHECK(queue.pop(popped));
+        CHECK(popped == job);
+    }
+
+    TEST(ListEraseWhileIterating)
+    {
+        JobList<int> list;
+        for (int i = 0; i < 6; i++)
+        {
+            list.push_back(i);
+        }
+
+        // Remove even entries, including the first.
+        JobList<int>::Node *node = list.front();
+        while (node != nullptr)
+        {
+            node = (node->m_value % 2 == 0) ? list.erase(node) : node->m_next;
+        }
+        CHECK_EQUAL(3u, list.size());
+
+        std::vector<int> remaining;
+        for (node = list.front(); node != nullptr; node = node->m_next)
+        {
+            remaining.push_back(node->m_value);
+        }
+        CHECK_EQUAL(3u, remaining.size());
+        CHECK_EQUAL(1, remaining[0]);
+        CHECK_EQUAL(3, remaining[1]);
+        CHECK_EQUAL(5, remaining[2]);
+
+        // Remove the last, then add back on the end.
+        list.erase(list.front()->m_next->m_next);
+        list.push_back(7);
+        CHECK_EQUAL(7, list.front()->m_next->m_next->m_value);
+
+        list.clear();
+        CHECK(list.is_empty());
+        CHECK(list.front() == nullptr);
+    }
+
+    /**
+     * @brief Microbenchmark, completes every pending job in one pass
+     *        the way IOService does with SafeVector and the JobList.
+     */
+    TEST(BenchmarkPendingJobs)
+    {
+        const int pending[] = { 1000, 10000 };
+        for (int jobs : pending)
+        {
+            std::shared_ptr<int> job(new int(0));
+
+            SafeVector<std::shared_ptr<int>> safe_vector;
+            for (int i = 0; i < jobs; i++)
+            {
+                safe_vector.push_back(job);
+            }
+
+            auto start = std::chrono::steady_clock::now();
+            for (unsigned int i = 0; i < safe_vector.size(); i++)
+            {
+                std::shared_ptr<int> work = safe_vector.get(i);
+                safe_vector.remove(i);
+                --i;
+            }
+            auto vector_time = std::chrono::steady_clock::now() - start;
+
+            JobQueue<std::shared_ptr<int>> queue;
+            JobList<std::shared_ptr<int>> list;
+            for (int i = 0; i < jobs; i++)
+            {
+                queue.push(job);
+            }
+
+            start = std::chrono::steady_clock::now();
+            JobList<std::shared_ptr<int>>::Node *submitted;
+            while ((submitted = queue.pop_node()) != nullptr)
+            {
+                list.push_back(submitted);
+            }
+            JobList<std::shared_ptr<int>>::Node *node = list.front();
+            while (node != nullptr)
+            {
+                std::shared_ptr<int> work = node->m_value;
+                node = list.erase(node);
+            }
+            auto list_time = std::chrono::steady_clock::now() - start;
+
+            std::cout << "Pending Jobs: " << jobs
+                      << " SafeVector: "
+                      << std::chrono::duration_cast<std::chrono::microseconds>(vector_time).count() << "us"
+                      << " JobQueue/JobList: "
+                      << std::chrono::duration_cast<std::chrono::microseconds>(list_time).count() << "us"
+                      << std::endl;
+
+            CHECK(safe_vector.is_empty());
+            CHECK(list.is_empty());
+            CHECK_EQUAL(1, job.use_count());
+        }
+    }
+}
@@ -0,0 +1,164 @@
+#include <UnitTest++.h>
+#include "mccp_compressor.hpp"
+#include "socket_handler.hpp"
+
+#include <zlib.h>
+
+#include <iostream>
+#include <string>
+#include <cstring>
+#include <sys/uio.h>
+
+/**
+ * @brief Client side of MCCP2, inflate what the server sent.
+ */
+class MyFixtureMccpClient
+{
+
+public:
+
+    MyFixtureMccpClient()
+        : m_result(Z_OK)
+    {
+        memset(&m_stream, 0, sizeof(m_stream));
+        inflateInit(&m_stream);
+    }
+
+    ~MyFixtureMccpClient()
+    {
+        inflateEnd(&m_stream);
+    }
+
+    /**
+     * @brief Inflate everything received so far.
+     */
+    std::string inflateData(const std::string &data)
+    {
+        std::string output;
+        unsigned char chunk[1024];
+        m_stream.next_in = reinterpret_cast<Bytef *>(const_cast<char *>(data.data()));
+        m_stream.avail_in = static_cast<uInt>(data.size());
+        do
+        {
+            m_stream.next_out = chunk;
+            m_stream.avail_out = sizeof(chunk);
+            m_result = inflate(&m_stream, Z_SYNC_FLUSH);
+            output.append(reinterpret_cast<char *>(chunk), sizeof(chunk) - m_stream.avail_out);
+        }
+        while (m_stream.avail_out == 0 && m_result == Z_OK);
+        return output;
+    }
+
+    z_stream m_stream;
+    int      m_result;
+};
+
+
+/**
+ * @brief Unit Testing for MCCP2 Output Compression.
+ * @return
+ */
+SUITE(XRMMccpCompressor)
+{
+
+    // Each flushed batch inflates on it's own, counters follow both sides.
+    TEST_FIXTURE(MyFixtureMccpClient, BatchesInflateAfterFlush)
+    {
+        MccpCompressor compressor;
+        CHECK(compressor.init(6));
+
+        std::string screen;
+        for (int i = 0; i < 40; i++)
+        {
+            screen += "\x1b[1;44m|07 Menu Option |15[|11A|15] |07Lightbar Redraw\r\n";
+        }
+
+        std::string sent;
+        compressor.compress(screen, sent);
+        CHECK(compressor.flush(sent));
+        CHECK_EQUAL(screen, inflateData(sent));
+
+        // Nothing new, nothing to flush.
+        std::string empty;
+        CHECK(!compressor.flush(empty));
+        CHECK(empty.empty());
+
+        std::string second;
+        compressor.compress("Second batch", second);
+        CHECK(compressor.flush(second));
+        CHECK_EQUAL(std::string("Second batch"), inflateData(second));
+
+        CHECK_EQUAL(screen.size() + 12, compressor.getBytesIn());
+        CHECK_EQUAL(sent.size() + second.size(), compressor.getBytesOut());
+        CHECK(compressor.getBytesOut() < compressor.getBytesIn() / 4);
+
+        // The end of stream closes the client's inflate.
+        std::string finish;
+        compressor.finish(finish);
+        inflateData(finish);
+        CHECK_EQUAL(Z_STREAM_END, m_result);
+        CHECK(!compressor.isActive());
+    }
+
+    // Queued output is deflated, the send gathers a flushed batch.
+    TEST_FIXTURE(MyFixtureMccpClient, SocketQueueCompressesOutput)
+    {
+        SocketHandler socket_handler;
+
+        mccp_compressor_ptr compressor(new MccpCompressor());
+        CHECK(compressor->init(9));
+        CHECK(socket_handler.startCompression(compressor, std::string("\xff\xfa\x56\xff\xf0", 5)));
+        CHECK(socket_handler.isCompressing());
+
+        std::string text = "Welcome to the board, Welcome to the board, Welcome to the board.";
+        socket_handler.queueOutput(text);
+        socket_handler.queueOutput(text);
+
+        struct iovec iov[8];
+        int count = socket_handler.gatherOutput(iov, 8);
+        CHECK(count >= 2);
+
+        // The start sequence goes out as is, the rest is compressed.
+        CHECK_EQUAL(5u, iov[0].iov_len);
+        std::string compressed;
+        for (int i = 1; i < count; i++)
+        {
+            compressed.append(reinterpret_cast<char *>(iov[i].iov_base), iov[i].iov_len);
+        }
+        CHECK_EQUAL(text + text, inflateData(compressed));
+        CHECK_EQUAL(text.size() * 2, socket_handler.getBytesBeforeCompression());
+        CHECK_EQUAL(compressed.size(), socket_handler.getBytesAfterCompression());
+
+        // Client said DONT, the stream is ended and output goes out plain.
+        socket_handler.stopCompression();
+        CHECK(!socket_handler.isCompressing());
+        socket_handler.completeOutput(5 + compressed.size());
+        socket_handler.queueOutput(std::string("plain"));
+
+        count = socket_handler.gatherOutput(iov, 8);
+        CHECK_EQUAL(2, count);
+        inflateData(std::string(reinterpret_cast<char *>(iov[0].iov_base), iov[0].iov_len));
+        CHECK_EQUAL(Z_STREAM_END, m_result);
+        CHECK_EQUAL(std::string("plain"), std::string(reinterpret_cast<char *>(iov[1].iov_base), iov[1].iov_len));
+    }
+
+    // A throttled socket still gets the start sequence ahead of the stream.
+    TEST_FIXTURE(MyFixtureMccpClient, SocketStartSequenceSentWhileThrottled)
+    {
+        SocketHandler socket_handler;
+        socket_handler.setOutputWatermarks(8, 0);
+        CHECK(socket_handler.queueOutput(std::string("backed up text")));
+        CHECK(socket_handler.isOutputThrottled());
+
+        mccp_compressor_ptr compressor(new MccpCompressor());
+        CHECK(compressor->init(9));
+        CHECK(!socket_handler.startCompression(compressor, std::string("\xff\xfa\x56\xff\xf0", 5)));
+        CHECK(socket_handler.isCompressing());
+
+        struct iovec iov[8];
+        int count = socket_handler.gatherOutput(iov, 8);
+        CHECK(count >= 2);
+        CHECK_EQUAL(std::string("\xff\xfa\x56\xff\xf0", 5),
+                    std::string(reinterpret_cast<char *>(iov[1].iov_base), iov[1].iov_len));
+    }
+}
@@ -0,0 +1,64 @@
+#include <UnitTest++.h>
+#include "node_allocator.hpp"
+
+#include <iostream>
+#include <string>
+
+/**
+ * @brief Unit Testing for Node Number Allocation.
+ * @return
+ */
+SUITE(XRMNodeAllocator)
+{
+
+    // Nodes start at 1 and always hand out the lowest free number.
+    TEST(LowestFreeNodeFirst)
+    {
+        NodeAllocator allocator;
+        CHECK_EQUAL(1, allocator.acquire());
+        CHECK_EQUAL(2, allocator.acquire());
+        CHECK_EQUAL(3, allocator.acquire());
+        CHECK_EQUAL(3, allocator.getInUseCount());
+
+        CHECK(allocator.release(2));
+        CHECK(!allocator.isInUse(2));
+        CHECK_EQUAL(2, allocator.acquire());
+        CHECK_EQUAL(4, allocator.acquire());
+
+        // Unknown and double releases are ignored.
+        CHECK(!allocator.release(0));
+        CHECK(!allocator.release(99));
+        CHECK(allocator.release(4));
+        CHECK(!allocator.release(4));
+        CHECK_EQUAL(3, allocator.getInUseCount());
+    }
+
+    // Crosses word and summary boundaries, 64 and 4096 nodes.
+    TEST(GrowsPastWordBoundaries)
+    {
+        NodeAllocator allocator;
+        for (int node = 1; node <= 5000; node++)
+        {
+            CHECK_EQUAL(node, allocator.acquire());
+        }
+        CHECK_EQUAL(5000, allocator.getInUseCount());
+
+        CHECK(allocator.release(64));
+        CHECK(allocator.release(65));
+        CHECK(allocator.release(4097));
+        CHECK(allocator.release(4500));
+
+        CHECK_EQUAL(64, allocator.acquire());
+        CHECK_EQUAL(65, allocator.acquire());
+        CHECK_EQUAL(4097, allocator.acquire());
+        CHECK_EQUAL(4500, allocator.acquire());
+        CHECK_EQUAL(5001, allocator.acquire());
+
+        for (int node = 1; node <= 5001; node++)
+        {
+            CHECK(allocator.release(node));
+        }
+        CHECK_EQUAL(0, allocator.getInUseCount());
+        CHECK_EQUAL(1, allocator.acquire());
+    }
+}
@@ -81,6 +81,9 @@ SUITE(XRMOnelinersDao)
         CHECK(lastInsertId == 1);
         CHECK(InsertId2nd == 2);
 
+        // Typed Inserts are one statement, reused with new bindings.
+        CHECK(m_database.getPoolStats().statement_hits >= 1);
+
         // Check Retrieve
         oneliner_ptr objOut(new Oneliners());
         objOut = objdb->getRecordById(lastInsertId);
@@ -166,4 +169,61 @@ SUITE(XRMOnelinersDao)
         CHECK(!objdb->doesTableExist());
     }
 
+    // Test Streaming Rows with Offset and Keyset Pages.
+    TEST_FIXTURE(MyFixtureOneLiners, OnelinersDaoStreaming)
+    {
+        oneliner_dao_ptr objdb(new OnelinerDao(m_database));
+        CHECK(objdb->createTable());
+
+        for (int i = 1; i <= 5; i++)
+        {
+            oneliner_ptr objIn(new Oneliners());
+            objIn->iUserId = (i % 2) + 1;
+            objIn->sText = "One Liner Text " + std::to_string(i);
+            CHECK(objdb->insertRecord(objIn) == i);
+        }
+
+        // Offset Page
+        std::vector<long> ids;
+        long visited = objdb->baseStreamRecordsPage("ORDER BY iId", nullptr, 2, 2, [&ids](oneliner_ptr obj)
+        {
+            ids.push_back(obj->iId);
+            return true;
+        });
+
+        CHECK(visited == 2);
+        CHECK(ids.size() == 2 && ids[0] == 3 && ids[1] == 4);
+
+        // Keyset Page after the last Id seen.
+        ids.clear();
+        objdb->baseStreamRecordsAfterId(4, 10, [&ids](oneliner_ptr obj)
+        {
+            ids.push_back(obj->iId);
+            return true;
+        });
+
+        CHECK(ids.size() == 1 && ids[0] == 5);
+
+        // Visitor stops early, filtered by a bound clause.
+        visited = objdb->baseStreamRecords("WHERE iUserId = ? ORDER BY iId", [](query_ptr qry)
+        {
+            return qry->bind(1, 2);
+        },
+        [](oneliner_ptr obj)
+        {
+            CHECK(obj->sText == "One Liner Text 1");
+            return false;
+        });
+
+        CHECK(visited == 1);
+
+        // Counts without reading the rows.
+        CHECK(objdb->baseCountRecords("WHERE iUserId = ?", [](query_ptr qry)
+        {
+            return qry->bind(1, 2);
+        }) == 3);
+
+        CHECK(objdb->getRecordsCount() == 5);
+        CHECK(objdb->getAllRecords().size() == 5);
+    }
 }
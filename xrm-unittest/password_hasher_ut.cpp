@@ -0,0 +1,134 @@
+#include <UnitTest++.h>
+#include "password_hasher.hpp"
+#include "encryption.hpp"
+#include "io_service.hpp"
+#include "async_completion_ut.hpp"
+
+#include <iostream>
+#include <string>
+#include <thread>
+#include <chrono>
+
+/**
+ * @brief Unit Testing for Password Hashing and Verification Workers.
+ * @return
+ */
+SUITE(XRMPasswordHasher)
+{
+
+    // Table based hex matches the previous stream formatting.
+    TEST(HexEncoding)
+    {
+        Encrypt encryption;
+        CHECK_EQUAL(std::string("00"), encryption.unsignedToHex(0x00));
+        CHECK_EQUAL(std::string("0f"), encryption.unsignedToHex(0x0f));
+        CHECK_EQUAL(std::string("a5"), encryption.unsignedToHex(0xa5));
+
+        const unsigned char data[] = { 0x01, 0xff, 0x7e };
+        CHECK_EQUAL(std::string("01ff7e"), Encrypt::bytesToHex(data, sizeof(data)));
+
+        // SHA1 of hex("salt") + "key".
+        CHECK_EQUAL(std::string("b9efb6e2f01364124c9cde7166159d1249f60572"), encryption.generate_salt("key", "salt"));
+    }
+
+    // Hashes stored before the work factor was configurable still verify.
+    TEST(LegacyHashesVerify)
+    {
+        Encrypt encryption;
+        std::string salt = "salt";
+        std::string legacy = encryption.PKCS5_PBKDF2("password", salt);
+
+        CHECK_EQUAL(std::string("d8f75cb8ec57c1ba25a0c6d1900eed8848a0e5e71dbf539b3d1b4684a9c582c4"
+                                "c6922df8dcf5a42f9d58d86bda46d5bc008fa105625aac3acd6e52f4765a06be"), legacy);
+        CHECK_EQUAL(legacy, encryption.generate_password("password", salt));
+        CHECK_EQUAL(1000, Encrypt::hash_iterations(legacy));
+        CHECK(encryption.verify_password("password", salt, legacy));
+        CHECK(!encryption.verify_password("Password", salt, legacy));
+    }
+
+    // New hashes carry their iterations, so the config can change later.
+    TEST(IterationsStoredWithHash)
+    {
+        Encrypt encryption;
+        std::string salt = encryption.generate_salt("sysop", "uuid");
+        std::string hash = encryption.generate_password("password", salt, 2000);
+
+        CHECK_EQUAL(0u, hash.find(Encrypt::PBKDF2_PREFIX));
+        CHECK_EQUAL(2000, Encrypt::hash_iterations(hash));
+        CHECK(hash != encryption.generate_password("password", salt));
+        CHECK(encryption.verify_password("password", salt, hash));
+        CHECK(!encryption.verify_password("wrong", salt, hash));
+
+        // Malformed work factors are rejected, not hashed with zero rounds.
+        CHECK_EQUAL(0, Encrypt::hash_iterations(Encrypt::PBKDF2_PREFIX + "abc$00"));
+        CHECK(!encryption.verify_password("password", salt, Encrypt::PBKDF2_PREFIX + "$00"));
+    }
+
+    // Verified on a worker, the callback runs from the IOService timers.
+    TEST(VerifyAsyncCompletesOnIOService)
+    {
+        IOService io_service;
+        PasswordHasher hasher(2);
+        hasher.start();
+
+        Encrypt encryption;
+        std::string salt = encryption.generate_salt("sysop", "uuid");
+        std::string hash = encryption.generate_password("password", salt, 2000);
+
+        std::thread::id caller = std::this_thread::get_id();
+        std::thread::id callback_thread;
+        bool is_done = false;
+        bool is_valid = false;
+
+        PasswordHasher::verify_request_ptr request = hasher.verifyAsync(io_service, "password", salt, hash,
+            [&](bool valid)
+        {
+            callback_thread = std::this_thread::get_id();
+            is_valid = valid;
+            is_done = true;
+        });
+
+        CHECK(waitForCallback(io_service, is_done));
+        CHECK(is_valid);
+        CHECK(callback_thread == caller);
+
+        is_done = false;
+        request = hasher.verifyAsync(io_service, "wrong", salt, hash, [&](bool valid)
+        {
+            is_valid = valid;
+            is_done = true;
+        });
+
+        CHECK(waitForCallback(io_service, is_done));
+        CHECK(!is_valid);
+        hasher.shutdown();
+    }
+
+    // Cancelled requests never call back, the requester may be gone.
+    TEST(CancelledRequestSkipsCallback)
+    {
+        IOService io_service;
+        PasswordHasher hasher(1);
+        hasher.start();
+
+        Encrypt encryption;
+        std::string salt = encryption.generate_salt("sysop", "uuid");
+        std::string hash = encryption.generate_password("password", salt);
+
+        bool is_called = false;
+        PasswordHasher::verify_request_ptr request = hasher.verifyAsync(io_service, "password", salt, hash,
+            [&](bool)
+        {
+            is_called = true;
+        });
+        request->cancel();
+
+        // Give the worker time to finish and post.
+        while (hasher.getPendingCount() > 0)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        CHECK(!waitForCallback(io_service, is_called, 50));
+        hasher.shutdown();
+    }
+}
@@ -0,0 +1,219 @@
+#include "data-sys/session_stats_dao.hpp"
+#include "data-sys/session_stats_daily_dao.hpp"
+#include "model-sys/session_stats.hpp"
+#include "model-sys/session_stats_daily.hpp"
+
+#include <UnitTest++.h>
+#include "libSqliteWrapped.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <ctime>
+
+/**
+ * Handle Setup and Tear Down of Integration Test for SQLite
+ */
+class MyFixtureSessionStats
+{
+
+public:
+
+    MyFixtureSessionStats()
+        : m_database("xrm_itSessionStatsTest.sqlite3")
+    {
+        // Before Each Test, we need to remove existing database.
+        std::cout << "xrm_itSessionStatsTest.sqlite3" << std::endl;
+        remove("xrm_itSessionStatsTest.sqlite3");
+    }
+
+    ~MyFixtureSessionStats()
+    { }
+
+    /**
+     * @brief Local Noon, days back from today.
+     */
+    std::time_t getNoon(int days_back)
+    {
+        std::time_t now = std::time(nullptr);
+        std::tm day = *std::localtime(&now);
+        day.tm_mday -= days_back;
+        day.tm_hour = 12;
+        day.tm_min = 0;
+        day.tm_sec = 0;
+        day.tm_isdst = -1;
+        return std::mktime(&day);
+    }
+
+    /**
+     * @brief Query Plan Details joined together.
+     */
+    std::string getQueryPlan(const std::string &query)
+    {
+        std::string plan;
+        SQLW::Query qry(m_database);
+        if (qry.getResult("EXPLAIN QUERY PLAN " + query))
+        {
+            while (qry.fetchRow())
+            {
+                plan += std::string(qry.getString("detail")) + "; ";
+            }
+            qry.freeResult();
+        }
+        return plan;
+    }
+
+    SQLW::Database m_database;
+};
+
+
+/**
+ * @brief Unit Testing for Session Stats Ranges and Daily Rollups.
+ * @return
+ */
+SUITE(XRMSessionStatsDao)
+{
+
+    // Inserts and Updates are rolled into their day by the triggers.
+    TEST_FIXTURE(MyFixtureSessionStats, DailyRollupMaintained)
+    {
+        SessionStatsDao session_stats_dao(m_database);
+        CHECK(session_stats_dao.createTable());
+
+        // Sessions before the rollup exists are backfilled.
+        session_stats_ptr old_stat(new SessionStats());
+        old_stat->dtStartDate = getNoon(2);
+        old_stat->bLogonSuccess = true;
+        old_stat->iMsgPost = 3;
+        CHECK(session_stats_dao.insertRecord(old_stat) > 0);
+
+        SessionStatsDailyDao daily_dao(m_database);
+        CHECK(daily_dao.createTable());
+        CHECK(daily_dao.doesTableExist());
+
+        session_stats_ptr stat(new SessionStats());
+        stat->dtStartDate = getNoon(0);
+        long id = session_stats_dao.insertRecord(stat);
+        CHECK(id > 0);
+
+        session_stats_ptr failed(new SessionStats());
+        failed->dtStartDate = getNoon(0);
+        CHECK(session_stats_dao.insertRecord(failed) > 0);
+
+        // Logon and transfers are added as a delta.
+        stat->iId = id;
+        stat->bLogonSuccess = true;
+        stat->iFilesUl = 2;
+        stat->iFilesDlMb = 10;
+        stat->iMsgRead = 5;
+        CHECK(session_stats_dao.updateRecord(stat));
+
+        stat->iFilesUl = 3;
+        CHECK(session_stats_dao.updateRecord(stat));
+
+        session_stats_daily_ptr today = daily_dao.getTodaysStats();
+        CHECK_EQUAL(SessionStatsDailyDao::getDayString(std::time(nullptr)), today->sDay);
+        CHECK_EQUAL(2, today->iCalls);
+        CHECK_EQUAL(1, today->iLogons);
+        CHECK_EQUAL(3, today->iFilesUl);
+        CHECK_EQUAL(10, today->iFilesDlMb);
+        CHECK_EQUAL(5, today->iMsgRead);
+
+        session_stats_daily_ptr older = daily_dao.getDailyStats(SessionStatsDailyDao::getDayString(getNoon(2)));
+        CHECK_EQUAL(1, older->iCalls);
+        CHECK_EQUAL(1, older->iLogons);
+        CHECK_EQUAL(3, older->iMsgPost);
+
+        // No Sessions, all zeros.
+        session_stats_daily_ptr empty = daily_dao.getDailyStats(SessionStatsDailyDao::getDayString(getNoon(1)));
+        CHECK_EQUAL(0, empty->iCalls);
+
+        std::vector<session_stats_daily_ptr> range =
+            daily_dao.getDailyStatsRange(SessionStatsDailyDao::getDayString(getNoon(7)),
+                                         SessionStatsDailyDao::getDayString(getNoon(0)));
+        CHECK_EQUAL(2u, range.size());
+        if (range.size() == 2)
+        {
+            CHECK_EQUAL(older->sDay, range[0]->sDay);
+            CHECK_EQUAL(today->sDay, range[1]->sDay);
+        }
+
+        // Deleted Sessions come back out.
+        CHECK(session_stats_dao.deleteRecord(id));
+        today = daily_dao.getTodaysStats();
+        CHECK_EQUAL(1, today->iCalls);
+        CHECK_EQUAL(0, today->iLogons);
+        CHECK_EQUAL(0, today->iFilesUl);
+    }
+
+    // Today's callers and the Caller Log use the indexes, not a table scan.
+    TEST_FIXTURE(MyFixtureSessionStats, CallerQueriesUseIndexes)
+    {
+        SessionStatsDao session_stats_dao(m_database);
+        CHECK(session_stats_dao.createTable());
+
+        for (int i = 0; i < 4; i++)
+        {
+            session_stats_ptr stat(new SessionStats());
+            stat->dtStartDate = getNoon(i);
+            stat->bLogonSuccess = (i != 1);
+            CHECK(session_stats_dao.insertRecord(stat) > 0);
+        }
+
+        std::vector<session_stats_ptr> todays = session_stats_dao.getTodaysCallerStats();
+        CHECK_EQUAL(1u, todays.size());
+
+        std::vector<session_stats_ptr> last = session_stats_dao.getLast10CallerStats();
+        CHECK_EQUAL(3u, last.size());
+        if (last.size() == 3)
+        {
+            CHECK_EQUAL(getNoon(0), last[0]->dtStartDate);
+            CHECK_EQUAL(getNoon(3), last[2]->dtStartDate);
+        }
+
+        std::string plan = getQueryPlan(
+            "SELECT * FROM sessionstats WHERE dtStartDate >= 1 AND dtStartDate < 2 "
+            "ORDER BY dtStartDate DESC, iId DESC;");
+        CHECK(plan.find("session_stats_start_idx") != std::string::npos);
+        CHECK(plan.find("TEMP B-TREE") == std::string::npos);
+
+        plan = getQueryPlan(
+            "SELECT * FROM sessionstats WHERE bLogonSuccess = 1 "
+            "ORDER BY dtStartDate DESC, iId DESC LIMIT 10;");
+        CHECK(plan.find("session_stats_logon_idx") != std::string::npos);
+        CHECK(plan.find("TEMP B-TREE") == std::string::npos);
+    }
+
+    // Tables from before iNegotiationMs pick up the column on startup.
+    TEST_FIXTURE(MyFixtureSessionStats, NegotiationTimeAddedToOlderTables)
+    {
+        SQLW::Query qry(m_database);
+        CHECK(qry.execute(
+            "CREATE TABLE sessionstats ( "
+            "iId INTEGER PRIMARY KEY, iUserId INTEGER NOT NULL, "
+            "sSessionType TEXT NOT NULL, sCodePage TEXT NOT NULL, sTerminal TEXT NOT NULL, "
+            "sIPAddress TEXT NOT NULL, iTermWidth INTEGER NOT NULL, iTermHeight INTEGER NOT NULL, "
+            "dtStartDate DATETIME NOT NULL, dtEndDate DATETIME NOT NULL, "
+            "iInvalidAttempts INTEGER NOT NULL, bNewUser BOOLEAN NOT NULL, "
+            "bLogonSuccess BOOLEAN NOT NULL, bHungup BOOLEAN NOT NULL, "
+            "iMsgRead INTEGER NOT NULL, iMsgPost INTEGER NOT NULL, "
+            "iFilesUl INTEGER NOT NULL, iFilesDl INTEGER NOT NULL, "
+            "iFilesUlMb INTEGER NOT NULL, iFilesDlMb INTEGER NOT NULL );"));
+
+        SessionStatsDao session_stats_dao(m_database);
+        CHECK(session_stats_dao.upgradeTable());
+        CHECK(session_stats_dao.upgradeTable());
+
+        session_stats_ptr stat(new SessionStats());
+        stat->iNegotiationMs = 120;
+        long id = session_stats_dao.insertRecord(stat);
+        CHECK(id > 0);
+
+        session_stats_ptr result = session_stats_dao.getRecordById(id);
+        CHECK(result);
+        if (result)
+        {
+            CHECK_EQUAL(120, result->iNegotiationMs);
+        }
+    }
+}
@@ -0,0 +1,183 @@
+#include <UnitTest++.h>
+#include "stats_writer.hpp"
+
+#include "model-sys/session_stats.hpp"
+#include "model-sys/menu_stats.hpp"
+#include "data-sys/session_stats_dao.hpp"
+#include "data-sys/menu_stats_dao.hpp"
+
+#include "libSqliteWrapped.h"
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <thread>
+#include <chrono>
+
+/**
+ * Handle Setup and Tear Down of the Stats Writer Tests
+ */
+class MyFixtureStatsWriter
+{
+
+public:
+
+    MyFixtureStatsWriter()
+        : m_database("xrm_utStatsWriterTest.sqlite3")
+    {
+        std::cout << "xrm_utStatsWriterTest.sqlite3" << std::endl;
+        remove("xrm_utStatsWriterTest.sqlite3");
+
+        SessionStatsDao session_stats_dao(m_database);
+        session_stats_dao.createTable();
+
+        MenuStatsDao menu_stats_dao(m_database);
+        menu_stats_dao.createTable();
+    }
+
+    ~MyFixtureStatsWriter()
+    { }
+
+    SQLW::Database m_database;
+};
+
+
+/**
+ * @brief Unit Testing for the Write Behind Stats Writer.
+ * @return
+ */
+SUITE(XRMStatsWriter)
+{
+
+    // Session start, update and end land on a single record.
+    TEST_FIXTURE(MyFixtureStatsWriter, SessionLifecycleWritesOneRecord)
+    {
+        StatsWriter writer("xrm_utStatsWriterTest.sqlite3", 10, 4, 100);
+        writer.start();
+
+        session_stats_ptr stats(new SessionStats());
+        stats->sSessionType = "TELNET";
+        stats->dtStartDate = 1000;
+
+        unsigned long key = writer.createSessionKey();
+        CHECK(writer.pushSessionStats(StatsWriter::STATS_SESSION_START, key, stats));
+
+        stats->iUserId = 7;
+        stats->bLogonSuccess = true;
+        CHECK(writer.pushSessionStats(StatsWriter::STATS_SESSION_UPDATE, key, stats));
+
+        stats->dtEndDate = 2000;
+        CHECK(writer.pushSessionStats(StatsWriter::STATS_SESSION_END, key, stats));
+
+        writer.shutdown();
+
+        SessionStatsDao session_stats_dao(m_database);
+        std::vector<session_stats_ptr> records = session_stats_dao.getAllRecords();
+        CHECK_EQUAL(1u, records.size());
+        if (records.size() == 1)
+        {
+            CHECK_EQUAL(std::string("TELNET"), records[0]->sSessionType);
+            CHECK_EQUAL(7, records[0]->iUserId);
+            CHECK(records[0]->bLogonSuccess);
+            CHECK_EQUAL(1000, records[0]->dtStartDate);
+            CHECK_EQUAL(2000, records[0]->dtEndDate);
+        }
+
+        StatsWriter::WriterStats writer_stats = writer.getStats();
+        CHECK_EQUAL(3u, writer_stats.queued);
+        CHECK_EQUAL(3u, writer_stats.written);
+        CHECK_EQUAL(0u, writer_stats.failed);
+        CHECK_EQUAL(0, writer_stats.pending);
+    }
+
+    // Menu events are grouped into batches, nothing is lost on shutdown.
+    TEST_FIXTURE(MyFixtureStatsWriter, MenuStatsBatched)
+    {
+        StatsWriter writer("xrm_utStatsWriterTest.sqlite3", 10000, 8, 100);
+        writer.start();
+
+        for (int i = 0; i < 20; i++)
+        {
+            menu_stats_ptr stats(new MenuStats());
+            stats->sMenuName = "MAIN";
+            stats->sCmdKey = "-^";
+            stats->dtDateTime = 1000 + i;
+            CHECK(writer.pushMenuStats(stats));
+        }
+
+        writer.shutdown();
+
+        MenuStatsDao menu_stats_dao(m_database);
+        CHECK_EQUAL(20, menu_stats_dao.getRecordsCount());
+
+        StatsWriter::WriterStats writer_stats = writer.getStats();
+        CHECK_EQUAL(20u, writer_stats.written);
+        CHECK(writer_stats.batches >= 3u);
+        CHECK(writer_stats.batches < 20u);
+    }
+
+    // A full queue drops new events instead of blocking.
+    TEST_FIXTURE(MyFixtureStatsWriter, FullQueueDrops)
+    {
+        // Not started, nothing is drained till shutdown.
+        StatsWriter writer("xrm_utStatsWriterTest.sqlite3", 10000, 100, 5);
+
+        int accepted = 0;
+        for (int i = 0; i < 8; i++)
+        {
+            menu_stats_ptr stats(new MenuStats());
+            stats->sMenuName = "MAIN";
+            stats->sCmdKey = "G";
+            if (writer.pushMenuStats(stats))
+            {
+                ++accepted;
+            }
+        }
+        CHECK_EQUAL(5, accepted);
+
+        writer.shutdown();
+
+        menu_stats_ptr stats(new MenuStats());
+        CHECK(!writer.pushMenuStats(stats));
+
+        MenuStatsDao menu_stats_dao(m_database);
+        CHECK_EQUAL(5, menu_stats_dao.getRecordsCount());
+
+        StatsWriter::WriterStats writer_stats = writer.getStats();
+        CHECK_EQUAL(5u, writer_stats.written);
+        CHECK_EQUAL(4u, writer_stats.dropped);
+    }
+
+    // A batch written while another connection holds the write lock waits for it.
+    TEST_FIXTURE(MyFixtureStatsWriter, BatchWaitsForOtherWriter)
+    {
+        m_database.setConnectionPragmas(SQLW::Database::POOL_PRAGMAS);
+        SQLW::Query qry(m_database);
+        CHECK(qry.execute("BEGIN IMMEDIATE;"));
+
+        StatsWriter writer("xrm_utStatsWriterTest.sqlite3", 10, 4, 100);
+        writer.start();
+
+        for (int i = 0; i < 4; i++)
+        {
+            menu_stats_ptr stats(new MenuStats());
+            stats->sMenuName = "MAIN";
+            stats->sCmdKey = "G";
+            CHECK(writer.pushMenuStats(stats));
+        }
+
+        // Let the writer run into the lock before it's released.
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        CHECK(qry.execute("COMMIT;"));
+
+        writer.shutdown();
+
+        MenuStatsDao menu_stats_dao(m_database);
+        CHECK_EQUAL(4, menu_stats_dao.getRecordsCount());
+
+        StatsWriter::WriterStats writer_stats = writer.getStats();
+        CHECK_EQUAL(4u, writer_stats.written);
+        CHECK_EQUAL(0u, writer_stats.failed);
+    }
+}
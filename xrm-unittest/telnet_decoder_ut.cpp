@@ -0,0 +1,307 @@
+#include <UnitTest++.h>
+#include "telnet_decoder.hpp"
+#include "telnet.hpp"
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <random>
+
+/**
+ * @brief Reference, the per byte parse handleTeloptCodes used before decode(),
+ *        with the NVT rule applied a byte at a time, CR LF and CR NUL become CR.
+ * @param decoder
+ * @param data
+ * @return
+ */
+static std::string parsePerByte(TelnetDecoder &decoder, const std::vector<unsigned char> &data)
+{
+    std::string output;
+    bool is_cr_pending = false;
+    for(auto c : data)
+    {
+        if(is_cr_pending && (c == '\n' || c == '\0'))
+        {
+            is_cr_pending = false;
+            continue;
+        }
+        is_cr_pending = false;
+
+        unsigned char ch = decoder.telnetOptionParse(c);
+        if(ch == '\0')
+        {
+            continue;
+        }
+        is_cr_pending = (ch == '\r');
+        output += ch;
+    }
+    return output;
+}
+
+/**
+ * @brief Bulk decode, split into random sized reads like the socket would.
+ * @param decoder
+ * @param data
+ * @param generator
+ * @return
+ */
+static std::string decodeChunked(TelnetDecoder &decoder, const std::vector<unsigned char> &data,
+                                 std::mt19937 &generator)
+{
+    std::string output;
+    std::uniform_int_distribution<size_t> chunk_size(1, 64);
+    size_t offset = 0;
+    while(offset < data.size())
+    {
+        size_t length = std::min(chunk_size(generator), data.size() - offset);
+        decoder.decode(data.data() + offset, length, output);
+        offset += length;
+    }
+    return output;
+}
+
+/**
+ * @brief Both parsers must agree on the text and on the negotiated terminal.
+ * @param data
+ * @param generator
+ */
+static void checkIdentical(const std::vector<unsigned char> &data, std::mt19937 &generator)
+{
+    TelnetDecoder reference(nullptr);
+    TelnetDecoder bulk(nullptr);
+
+    std::string expected = parsePerByte(reference, data);
+    std::string actual = decodeChunked(bulk, data, generator);
+
+    CHECK_EQUAL(expected.size(), actual.size());
+    CHECK(expected == actual);
+    CHECK_EQUAL(reference.getTermType(), bulk.getTermType());
+    CHECK_EQUAL(reference.getTermRows(), bulk.getTermRows());
+    CHECK_EQUAL(reference.getTermCols(), bulk.getTermCols());
+}
+
+
+/**
+ * @brief Unit Testing for the Bulk Telnet Decoder.
+ * @return
+ */
+SUITE(XRMTelnetDecoder)
+{
+
+    // Plain text longer than a vector block comes through untouched.
+    TEST(PlainTextPassesThrough)
+    {
+        TelnetDecoder decoder(nullptr);
+        std::string text = "The quick brown fox jumps over the lazy dog, 0123456789.\n";
+        std::string output;
+        decoder.decode(reinterpret_cast<const unsigned char *>(text.data()), text.size(), output);
+        CHECK_EQUAL(text, output);
+
+        // Nulls are dropped wherever they fall in the block.
+        const unsigned char data[] = { 'a', '\0', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i',
+                                       'j', 'k', 'l', 'm', 'n', 'o', 'p', '\0', 'q'
+                                     };
+        output.clear();
+        decoder.decode(data, sizeof(data), output);
+        CHECK_EQUAL(std::string("abcdefghijklmnopq"), output);
+    }
+
+    // NVT line endings, a split CR LF is still one ENTER.
+    TEST(LineEndingsAcrossReads)
+    {
+        TelnetDecoder decoder(nullptr);
+        std::string output;
+
+        const unsigned char first[] = { 'y', 'e', 's', '\r' };
+        const unsigned char second[] = { '\n', 'n', 'o', '\r', '\0', 'a', '\r', 'b', '\n', '\r', '\r', '\n' };
+        decoder.decode(first, sizeof(first), output);
+        CHECK_EQUAL(std::string("yes\r"), output);
+        decoder.decode(second, sizeof(second), output);
+        CHECK_EQUAL(std::string("yes\rno\ra\rb\n\r\r"), output);
+
+        // Bytes inside a sub-negotiation are left alone.
+        std::vector<unsigned char> naws = { '\r', IAC, SB, TELOPT_NAWS, 0, 13, 0, 10, IAC, SE, '\n' };
+        output.clear();
+        decoder.decode(naws.data(), naws.size(), output);
+        CHECK_EQUAL(std::string("\r\n"), output);
+        CHECK_EQUAL(13, decoder.getTermCols());
+        CHECK_EQUAL(10, decoder.getTermRows());
+    }
+
+    // Options are parsed out and the text either side is kept.
+    TEST(OptionsParsedOutOfText)
+    {
+        std::vector<unsigned char> data = { 'h', 'e', 'l', 'l', 'o',
+                                            IAC, SB, TELOPT_NAWS, 0, 132, 0, 50, IAC, SE,
+                                            IAC, SB, TELOPT_TTYPE, TELQUAL_IS, 'a', 'n', 's', 'i', IAC, SE,
+                                            IAC, NOP, 'w', 'o', 'r', 'l', 'd'
+                                          };
+
+        TelnetDecoder decoder(nullptr);
+        std::string output;
+        decoder.decode(data.data(), data.size(), output);
+        CHECK_EQUAL(std::string("helloworld"), output);
+        CHECK_EQUAL(132, decoder.getTermCols());
+        CHECK_EQUAL(50, decoder.getTermRows());
+
+        std::mt19937 generator(21);
+        checkIdentical(data, generator);
+    }
+
+    // Crafted negotiation streams split at every possible read size.
+    TEST(CraftedStreamsMatchPerByteParser)
+    {
+        std::mt19937 generator(2015);
+        std::vector<std::vector<unsigned char>> streams =
+        {
+            { IAC, WILL, TELOPT_TTYPE, IAC, DO, TELOPT_ECHO, 'x', IAC, IAC, 'y' },
+            { IAC, DONT, TELOPT_BINARY, IAC, WONT, TELOPT_SGA, '\0', '\r', '\0', '\n' },
+            { 'l', 'i', 'n', 'e', '\r', '\n', '\r', '\r', '\n', '\r', '\0', '\n', '\r', IAC, NOP, '\n' },
+            { IAC, SB, TELOPT_TTYPE, TELQUAL_IS, 'x', 't', 'e', 'r', 'm', IAC, SE, 'o', 'k' },
+            { IAC, SB, TELOPT_NAWS, 0, 80, 0, 25, IAC, SE, IAC, GA, IAC, AYT, 'z' },
+            { IAC, SB, TELOPT_NEW_ENVIRON, TELQUAL_IS, NEW_ENV_VAR, 'U', 'S', 'E', 'R', IAC, SE, '!' }
+        };
+
+        for(auto &stream : streams)
+        {
+            for(int i = 0; i < 16; i++)
+            {
+                checkIdentical(stream, generator);
+            }
+        }
+    }
+
+    // Random data weighted toward IAC, commands, nulls and line endings.
+    TEST(RandomStreamsMatchPerByteParser)
+    {
+        std::mt19937 generator(1500);
+        std::uniform_int_distribution<int> pick(0, 15);
+        std::uniform_int_distribution<int> byte(0, 255);
+        const unsigned char specials[] = { IAC, SB, SE, WILL, WONT, DO, DONT, '\0', '\r', '\n',
+                                           TELOPT_TTYPE, TELOPT_NAWS, TELOPT_BINARY, TELQUAL_IS
+                                         };
+
+        for(int round = 0; round < 50; round++)
+        {
+            std::vector<unsigned char> data;
+            for(int i = 0; i < 512; i++)
+            {
+                int choice = pick(generator);
+                if(choice < 4)
+                {
+                    data.push_back(specials[byte(generator) % sizeof(specials)]);
+                }
+                else
+                {
+                    data.push_back(static_cast<unsigned char>(byte(generator)));
+                }
+            }
+            checkIdentical(data, generator);
+        }
+    }
+
+    // Output without 0xFF is sent as is, otherwise each IAC is doubled.
+    TEST(EscapeIACOnOutput)
+    {
+        std::string output = "untouched";
+        CHECK(!TelnetDecoder::escapeIAC("Plain CP437 text \xb0\xb1\xb2\xdb without the last code", output));
+        CHECK_EQUAL(std::string("untouched"), output);
+
+        std::string data = "\xff" "0123456789abcdef" "\xff\xff" "ghijklmnopqrstuvwxyz" "\xff";
+        CHECK(TelnetDecoder::escapeIAC(data, output));
+        CHECK_EQUAL(std::string("\xff\xff" "0123456789abcdef" "\xff\xff\xff\xff" "ghijklmnopqrstuvwxyz" "\xff\xff"), output);
+    }
+
+    // Escaped output decodes back to the same bytes once Binary is negotiated.
+    TEST(EscapedOutputRoundTrips)
+    {
+        TelnetDecoder decoder(nullptr);
+        decoder.addReply(TELOPT_BINARY);
+        const unsigned char negotiate[] = { IAC, DO, TELOPT_BINARY };
+        std::string output;
+        decoder.decode(negotiate, sizeof(negotiate), output);
+        CHECK(decoder.isBinary());
+        CHECK(output.empty());
+
+        std::mt19937 generator(23);
+        std::uniform_int_distribution<int> byte(0, 255);
+        std::string data;
+        for(int i = 0; i < 4096; i++)
+        {
+            // Leave out the bytes the NVT rules change.
+            unsigned char ch = static_cast<unsigned char>(byte(generator));
+            data += (ch == '\0' || ch == '\r') ? static_cast<char>(IAC) : static_cast<char>(ch);
+        }
+
+        std::string escaped;
+        CHECK(TelnetDecoder::escapeIAC(data, escaped));
+        decoder.decode(reinterpret_cast<const unsigned char *>(escaped.data()), escaped.size(), output);
+        CHECK_EQUAL(data.size(), output.size());
+        CHECK(data == output);
+    }
+
+    // Only the reply answered is removed, duplicates are counted.
+    TEST(RepliesRemovedOneAtATime)
+    {
+        TelnetDecoder decoder(nullptr);
+        decoder.addReply(TELOPT_SGA);
+        decoder.addReply(TELOPT_ECHO);
+        decoder.addReply(TELOPT_SGA);
+
+        decoder.deleteReply(TELOPT_BINARY);
+        CHECK(decoder.checkReply(TELOPT_SGA));
+        CHECK(decoder.checkReply(TELOPT_ECHO));
+
+        decoder.deleteReply(TELOPT_ECHO);
+        CHECK(!decoder.checkReply(TELOPT_ECHO));
+        decoder.deleteReply(TELOPT_SGA);
+        CHECK(decoder.checkReply(TELOPT_SGA));
+        decoder.deleteReply(TELOPT_SGA);
+        CHECK(decoder.isNegotiationComplete());
+    }
+
+    // The callback runs once the last reply is answered or refused.
+    TEST(NegotiationCompletesOnLastReply)
+    {
+        TelnetDecoder decoder(nullptr);
+        const unsigned char offered[] = { TELOPT_SGA, TELOPT_ECHO, TELOPT_SGA, TELOPT_BINARY,
+                                          TELOPT_BINARY, TELOPT_TTYPE, TELOPT_NAWS, TELOPT_MCCP_2
+                                        };
+        for(auto option : offered)
+        {
+            decoder.addReply(option);
+        }
+
+        int completed = 0;
+        decoder.setNegotiationCallback([&completed]()
+        {
+            ++completed;
+        });
+
+        const unsigned char replies[] = { IAC, WILL, TELOPT_SGA, IAC, DO, TELOPT_SGA, IAC, DO, TELOPT_ECHO,
+                                          IAC, WILL, TELOPT_BINARY, IAC, DO, TELOPT_BINARY,
+                                          IAC, WILL, TELOPT_TTYPE, IAC, WILL, TELOPT_NAWS,
+                                          IAC, DONT, TELOPT_MCCP_2,
+                                          IAC, SB, TELOPT_NAWS, 0, 80, 0, 25, IAC, SE
+                                        };
+        std::string output;
+        decoder.decode(replies, sizeof(replies), output);
+        CHECK_EQUAL(0, completed);
+        CHECK(!decoder.isNegotiationComplete());
+
+        // TTYPE is answered by the sub-negotiation, not the WILL.
+        const unsigned char ttype[] = { IAC, SB, TELOPT_TTYPE, TELQUAL_IS, 'a', 'n', 's', 'i', IAC, SE };
+        decoder.decode(ttype, sizeof(ttype), output);
+        CHECK_EQUAL(1, completed);
+        CHECK(decoder.isNegotiationComplete());
+        CHECK_EQUAL(std::string("ansi"), decoder.getTermType());
+        CHECK(output.empty());
+
+        // Set once negotiation is already done, runs straight away.
+        decoder.setNegotiationCallback([&completed]()
+        {
+            ++completed;
+        });
+        CHECK_EQUAL(2, completed);
+    }
+}
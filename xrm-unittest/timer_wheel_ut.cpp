@@ -0,0 +1,97 @@
+/**
+ * @brief Oblivion/2 XRM Unit Tests for TimerWheel.
+ * @return
+ */
+
+#include "timer_wheel.hpp"
+
+#include <UnitTest++.h>
+
+// C++ Standard
+#include <iostream>
+#include <string>
+#include <thread>
+#include <chrono>
+
+SUITE(XRMTimerWheel)
+{
+    TEST(ScheduleAndCancel)
+    {
+        TimerWheel wheel;
+        TimerWheel::Entry entry;
+        int fired = 0;
+
+        wheel.schedule(&entry, 1000, [&fired]() { ++fired; });
+        CHECK_EQUAL(1, wheel.size());
+        CHECK(entry.isLinked());
+
+        CHECK(wheel.cancel(&entry));
+        CHECK_EQUAL(0, wheel.size());
+        CHECK(!entry.isLinked());
+
+        // Second Cancel has nothing pending.
+        CHECK(!wheel.cancel(&entry));
+        CHECK_EQUAL(0, fired);
+    }
+
+    TEST(ProcessRunsExpiredTimers)
+    {
+        TimerWheel wheel;
+        TimerWheel::Entry entry;
+        int fired = 0;
+
+        wheel.schedule(&entry, 20, [&fired]() { ++fired; });
+        CHECK_EQUAL(0, wheel.process());
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(40));
+        CHECK_EQUAL(1, wheel.process());
+        CHECK_EQUAL(1, fired);
+        CHECK_EQUAL(0, wheel.size());
+    }
+
+    TEST(RescheduleReplacesPending)
+    {
+        TimerWheel wheel;
+        TimerWheel::Entry entry;
+        int first = 0;
+        int second = 0;
+
+        wheel.schedule(&entry, 10, [&first]() { ++first; });
+        wheel.schedule(&entry, 10, [&second]() { ++second; });
+        CHECK_EQUAL(1, wheel.size());
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(30));
+        wheel.process();
+        CHECK_EQUAL(0, first);
+        CHECK_EQUAL(1, second);
+    }
+
+    TEST(LongTimersStayPending)
+    {
+        TimerWheel wheel;
+        TimerWheel::Entry entry;
+        int fired = 0;
+
+        // Past the root wheel, held on the upper levels.
+        wheel.schedule(&entry, 60000, [&fired]() { ++fired; });
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        CHECK_EQUAL(0, wheel.process());
+        CHECK_EQUAL(1, wheel.size());
+        CHECK(wheel.cancel(&entry));
+    }
+
+    TEST(TimeoutFollowsNextTimer)
+    {
+        TimerWheel wheel;
+        TimerWheel::Entry entry;
+
+        CHECK_EQUAL(250, wheel.getTimeout(250));
+
+        wheel.schedule(&entry, 50, []() { });
+        int timeout = wheel.getTimeout(250);
+        CHECK(timeout > 0 && timeout <= 60);
+
+        wheel.cancel(&entry);
+        CHECK_EQUAL(250, wheel.getTimeout(250));
+    }
+}
@@ -0,0 +1,144 @@
+#include <UnitTest++.h>
+#include "user_directory.hpp"
+
+#include "model-sys/users.hpp"
+#include "data-sys/users_dao.hpp"
+
+#include "libSqliteWrapped.h"
+
+#include <iostream>
+#include <string>
+#include <cstdio>
+
+/**
+ * Handle Setup and Tear Down of the User Directory Tests
+ */
+class MyFixtureUserDirectory
+{
+
+public:
+
+    MyFixtureUserDirectory()
+        : m_database("xrm_utUserDirectoryTest.sqlite3")
+    {
+        std::cout << "xrm_utUserDirectoryTest.sqlite3" << std::endl;
+        remove("xrm_utUserDirectoryTest.sqlite3");
+    }
+
+    ~MyFixtureUserDirectory()
+    {
+        UserDirectory::release(m_database.getDatabaseName());
+    }
+
+    /**
+     * @brief New User with the lookup fields set.
+     */
+    user_ptr createUser(const std::string &handle, const std::string &real_name, const std::string &email)
+    {
+        user_ptr user(new Users());
+        user->sHandle = handle;
+        user->sRealName = real_name;
+        user->sEmail = email;
+        return user;
+    }
+
+    SQLW::Database m_database;
+};
+
+
+/**
+ * @brief Unit Testing for the In Memory User Directory.
+ * @return
+ */
+SUITE(XRMUserDirectory)
+{
+
+    // Keys are folded the same as COLLATE NOCASE.
+    TEST(LookupsIgnoreCase)
+    {
+        UserDirectory directory;
+        user_ptr user(new Users());
+        user->iId = 3;
+        user->sHandle = "Mercyful Fate";
+        user->sRealName = "Michael";
+        user->sEmail = "Merc@Example.com";
+        directory.upsertUser(user);
+
+        CHECK_EQUAL(3, directory.getUserByHandle("MERCYFUL fate")->iId);
+        CHECK_EQUAL(3, directory.getUserByRealName("michael")->iId);
+        CHECK_EQUAL(3, directory.getUserByEmail("merc@example.COM")->iId);
+        CHECK(!directory.getUserByHandle("Mercyful"));
+
+        // Renamed, the old key is gone.
+        user->sHandle = "King Diamond";
+        directory.upsertUser(user);
+        CHECK(!directory.getUserByHandle("mercyful fate"));
+        CHECK_EQUAL(3, directory.getUserByHandle("king diamond")->iId);
+        CHECK_EQUAL(1u, directory.getUserCount());
+
+        // Copies are returned, changes don't leak back in.
+        user_ptr copy = directory.getUserById(3);
+        copy->sHandle = "Changed";
+        CHECK_EQUAL(std::string("King Diamond"), directory.getUserById(3)->sHandle);
+    }
+
+    // Duplicate keys resolve to the lowest Id, like the first row from SQL.
+    TEST(DuplicatesResolveToLowestId)
+    {
+        UserDirectory directory;
+        user_ptr first(new Users());
+        first->iId = 2;
+        first->sEmail = "same@example.com";
+        user_ptr second(new Users());
+        second->iId = 5;
+        second->sEmail = "SAME@example.com";
+
+        directory.upsertUser(second);
+        directory.upsertUser(first);
+        CHECK_EQUAL(2, directory.getUserByEmail("same@example.com")->iId);
+
+        directory.removeUser(2);
+        CHECK_EQUAL(5, directory.getUserByEmail("same@example.com")->iId);
+
+        directory.removeUser(5);
+        CHECK(!directory.getUserByEmail("same@example.com"));
+    }
+
+    // UsersDao keeps a loaded directory current, lookups no longer need the table.
+    TEST_FIXTURE(MyFixtureUserDirectory, UsersDaoKeepsDirectoryCurrent)
+    {
+        UsersDao user_dao(m_database);
+        CHECK(user_dao.createTable());
+
+        long id = user_dao.insertRecord(createUser("Mercyful", "Michael", "merc@example.com"));
+        CHECK(id > 0);
+
+        CHECK(!UserDirectory::find(m_database.getDatabaseName()));
+        user_directory_ptr directory = user_dao.loadUserDirectory();
+        CHECK(directory);
+        CHECK_EQUAL(1u, directory->getUserCount());
+
+        // Insert and Update hooks.
+        long new_id = user_dao.insertRecord(createUser("Tester", "Test User", "test@example.com"));
+        CHECK(new_id > 0);
+        CHECK_EQUAL(new_id, user_dao.getUserByHandle("TESTER")->iId);
+
+        user_ptr user = user_dao.getRecordById(id);
+        user->sEmail = "fate@example.com";
+        CHECK(user_dao.updateRecord(user));
+        CHECK_EQUAL(-1, user_dao.getUserByEmail("merc@example.com")->iId);
+        CHECK_EQUAL(id, user_dao.getUserByEmail("FATE@example.com")->iId);
+
+        // Delete hook.
+        CHECK(user_dao.deleteRecord(new_id));
+        CHECK_EQUAL(-1, user_dao.getUserByRealName("test user")->iId);
+        CHECK_EQUAL(-1, user_dao.getRecordById(new_id)->iId);
+
+        // Answered from memory, even with the table gone.
+        {
+            SQLW::Query qry(m_database);
+            CHECK(qry.execute("DROP TABLE users;"));
+        }
+        CHECK_EQUAL(id, user_dao.getUserByRealName("MICHAEL")->iId);
+    }
+}
@@ -39,8 +39,8 @@ LinkOptions            :=
 IncludePath            :=  $(IncludeSwitch). $(IncludeSwitch). $(IncludeSwitch)../src $(IncludeSwitch)../sqlitewrap $(IncludeSwitch)/usr/include/unittest++ $(IncludeSwitch)/usr/include/UnitTest++ $(IncludeSwitch)../src/sdl2_net $(IncludeSwitch)../src/utf-cpp $(IncludeSwitch)../src/utf8 
 IncludePCH             := 
 RcIncludePath          := 
-Libs                   := $(LibrarySwitch)UnitTest++ $(LibrarySwitch)SqliteWrapped $(LibrarySwitch)sqlite3 $(LibrarySwitch)pthread $(LibrarySwitch)ssl $(LibrarySwitch)crypto $(LibrarySwitch)yaml-cpp $(LibrarySwitch)ssh $(LibrarySwitch)uuid 
-ArLibs                 :=  "libUnitTest++.a" "libSqliteWrapped.a" "sqlite3" "pthread" "ssl" "crypto" "yaml-cpp" "libssh" "uuid" 
+Libs                   := $(LibrarySwitch)UnitTest++ $(LibrarySwitch)SqliteWrapped $(LibrarySwitch)sqlite3 $(LibrarySwitch)pthread $(LibrarySwitch)ssl $(LibrarySwitch)crypto $(LibrarySwitch)yaml-cpp $(LibrarySwitch)ssh $(LibrarySwitch)uuid $(LibrarySwitch)z 
+ArLibs                 :=  "libUnitTest++.a" "libSqliteWrapped.a" "sqlite3" "pthread" "ssl" "crypto" "yaml-cpp" "libssh" "uuid" "z" 
 LibPath                := $(LibraryPathSwitch). $(LibraryPathSwitch). $(LibraryPathSwitch)$(UNIT_TEST_PP_SRC_DIR)/Debug $(LibraryPathSwitch)../sqlitewrap/Debug $(LibraryPathSwitch)../sqlitewrap $(LibraryPathSwitch)../src 
 
 ##
@@ -63,7 +63,7 @@ CodeLiteDir:=/usr/share/codelite
 Objects0=$(IntermediateDirectory)/main.cpp$(ObjectSuffix) $(IntermediateDirectory)/common_io_ut.cpp$(ObjectSuffix) $(IntermediateDirectory)/session_io_ut.cpp$(ObjectSuffix) $(IntermediateDirectory)/ansi_processor_ut.cpp$(ObjectSuffix) $(IntermediateDirectory)/src_ansi_processor.cpp$(ObjectSuffix) $(IntermediateDirectory)/users_dao_ut.cpp$(ObjectSuffix) $(IntermediateDirectory)/src_session_manager.cpp$(ObjectSuffix) $(IntermediateDirectory)/src_common_io.cpp$(ObjectSuffix) $(IntermediateDirectory)/src_session_io.cpp$(ObjectSuffix) $(IntermediateDirectory)/access_condition_ut.cpp$(ObjectSuffix) \
 	$(IntermediateDirectory)/src_access_condition.cpp$(ObjectSuffix) $(IntermediateDirectory)/form_system_config_ut.cpp$(ObjectSuffix) $(IntermediateDirectory)/src_form_manager.cpp$(ObjectSuffix) $(IntermediateDirectory)/conference_dao_it.cpp$(ObjectSuffix) $(IntermediateDirectory)/file_area_dao_it.cpp$(ObjectSuffix) $(IntermediateDirectory)/message_area_dao_it.cpp$(ObjectSuffix) $(IntermediateDirectory)/oneliners_dao_it.cpp$(ObjectSuffix) $(IntermediateDirectory)/src_io_service.cpp$(ObjectSuffix) $(IntermediateDirectory)/src_communicator.cpp$(ObjectSuffix) $(IntermediateDirectory)/src_socket_handler.cpp$(ObjectSuffix) \
 	$(IntermediateDirectory)/src_socket_ssh.cpp$(ObjectSuffix) $(IntermediateDirectory)/src_socket_telnet.cpp$(ObjectSuffix) $(IntermediateDirectory)/data-sys_config_dao.cpp$(ObjectSuffix) $(IntermediateDirectory)/data-sys_conference_dao.cpp$(ObjectSuffix) $(IntermediateDirectory)/data-sys_menu_dao.cpp$(ObjectSuffix) $(IntermediateDirectory)/data-sys_file_area_dao.cpp$(ObjectSuffix) $(IntermediateDirectory)/data-sys_message_area_dao.cpp$(ObjectSuffix) $(IntermediateDirectory)/data-sys_access_level_dao.cpp$(ObjectSuffix) $(IntermediateDirectory)/data-sys_protocol_dao.cpp$(ObjectSuffix) $(IntermediateDirectory)/data-sys_security_dao.cpp$(ObjectSuffix) \
-	$(IntermediateDirectory)/data-sys_session_stats_dao.cpp$(ObjectSuffix) $(IntermediateDirectory)/data-sys_users_dao.cpp$(ObjectSuffix) $(IntermediateDirectory)/data-sys_text_prompts_dao.cpp$(ObjectSuffix) $(IntermediateDirectory)/forms_form_system_config.cpp$(ObjectSuffix) $(IntermediateDirectory)/data-app_oneliners_dao.cpp$(ObjectSuffix) $(IntermediateDirectory)/sdl2_net_SDLnet.cpp$(ObjectSuffix) $(IntermediateDirectory)/sdl2_net_SDLnetselect.cpp$(ObjectSuffix) $(IntermediateDirectory)/sdl2_net_SDLnetTCP.cpp$(ObjectSuffix) $(IntermediateDirectory)/sdl2_net_SDLnetUDP.cpp$(ObjectSuffix) 
+	$(IntermediateDirectory)/data-sys_session_stats_dao.cpp$(ObjectSuffix) $(IntermediateDirectory)/data-sys_users_dao.cpp$(ObjectSuffix) $(IntermediateDirectory)/data-sys_text_prompts_dao.cpp$(ObjectSuffix) $(IntermediateDirectory)/forms_form_system_config.cpp$(ObjectSuffix) $(IntermediateDirectory)/data-app_oneliners_dao.cpp$(ObjectSuffix) $(IntermediateDirectory)/sdl2_net_SDLnet.cpp$(ObjectSuffix) $(IntermediateDirectory)/sdl2_net_SDLnetselect.cpp$(ObjectSuffix) $(IntermediateDirectory)/sdl2_net_SDLnetTCP.cpp$(ObjectSuffix) $(IntermediateDirectory)/sdl2_net_SDLnetUDP.cpp$(ObjectSuffix) $(IntermediateDirectory)/timer_wheel_ut.cpp$(ObjectSuffix) $(IntermediateDirectory)/job_queue_ut.cpp$(ObjectSuffix) $(IntermediateDirectory)/admission_control_ut.cpp$(ObjectSuffix) $(IntermediateDirectory)/io_service_ut.cpp$(ObjectSuffix) $(IntermediateDirectory)/database_pool_ut.cpp$(ObjectSuffix) $(IntermediateDirectory)/data-sys_menu_stats_dao.cpp$(ObjectSuffix) $(IntermediateDirectory)/stats_writer_ut.cpp$(ObjectSuffix) $(IntermediateDirectory)/data-sys_session_stats_daily_dao.cpp$(ObjectSuffix) $(IntermediateDirectory)/session_stats_dao_it.cpp$(ObjectSuffix) $(IntermediateDirectory)/user_directory_ut.cpp$(ObjectSuffix) $(IntermediateDirectory)/password_hasher_ut.cpp$(ObjectSuffix) $(IntermediateDirectory)/src_encryption.cpp$(ObjectSuffix) $(IntermediateDirectory)/database_executor_ut.cpp$(ObjectSuffix) $(IntermediateDirectory)/node_allocator_ut.cpp$(ObjectSuffix) $(IntermediateDirectory)/src_telnet_decoder.cpp$(ObjectSuffix) $(IntermediateDirectory)/telnet_decoder_ut.cpp$(ObjectSuffix) $(IntermediateDirectory)/mccp_compressor_ut.cpp$(ObjectSuffix) 
 
 
 
@@ -406,6 +406,142 @@ $(IntermediateDirectory)/sdl2_net_SDLnetUDP.cpp$(DependSuffix): ../src/sdl2_net/
 $(IntermediateDirectory)/sdl2_net_SDLnetUDP.cpp$(PreprocessSuffix): ../src/sdl2_net/SDLnetUDP.cpp
 	$(CXX) $(CXXFLAGS) $(IncludePCH) $(IncludePath) $(PreprocessOnlySwitch) $(OutputSwitch) $(IntermediateDirectory)/sdl2_net_SDLnetUDP.cpp$(PreprocessSuffix) "../src/sdl2_net/SDLnetUDP.cpp"
 
+$(IntermediateDirectory)/timer_wheel_ut.cpp$(ObjectSuffix): timer_wheel_ut.cpp $(IntermediateDirectory)/timer_wheel_ut.cpp$(DependSuffix)
+	$(CXX) $(IncludePCH) $(SourceSwitch) "/home/merc/code/Oblivion2-XRM/xrm-unittest/timer_wheel_ut.cpp" $(CXXFLAGS) $(ObjectSwitch)$(IntermediateDirectory)/timer_wheel_ut.cpp$(ObjectSuffix) $(IncludePath)
+$(IntermediateDirectory)/timer_wheel_ut.cpp$(DependSuffix): timer_wheel_ut.cpp
+	@$(CXX) $(CXXFLAGS) $(IncludePCH) $(IncludePath) -MG -MP -MT$(IntermediateDirectory)/timer_wheel_ut.cpp$(ObjectSuffix) -MF$(IntermediateDirectory)/timer_wheel_ut.cpp$(DependSuffix) -MM "timer_wheel_ut.cpp"
+
+$(IntermediateDirectory)/timer_wheel_ut.cpp$(PreprocessSuffix): timer_wheel_ut.cpp
+	$(CXX) $(CXXFLAGS) $(IncludePCH) $(IncludePath) $(PreprocessOnlySwitch) $(OutputSwitch) $(IntermediateDirectory)/timer_wheel_ut.cpp$(PreprocessSuffix) "timer_wheel_ut.cpp"
+
+$(IntermediateDirectory)/job_queue_ut.cpp$(ObjectSuffix): job_queue_ut.cpp $(IntermediateDirectory)/job_queue_ut.cpp$(DependSuffix)
+	$(CXX) $(IncludePCH) $(SourceSwitch) "/home/merc/code/Oblivion2-XRM/xrm-unittest/job_queue_ut.cpp" $(CXXFLAGS) $(ObjectSwitch)$(IntermediateDirectory)/job_queue_ut.cpp$(ObjectSuffix) $(IncludePath)
+$(IntermediateDirectory)/job_queue_ut.cpp$(DependSuffix): job_queue_ut.cpp
+	@$(CXX) $(CXXFLAGS) $(IncludePCH) $(IncludePath) -MG -MP -MT$(IntermediateDirectory)/job_queue_ut.cpp$(ObjectSuffix) -MF$(IntermediateDirectory)/job_queue_ut.cpp$(DependSuffix) -MM "job_queue_ut.cpp"
+
+$(IntermediateDirectory)/job_queue_ut.cpp$(PreprocessSuffix): job_queue_ut.cpp
+	$(CXX) $(CXXFLAGS) $(IncludePCH) $(IncludePath) $(PreprocessOnlySwitch) $(OutputSwitch) $(IntermediateDirectory)/job_queue_ut.cpp$(PreprocessSuffix) "job_queue_ut.cpp"
+
+$(IntermediateDirectory)/admission_control_ut.cpp$(ObjectSuffix): admission_control_ut.cpp $(IntermediateDirectory)/admission_control_ut.cpp$(DependSuffix)
+	$(CXX) $(IncludePCH) $(SourceSwitch) "/home/merc/code/Oblivion2-XRM/xrm-unittest/admission_control_ut.cpp" $(CXXFLAGS) $(ObjectSwitch)$(IntermediateDirectory)/admission_control_ut.cpp$(ObjectSuffix) $(IncludePath)
+$(IntermediateDirectory)/admission_control_ut.cpp$(DependSuffix): admission_control_ut.cpp
+	@$(CXX) $(CXXFLAGS) $(IncludePCH) $(IncludePath) -MG -MP -MT$(IntermediateDirectory)/admission_control_ut.cpp$(ObjectSuffix) -MF$(IntermediateDirectory)/admission_control_ut.cpp$(DependSuffix) -MM "admission_control_ut.cpp"
+
+$(IntermediateDirectory)/admission_control_ut.cpp$(PreprocessSuffix): admission_control_ut.cpp
+	$(CXX) $(CXXFLAGS) $(IncludePCH) $(IncludePath) $(PreprocessOnlySwitch) $(OutputSwitch) $(IntermediateDirectory)/admission_control_ut.cpp$(PreprocessSuffix) "admission_control_ut.cpp"
+
+$(IntermediateDirectory)/io_service_ut.cpp$(ObjectSuffix): io_service_ut.cpp $(IntermediateDirectory)/io_service_ut.cpp$(DependSuffix)
+	$(CXX) $(IncludePCH) $(SourceSwitch) "/home/merc/code/Oblivion2-XRM/xrm-unittest/io_service_ut.cpp" $(CXXFLAGS) $(ObjectSwitch)$(IntermediateDirectory)/io_service_ut.cpp$(ObjectSuffix) $(IncludePath)
+$(IntermediateDirectory)/io_service_ut.cpp$(DependSuffix): io_service_ut.cpp
+	@$(CXX) $(CXXFLAGS) $(IncludePCH) $(IncludePath) -MG -MP -MT$(IntermediateDirectory)/io_service_ut.cpp$(ObjectSuffix) -MF$(IntermediateDirectory)/io_service_ut.cpp$(DependSuffix) -MM "io_service_ut.cpp"
+
+$(IntermediateDirectory)/io_service_ut.cpp$(PreprocessSuffix): io_service_ut.cpp
+	$(CXX) $(CXXFLAGS) $(IncludePCH) $(IncludePath) $(PreprocessOnlySwitch) $(OutputSwitch) $(IntermediateDirectory)/io_service_ut.cpp$(PreprocessSuffix) "io_service_ut.cpp"
+
+$(IntermediateDirectory)/database_pool_ut.cpp$(ObjectSuffix): database_pool_ut.cpp $(IntermediateDirectory)/database_pool_ut.cpp$(DependSuffix)
+	$(CXX) $(IncludePCH) $(SourceSwitch) "/home/merc/code/Oblivion2-XRM/xrm-unittest/database_pool_ut.cpp" $(CXXFLAGS) $(ObjectSwitch)$(IntermediateDirectory)/database_pool_ut.cpp$(ObjectSuffix) $(IncludePath)
+$(IntermediateDirectory)/database_pool_ut.cpp$(DependSuffix): database_pool_ut.cpp
+	@$(CXX) $(CXXFLAGS) $(IncludePCH) $(IncludePath) -MG -MP -MT$(IntermediateDirectory)/database_pool_ut.cpp$(ObjectSuffix) -MF$(IntermediateDirectory)/database_pool_ut.cpp$(DependSuffix) -MM "database_pool_ut.cpp"
+
+$(IntermediateDirectory)/database_pool_ut.cpp$(PreprocessSuffix): database_pool_ut.cpp
+	$(CXX) $(CXXFLAGS) $(IncludePCH) $(IncludePath) $(PreprocessOnlySwitch) $(OutputSwitch) $(IntermediateDirectory)/database_pool_ut.cpp$(PreprocessSuffix) "database_pool_ut.cpp"
+
+$(IntermediateDirectory)/data-sys_menu_stats_dao.cpp$(ObjectSuffix): ../src/data-sys/menu_stats_dao.cpp $(IntermediateDirectory)/data-sys_menu_stats_dao.cpp$(DependSuffix)
+	$(CXX) $(IncludePCH) $(SourceSwitch) "/home/merc/code/Oblivion2-XRM/src/data-sys/menu_stats_dao.cpp" $(CXXFLAGS) $(ObjectSwitch)$(IntermediateDirectory)/data-sys_menu_stats_dao.cpp$(ObjectSuffix) $(IncludePath)
+$(IntermediateDirectory)/data-sys_menu_stats_dao.cpp$(DependSuffix): ../src/data-sys/menu_stats_dao.cpp
+	@$(CXX) $(CXXFLAGS) $(IncludePCH) $(IncludePath) -MG -MP -MT$(IntermediateDirectory)/data-sys_menu_stats_dao.cpp$(ObjectSuffix) -MF$(IntermediateDirectory)/data-sys_menu_stats_dao.cpp$(DependSuffix) -MM "../src/data-sys/menu_stats_dao.cpp"
+
+$(IntermediateDirectory)/data-sys_menu_stats_dao.cpp$(PreprocessSuffix): ../src/data-sys/menu_stats_dao.cpp
+	$(CXX) $(CXXFLAGS) $(IncludePCH) $(IncludePath) $(PreprocessOnlySwitch) $(OutputSwitch) $(IntermediateDirectory)/data-sys_menu_stats_dao.cpp$(PreprocessSuffix) "../src/data-sys/menu_stats_dao.cpp"
+
+$(IntermediateDirectory)/stats_writer_ut.cpp$(ObjectSuffix): stats_writer_ut.cpp $(IntermediateDirectory)/stats_writer_ut.cpp$(DependSuffix)
+	$(CXX) $(IncludePCH) $(SourceSwitch) "/home/merc/code/Oblivion2-XRM/xrm-unittest/stats_writer_ut.cpp" $(CXXFLAGS) $(ObjectSwitch)$(IntermediateDirectory)/stats_writer_ut.cpp$(ObjectSuffix) $(IncludePath)
+$(IntermediateDirectory)/stats_writer_ut.cpp$(DependSuffix): stats_writer_ut.cpp
+	@$(CXX) $(CXXFLAGS) $(IncludePCH) $(IncludePath) -MG -MP -MT$(IntermediateDirectory)/stats_writer_ut.cpp$(ObjectSuffix) -MF$(IntermediateDirectory)/stats_writer_ut.cpp$(DependSuffix) -MM "stats_writer_ut.cpp"
+
+$(IntermediateDirectory)/stats_writer_ut.cpp$(PreprocessSuffix): stats_writer_ut.cpp
+	$(CXX) $(CXXFLAGS) $(IncludePCH) $(IncludePath) $(PreprocessOnlySwitch) $(OutputSwitch) $(IntermediateDirectory)/stats_writer_ut.cpp$(PreprocessSuffix) "stats_writer_ut.cpp"
+
+$(IntermediateDirectory)/data-sys_session_stats_daily_dao.cpp$(ObjectSuffix): ../src/data-sys/session_stats_daily_dao.cpp $(IntermediateDirectory)/data-sys_session_stats_daily_dao.cpp$(DependSuffix)
+	$(CXX) $(IncludePCH) $(SourceSwitch) "/home/merc/code/Oblivion2-XRM/src/data-sys/session_stats_daily_dao.cpp" $(CXXFLAGS) $(ObjectSwitch)$(IntermediateDirectory)/data-sys_session_stats_daily_dao.cpp$(ObjectSuffix) $(IncludePath)
+$(IntermediateDirectory)/data-sys_session_stats_daily_dao.cpp$(DependSuffix): ../src/data-sys/session_stats_daily_dao.cpp
+	@$(CXX) $(CXXFLAGS) $(IncludePCH) $(IncludePath) -MG -MP -MT$(IntermediateDirectory)/data-sys_session_stats_daily_dao.cpp$(ObjectSuffix) -MF$(IntermediateDirectory)/data-sys_session_stats_daily_dao.cpp$(DependSuffix) -MM "../src/data-sys/session_stats_daily_dao.cpp"
+
+$(IntermediateDirectory)/data-sys_session_stats_daily_dao.cpp$(PreprocessSuffix): ../src/data-sys/session_stats_daily_dao.cpp
+	$(CXX) $(CXXFLAGS) $(IncludePCH) $(IncludePath) $(PreprocessOnlySwitch) $(OutputSwitch) $(IntermediateDirectory)/data-sys_session_stats_daily_dao.cpp$(PreprocessSuffix) "../src/data-sys/session_stats_daily_dao.cpp"
+
+$(IntermediateDirectory)/session_stats_dao_it.cpp$(ObjectSuffix): session_stats_dao_it.cpp $(IntermediateDirectory)/session_stats_dao_it.cpp$(DependSuffix)
+	$(CXX) $(IncludePCH) $(SourceSwitch) "/home/merc/code/Oblivion2-XRM/xrm-unittest/session_stats_dao_it.cpp" $(CXXFLAGS) $(ObjectSwitch)$(IntermediateDirectory)/session_stats_dao_it.cpp$(ObjectSuffix) $(IncludePath)
+$(IntermediateDirectory)/session_stats_dao_it.cpp$(DependSuffix): session_stats_dao_it.cpp
+	@$(CXX) $(CXXFLAGS) $(IncludePCH) $(IncludePath) -MG -MP -MT$(IntermediateDirectory)/session_stats_dao_it.cpp$(ObjectSuffix) -MF$(IntermediateDirectory)/session_stats_dao_it.cpp$(DependSuffix) -MM "session_stats_dao_it.cpp"
+
+$(IntermediateDirectory)/session_stats_dao_it.cpp$(PreprocessSuffix): session_stats_dao_it.cpp
+	$(CXX) $(CXXFLAGS) $(IncludePCH) $(IncludePath) $(PreprocessOnlySwitch) $(OutputSwitch) $(IntermediateDirectory)/session_stats_dao_it.cpp$(PreprocessSuffix) "session_stats_dao_it.cpp"
+
+$(IntermediateDirectory)/user_directory_ut.cpp$(ObjectSuffix): user_directory_ut.cpp $(IntermediateDirectory)/user_directory_ut.cpp$(DependSuffix)
+	$(CXX) $(IncludePCH) $(SourceSwitch) "/home/merc/code/Oblivion2-XRM/xrm-unittest/user_directory_ut.cpp" $(CXXFLAGS) $(ObjectSwitch)$(IntermediateDirectory)/user_directory_ut.cpp$(ObjectSuffix) $(IncludePath)
+$(IntermediateDirectory)/user_directory_ut.cpp$(DependSuffix): user_directory_ut.cpp
+	@$(CXX) $(CXXFLAGS) $(IncludePCH) $(IncludePath) -MG -MP -MT$(IntermediateDirectory)/user_directory_ut.cpp$(ObjectSuffix) -MF$(IntermediateDirectory)/user_directory_ut.cpp$(DependSuffix) -MM "user_directory_ut.cpp"
+
+$(IntermediateDirectory)/user_directory_ut.cpp$(PreprocessSuffix): user_directory_ut.cpp
+	$(CXX) $(CXXFLAGS) $(IncludePCH) $(IncludePath) $(PreprocessOnlySwitch) $(OutputSwitch) $(IntermediateDirectory)/user_directory_ut.cpp$(PreprocessSuffix) "user_directory_ut.cpp"
+
+$(IntermediateDirectory)/password_hasher_ut.cpp$(ObjectSuffix): password_hasher_ut.cpp $(IntermediateDirectory)/password_hasher_ut.cpp$(DependSuffix)
+	$(CXX) $(IncludePCH) $(SourceSwitch) "/home/merc/code/Oblivion2-XRM/xrm-unittest/password_hasher_ut.cpp" $(CXXFLAGS) $(ObjectSwitch)$(IntermediateDirectory)/password_hasher_ut.cpp$(ObjectSuffix) $(IncludePath)
+$(IntermediateDirectory)/password_hasher_ut.cpp$(DependSuffix): password_hasher_ut.cpp
+	@$(CXX) $(CXXFLAGS) $(IncludePCH) $(IncludePath) -MG -MP -MT$(IntermediateDirectory)/password_hasher_ut.cpp$(ObjectSuffix) -MF$(IntermediateDirectory)/password_hasher_ut.cpp$(DependSuffix) -MM "password_hasher_ut.cpp"
+
+$(IntermediateDirectory)/password_hasher_ut.cpp$(PreprocessSuffix): password_hasher_ut.cpp
+	$(CXX) $(CXXFLAGS) $(IncludePCH) $(IncludePath) $(PreprocessOnlySwitch) $(OutputSwitch) $(IntermediateDirectory)/password_hasher_ut.cpp$(PreprocessSuffix) "password_hasher_ut.cpp"
+
+$(IntermediateDirectory)/src_encryption.cpp$(ObjectSuffix): ../src/encryption.cpp $(IntermediateDirectory)/src_encryption.cpp$(DependSuffix)
+	$(CXX) $(IncludePCH) $(SourceSwitch) "/home/merc/code/Oblivion2-XRM/src/encryption.cpp" $(CXXFLAGS) $(ObjectSwitch)$(IntermediateDirectory)/src_encryption.cpp$(ObjectSuffix) $(IncludePath)
+$(IntermediateDirectory)/src_encryption.cpp$(DependSuffix): ../src/encryption.cpp
+	@$(CXX) $(CXXFLAGS) $(IncludePCH) $(IncludePath) -MG -MP -MT$(IntermediateDirectory)/src_encryption.cpp$(ObjectSuffix) -MF$(IntermediateDirectory)/src_encryption.cpp$(DependSuffix) -MM "../src/encryption.cpp"
+
+$(IntermediateDirectory)/src_encryption.cpp$(PreprocessSuffix): ../src/encryption.cpp
+	$(CXX) $(CXXFLAGS) $(IncludePCH) $(IncludePath) $(PreprocessOnlySwitch) $(OutputSwitch) $(IntermediateDirectory)/src_encryption.cpp$(PreprocessSuffix) "../src/encryption.cpp"
+
+$(IntermediateDirectory)/database_executor_ut.cpp$(ObjectSuffix): database_executor_ut.cpp $(IntermediateDirectory)/database_executor_ut.cpp$(DependSuffix)
+	$(CXX) $(IncludePCH) $(SourceSwitch) "/home/merc/code/Oblivion2-XRM/xrm-unittest/database_executor_ut.cpp" $(CXXFLAGS) $(ObjectSwitch)$(IntermediateDirectory)/database_executor_ut.cpp$(ObjectSuffix) $(IncludePath)
+$(IntermediateDirectory)/database_executor_ut.cpp$(DependSuffix): database_executor_ut.cpp
+	@$(CXX) $(CXXFLAGS) $(IncludePCH) $(IncludePath) -MG -MP -MT$(IntermediateDirectory)/database_executor_ut.cpp$(ObjectSuffix) -MF$(IntermediateDirectory)/database_executor_ut.cpp$(DependSuffix) -MM "database_executor_ut.cpp"
+
+$(IntermediateDirectory)/database_executor_ut.cpp$(PreprocessSuffix): database_executor_ut.cpp
+	$(CXX) $(CXXFLAGS) $(IncludePCH) $(IncludePath) $(PreprocessOnlySwitch) $(OutputSwitch) $(IntermediateDirectory)/database_executor_ut.cpp$(PreprocessSuffix) "database_executor_ut.cpp"
+
+$(IntermediateDirectory)/node_allocator_ut.cpp$(ObjectSuffix): node_allocator_ut.cpp $(IntermediateDirectory)/node_allocator_ut.cpp$(DependSuffix)
+	$(CXX) $(IncludePCH) $(SourceSwitch) "/home/merc/code/Oblivion2-XRM/xrm-unittest/node_allocator_ut.cpp" $(CXXFLAGS) $(ObjectSwitch)$(IntermediateDirectory)/node_allocator_ut.cpp$(ObjectSuffix) $(IncludePath)
+$(IntermediateDirectory)/node_allocator_ut.cpp$(DependSuffix): node_allocator_ut.cpp
+	@$(CXX) $(CXXFLAGS) $(IncludePCH) $(IncludePath) -MG -MP -MT$(IntermediateDirectory)/node_allocator_ut.cpp$(ObjectSuffix) -MF$(IntermediateDirectory)/node_allocator_ut.cpp$(DependSuffix) -MM "node_allocator_ut.cpp"
+
+$(IntermediateDirectory)/node_allocator_ut.cpp$(PreprocessSuffix): node_allocator_ut.cpp
+	$(CXX) $(CXXFLAGS) $(IncludePCH) $(IncludePath) $(PreprocessOnlySwitch) $(OutputSwitch) $(IntermediateDirectory)/node_allocator_ut.cpp$(PreprocessSuffix) "node_allocator_ut.cpp"
+
+$(IntermediateDirectory)/src_telnet_decoder.cpp$(ObjectSuffix): ../src/telnet_decoder.cpp $(IntermediateDirectory)/src_telnet_decoder.cpp$(DependSuffix)
+	$(CXX) $(IncludePCH) $(SourceSwitch) "/home/merc/code/Oblivion2-XRM/src/telnet_decoder.cpp" $(CXXFLAGS) $(ObjectSwitch)$(IntermediateDirectory)/src_telnet_decoder.cpp$(ObjectSuffix) $(IncludePath)
+$(IntermediateDirectory)/src_telnet_decoder.cpp$(DependSuffix): ../src/telnet_decoder.cpp
+	@$(CXX) $(CXXFLAGS) $(IncludePCH) $(IncludePath) -MG -MP -MT$(IntermediateDirectory)/src_telnet_decoder.cpp$(ObjectSuffix) -MF$(IntermediateDirectory)/src_telnet_decoder.cpp$(DependSuffix) -MM "../src/telnet_decoder.cpp"
+
+$(IntermediateDirectory)/src_telnet_decoder.cpp$(PreprocessSuffix): ../src/telnet_decoder.cpp
+	$(CXX) $(CXXFLAGS) $(IncludePCH) $(IncludePath) $(PreprocessOnlySwitch) $(OutputSwitch) $(IntermediateDirectory)/src_telnet_decoder.cpp$(PreprocessSuffix) "../src/telnet_decoder.cpp"
+
+$(IntermediateDirectory)/telnet_decoder_ut.cpp$(ObjectSuffix): telnet_decoder_ut.cpp $(IntermediateDirectory)/telnet_decoder_ut.cpp$(DependSuffix)
+	$(CXX) $(IncludePCH) $(SourceSwitch) "/home/merc/code/Oblivion2-XRM/xrm-unittest/telnet_decoder_ut.cpp" $(CXXFLAGS) $(ObjectSwitch)$(IntermediateDirectory)/telnet_decoder_ut.cpp$(ObjectSuffix) $(IncludePath)
+$(IntermediateDirectory)/telnet_decoder_ut.cpp$(DependSuffix): telnet_decoder_ut.cpp
+	@$(CXX) $(CXXFLAGS) $(IncludePCH) $(IncludePath) -MG -MP -MT$(IntermediateDirectory)/telnet_decoder_ut.cpp$(ObjectSuffix) -MF$(IntermediateDirectory)/telnet_decoder_ut.cpp$(DependSuffix) -MM "telnet_decoder_ut.cpp"
+
+$(IntermediateDirectory)/telnet_decoder_ut.cpp$(PreprocessSuffix): telnet_decoder_ut.cpp
+	$(CXX) $(CXXFLAGS) $(IncludePCH) $(IncludePath) $(PreprocessOnlySwitch) $(OutputSwitch) $(IntermediateDirectory)/telnet_decoder_ut.cpp$(PreprocessSuffix) "telnet_decoder_ut.cpp"
+
+$(IntermediateDirectory)/mccp_compressor_ut.cpp$(ObjectSuffix): mccp_compressor_ut.cpp $(IntermediateDirectory)/mccp_compressor_ut.cpp$(DependSuffix)
+	$(CXX) $(IncludePCH) $(SourceSwitch) "/home/merc/code/Oblivion2-XRM/xrm-unittest/mccp_compressor_ut.cpp" $(CXXFLAGS) $(ObjectSwitch)$(IntermediateDirectory)/mccp_compressor_ut.cpp$(ObjectSuffix) $(IncludePath)
+$(IntermediateDirectory)/mccp_compressor_ut.cpp$(DependSuffix): mccp_compressor_ut.cpp
+	@$(CXX) $(CXXFLAGS) $(IncludePCH) $(IncludePath) -MG -MP -MT$(IntermediateDirectory)/mccp_compressor_ut.cpp$(ObjectSuffix) -MF$(IntermediateDirectory)/mccp_compressor_ut.cpp$(DependSuffix) -MM "mccp_compressor_ut.cpp"
+
+$(IntermediateDirectory)/mccp_compressor_ut.cpp$(PreprocessSuffix): mccp_compressor_ut.cpp
+	$(CXX) $(CXXFLAGS) $(IncludePCH) $(IncludePath) $(PreprocessOnlySwitch) $(OutputSwitch) $(IntermediateDirectory)/mccp_compressor_ut.cpp$(PreprocessSuffix) "mccp_compressor_ut.cpp"
+
 
 -include $(IntermediateDirectory)/*$(DependSuffix)
 ##